@@ -0,0 +1,211 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#include "compression.h"
+
+#include <string.h>
+#include <new>
+#include <vector>
+
+#include "netframe.h"
+
+namespace compression {
+
+namespace {
+
+/* CODEC_LZ stream is a sequence of
+ *   token: literals count (high nibble) | match length - kMinMatch (low nibble)
+ *   [literals count - 15 as 255, 255, ..., n]  if the high nibble is 15
+ *   literals
+ *   match offset, 2 bytes little endian         absent in the last sequence
+ *   [match length - kMinMatch - 15 as above]    if the low nibble is 15
+ * The last sequence has literals only (possibly none).
+ */
+
+static const size_t kMinMatch		= 4;
+static const size_t kMaxOffset		= 0xFFFF;
+static const unsigned kHashBits		= 14;
+static const unsigned kSkipTrigger	= 6; // search step grows on incompressible data
+
+inline uint32_t read32(const uint8_t* p)
+{
+	uint32_t rv;
+	memcpy(&rv, p, sizeof(rv));
+	return rv;
+}
+
+inline uint32_t hash32(uint32_t v)
+{
+	return (v * 2654435761u) >> (32 - kHashBits);
+}
+
+void putLength(std::string& out, size_t len)
+{
+	for (; len >= 0xFF; len -= 0xFF)
+		out.push_back(char(0xFF));
+	out.push_back(char(len));
+}
+
+bool getLength(const uint8_t* src, size_t size, size_t& pos, size_t& len)
+{
+	uint8_t b = 0;
+	do {
+		if (pos >= size)
+			return false;
+		b = src[pos++];
+		len += b;
+	} while (b == 0xFF);
+	return true;
+}
+
+void putSequence(std::string& out, const uint8_t* literals, size_t litLen, size_t offset, size_t matchLen)
+{
+	const size_t m = matchLen ? matchLen - kMinMatch : 0;
+	out.push_back(char(((litLen < 15 ? litLen : 15) << 4) | (m < 15 ? m : 15)));
+	if (litLen >= 15)
+		putLength(out, litLen - 15);
+	out.append(reinterpret_cast<const char*>(literals), litLen);
+	if (!matchLen)
+		return;
+	out.push_back(char(offset & 0xFF));
+	out.push_back(char(offset >> 8));
+	if (m >= 15)
+		putLength(out, m - 15);
+}
+
+void lzCompress(const uint8_t* src, size_t size, std::string& out)
+{
+	std::vector<uint32_t> table(size_t(1) << kHashBits, 0);
+	size_t anchor = 0;
+	size_t pos = 0;
+
+	while (size >= kMinMatch && pos <= size - kMinMatch)
+	{
+		const uint32_t v = read32(src + pos);
+		uint32_t& slot = table[hash32(v)];
+		const size_t ref = slot;
+		slot = static_cast<uint32_t>(pos);
+
+		if (ref >= pos || pos - ref > kMaxOffset || read32(src + ref) != v)
+		{
+			pos += 1 + ((pos - anchor) >> kSkipTrigger);
+			continue;
+		}
+
+		size_t matchLen = kMinMatch;
+		while (pos + matchLen < size && src[ref + matchLen] == src[pos + matchLen])
+			++matchLen;
+
+		putSequence(out, src + anchor, pos - anchor, pos - ref, matchLen);
+		pos += matchLen;
+		anchor = pos;
+	}
+	putSequence(out, src + anchor, size - anchor, 0, 0);
+}
+
+bool lzDecompress(const uint8_t* src, size_t size, char* dst, size_t dstSize)
+{
+	size_t pos = 0;
+	size_t outPos = 0;
+	while (pos < size)
+	{
+		const uint8_t token = src[pos++];
+		size_t litLen = token >> 4;
+		if (litLen == 15 && !getLength(src, size, pos, litLen))
+			return false;
+		if (litLen > size - pos || litLen > dstSize - outPos)
+			return false;
+		memcpy(dst + outPos, src + pos, litLen);
+		pos += litLen;
+		outPos += litLen;
+		if (pos == size)
+			break; // the last sequence
+
+		if (size - pos < 2)
+			return false;
+		const size_t offset = src[pos] | (size_t(src[pos + 1]) << 8);
+		pos += 2;
+		size_t matchLen = token & 0x0F;
+		if (matchLen == 15 && !getLength(src, size, pos, matchLen))
+			return false;
+		matchLen += kMinMatch;
+		if (!offset || offset > outPos || matchLen > dstSize - outPos)
+			return false;
+
+		const char* from = dst + outPos - offset;
+		if (offset >= matchLen)
+		{
+			memcpy(dst + outPos, from, matchLen);
+		}
+		else
+		{
+			// overlapped copy repeats the last 'offset' bytes
+			for (size_t i = 0; i < matchLen; ++i)
+				dst[outPos + i] = from[i];
+		}
+		outPos += matchLen;
+	}
+	return outPos == dstSize;
+}
+
+} // anonymous
+
+Codec choose(uint32_t peerCodecs)
+{
+	return (peerCodecs & supportedCodecs() & codecMask(CODEC_LZ)) ? CODEC_LZ : CODEC_None;
+}
+
+bool pack(Codec codec, const std::string& payload, std::string& packed)
+{
+	packed.clear();
+	if (codec != CODEC_LZ || payload.size() < kMinPackSize)
+		return false;
+
+	const uint32_t rawSize = static_cast<uint32_t>(payload.size());
+	try
+	{
+		packed.reserve(payload.size() + payload.size() / 0xFF + 16);
+		packed.append(reinterpret_cast<const char*>(&rawSize), sizeof(rawSize));
+		lzCompress(reinterpret_cast<const uint8_t*>(payload.data()), payload.size(), packed);
+	}
+	catch (const std::bad_alloc&)
+	{
+		packed.clear();
+		return false;
+	}
+	// don't bother the receiver if less than 1/16 is saved
+	return packed.size() < payload.size() - payload.size() / 16;
+}
+
+bool unpack(Codec codec, const char* data, size_t size, std::string& payload)
+{
+	payload.clear();
+	if (codec == CODEC_None)
+	{
+		payload.assign(data, size);
+		return true;
+	}
+	uint32_t rawSize = 0;
+	if (codec != CODEC_LZ || size < sizeof(rawSize))
+		return false;
+	memcpy(&rawSize, data, sizeof(rawSize));
+	if (rawSize > netframe::kMaxPayloadSize)
+		return false;
+	try
+	{
+		payload.resize(rawSize);
+	}
+	catch (const std::bad_alloc&)
+	{
+		return false;
+	}
+	return lzDecompress(reinterpret_cast<const uint8_t*>(data) + sizeof(rawSize), size - sizeof(rawSize),
+		rawSize ? &payload[0] : nullptr, rawSize);
+}
+
+} // compression
@@ -0,0 +1,43 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+/* Frame payload compression shared by labeless_ida and labeless_olly.
+ *
+ * The peers exchange the masks of supported codecs in rpc::Hello, the server
+ * picks one and every frame may be packed with it afterwards. A packed frame
+ * has netframe::Header::codec set and its payload is
+ *   uint32_t unpacked size | compressed data
+ * Small or incompressible payloads are sent as is (CODEC_None).
+ */
+
+namespace compression {
+
+enum Codec
+{
+	CODEC_None	= 0,
+	CODEC_LZ	= 1  // byte oriented LZ77, 64 KiB window, no entropy coding
+};
+
+static const size_t kMinPackSize	= 4096;
+
+inline uint32_t codecMask(Codec c) { return c == CODEC_None ? 0 : 1u << c; }
+inline uint32_t supportedCodecs() { return codecMask(CODEC_LZ); }
+
+// picks the best codec supported by both sides
+Codec choose(uint32_t peerCodecs);
+
+// returns false if the payload is too small or doesn't shrink, 'packed' should not be used then
+bool pack(Codec codec, const std::string& payload, std::string& packed);
+bool unpack(Codec codec, const char* data, size_t size, std::string& payload);
+
+} // compression
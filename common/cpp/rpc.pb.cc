@@ -24,6 +24,12 @@ const ::google::protobuf::Descriptor* RpcRequest_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   RpcRequest_reflection_ = NULL;
 const ::google::protobuf::EnumDescriptor* RpcRequest_RequestType_descriptor_ = NULL;
+const ::google::protobuf::Descriptor* Relocation_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  Relocation_reflection_ = NULL;
+const ::google::protobuf::Descriptor* Hello_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  Hello_reflection_ = NULL;
 const ::google::protobuf::Descriptor* Execute_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   Execute_reflection_ = NULL;
@@ -31,6 +37,9 @@ const ::google::protobuf::Descriptor* Response_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   Response_reflection_ = NULL;
 const ::google::protobuf::EnumDescriptor* Response_JobStatus_descriptor_ = NULL;
+const ::google::protobuf::Descriptor* PackedNames_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  PackedNames_reflection_ = NULL;
 const ::google::protobuf::Descriptor* MakeNamesRequest_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   MakeNamesRequest_reflection_ = NULL;
@@ -43,6 +52,15 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* MakeCommentsRequest_Name_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   MakeCommentsRequest_Name_reflection_ = NULL;
+const ::google::protobuf::Descriptor* GetNamesRequest_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  GetNamesRequest_reflection_ = NULL;
+const ::google::protobuf::Descriptor* GetNamesResult_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  GetNamesResult_reflection_ = NULL;
+const ::google::protobuf::Descriptor* GetNamesResult_Name_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  GetNamesResult_Name_reflection_ = NULL;
 const ::google::protobuf::Descriptor* GetMemoryMapResult_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   GetMemoryMapResult_reflection_ = NULL;
@@ -61,6 +79,12 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* ReadMemoryRegionsResult_Memory_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   ReadMemoryRegionsResult_Memory_reflection_ = NULL;
+const ::google::protobuf::Descriptor* OutputChunk_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  OutputChunk_reflection_ = NULL;
+const ::google::protobuf::Descriptor* MemoryChunk_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  MemoryChunk_reflection_ = NULL;
 const ::google::protobuf::Descriptor* AnalyzeExternalRefsRequest_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   AnalyzeExternalRefsRequest_reflection_ = NULL;
@@ -100,13 +124,14 @@ void protobuf_AssignDesc_rpc_2eproto() {
       "rpc.proto");
   GOOGLE_CHECK(file != NULL);
   RpcRequest_descriptor_ = file->message_type(0);
-  static const int RpcRequest_offsets_[6] = {
+  static const int RpcRequest_offsets_[7] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RpcRequest, request_type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RpcRequest, make_names_req_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RpcRequest, make_comments_req_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RpcRequest, read_memory_regions_req_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RpcRequest, analyze_external_refs_req_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RpcRequest, check_pe_headers_req_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RpcRequest, get_names_req_),
   };
   RpcRequest_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -120,13 +145,50 @@ void protobuf_AssignDesc_rpc_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(RpcRequest));
   RpcRequest_RequestType_descriptor_ = RpcRequest_descriptor_->enum_type(0);
-  Execute_descriptor_ = file->message_type(1);
-  static const int Execute_offsets_[5] = {
+  Relocation_descriptor_ = file->message_type(1);
+  static const int Relocation_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Relocation, start_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Relocation, end_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Relocation, remote_start_),
+  };
+  Relocation_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      Relocation_descriptor_,
+      Relocation::default_instance_,
+      Relocation_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Relocation, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Relocation, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(Relocation));
+  Hello_descriptor_ = file->message_type(2);
+  static const int Hello_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hello, protocol_version_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hello, labeless_version_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hello, codecs_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hello, relocations_),
+  };
+  Hello_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      Hello_descriptor_,
+      Hello::default_instance_,
+      Hello_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hello, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hello, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(Hello));
+  Execute_descriptor_ = file->message_type(3);
+  static const int Execute_offsets_[7] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Execute, script_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Execute, script_extern_obj_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Execute, rpc_request_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Execute, background_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Execute, job_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Execute, request_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Execute, script_extern_marshal_),
   };
   Execute_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -139,14 +201,15 @@ void protobuf_AssignDesc_rpc_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(Execute));
-  Response_descriptor_ = file->message_type(2);
-  static const int Response_offsets_[6] = {
+  Response_descriptor_ = file->message_type(4);
+  static const int Response_offsets_[7] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, job_id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, std_out_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, std_err_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, error_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, rpc_result_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, job_status_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, request_id_),
   };
   Response_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -160,11 +223,30 @@ void protobuf_AssignDesc_rpc_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(Response));
   Response_JobStatus_descriptor_ = Response_descriptor_->enum_type(0);
-  MakeNamesRequest_descriptor_ = file->message_type(3);
-  static const int MakeNamesRequest_offsets_[3] = {
+  PackedNames_descriptor_ = file->message_type(5);
+  static const int PackedNames_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackedNames, ea_deltas_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackedNames, shared_sizes_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackedNames, suffix_sizes_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackedNames, suffixes_),
+  };
+  PackedNames_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      PackedNames_descriptor_,
+      PackedNames::default_instance_,
+      PackedNames_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackedNames, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PackedNames, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(PackedNames));
+  MakeNamesRequest_descriptor_ = file->message_type(6);
+  static const int MakeNamesRequest_offsets_[4] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MakeNamesRequest, names_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MakeNamesRequest, base_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MakeNamesRequest, remote_base_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MakeNamesRequest, packed_names_),
   };
   MakeNamesRequest_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -193,11 +275,12 @@ void protobuf_AssignDesc_rpc_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(MakeNamesRequest_Name));
-  MakeCommentsRequest_descriptor_ = file->message_type(4);
-  static const int MakeCommentsRequest_offsets_[3] = {
+  MakeCommentsRequest_descriptor_ = file->message_type(7);
+  static const int MakeCommentsRequest_offsets_[4] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MakeCommentsRequest, names_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MakeCommentsRequest, base_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MakeCommentsRequest, remote_base_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MakeCommentsRequest, packed_names_),
   };
   MakeCommentsRequest_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -226,7 +309,59 @@ void protobuf_AssignDesc_rpc_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(MakeCommentsRequest_Name));
-  GetMemoryMapResult_descriptor_ = file->message_type(5);
+  GetNamesRequest_descriptor_ = file->message_type(8);
+  static const int GetNamesRequest_offsets_[6] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesRequest, base_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesRequest, remote_base_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesRequest, start_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesRequest, end_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesRequest, labels_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesRequest, comments_),
+  };
+  GetNamesRequest_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      GetNamesRequest_descriptor_,
+      GetNamesRequest::default_instance_,
+      GetNamesRequest_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesRequest, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesRequest, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(GetNamesRequest));
+  GetNamesResult_descriptor_ = file->message_type(9);
+  static const int GetNamesResult_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesResult, names_),
+  };
+  GetNamesResult_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      GetNamesResult_descriptor_,
+      GetNamesResult::default_instance_,
+      GetNamesResult_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesResult, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesResult, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(GetNamesResult));
+  GetNamesResult_Name_descriptor_ = GetNamesResult_descriptor_->nested_type(0);
+  static const int GetNamesResult_Name_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesResult_Name, ea_delta_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesResult_Name, label_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesResult_Name, comment_),
+  };
+  GetNamesResult_Name_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      GetNamesResult_Name_descriptor_,
+      GetNamesResult_Name::default_instance_,
+      GetNamesResult_Name_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesResult_Name, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetNamesResult_Name, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(GetNamesResult_Name));
+  GetMemoryMapResult_descriptor_ = file->message_type(10);
   static const int GetMemoryMapResult_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetMemoryMapResult, memories_),
   };
@@ -259,9 +394,10 @@ void protobuf_AssignDesc_rpc_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(GetMemoryMapResult_Memory));
-  ReadMemoryRegionsRequest_descriptor_ = file->message_type(6);
-  static const int ReadMemoryRegionsRequest_offsets_[1] = {
+  ReadMemoryRegionsRequest_descriptor_ = file->message_type(11);
+  static const int ReadMemoryRegionsRequest_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadMemoryRegionsRequest, regions_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadMemoryRegionsRequest, chunk_size_),
   };
   ReadMemoryRegionsRequest_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -275,9 +411,10 @@ void protobuf_AssignDesc_rpc_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ReadMemoryRegionsRequest));
   ReadMemoryRegionsRequest_Region_descriptor_ = ReadMemoryRegionsRequest_descriptor_->nested_type(0);
-  static const int ReadMemoryRegionsRequest_Region_offsets_[2] = {
+  static const int ReadMemoryRegionsRequest_Region_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadMemoryRegionsRequest_Region, addr_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadMemoryRegionsRequest_Region, size_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadMemoryRegionsRequest_Region, page_hashes_),
   };
   ReadMemoryRegionsRequest_Region_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -290,7 +427,7 @@ void protobuf_AssignDesc_rpc_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ReadMemoryRegionsRequest_Region));
-  ReadMemoryRegionsResult_descriptor_ = file->message_type(7);
+  ReadMemoryRegionsResult_descriptor_ = file->message_type(12);
   static const int ReadMemoryRegionsResult_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadMemoryRegionsResult, memories_),
   };
@@ -306,11 +443,12 @@ void protobuf_AssignDesc_rpc_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ReadMemoryRegionsResult));
   ReadMemoryRegionsResult_Memory_descriptor_ = ReadMemoryRegionsResult_descriptor_->nested_type(0);
-  static const int ReadMemoryRegionsResult_Memory_offsets_[4] = {
+  static const int ReadMemoryRegionsResult_Memory_offsets_[5] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadMemoryRegionsResult_Memory, addr_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadMemoryRegionsResult_Memory, size_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadMemoryRegionsResult_Memory, mem_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadMemoryRegionsResult_Memory, protect_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadMemoryRegionsResult_Memory, unchanged_size_),
   };
   ReadMemoryRegionsResult_Memory_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -323,7 +461,42 @@ void protobuf_AssignDesc_rpc_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ReadMemoryRegionsResult_Memory));
-  AnalyzeExternalRefsRequest_descriptor_ = file->message_type(8);
+  OutputChunk_descriptor_ = file->message_type(13);
+  static const int OutputChunk_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OutputChunk, request_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OutputChunk, std_out_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OutputChunk, std_err_),
+  };
+  OutputChunk_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      OutputChunk_descriptor_,
+      OutputChunk::default_instance_,
+      OutputChunk_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OutputChunk, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OutputChunk, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(OutputChunk));
+  MemoryChunk_descriptor_ = file->message_type(14);
+  static const int MemoryChunk_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MemoryChunk, request_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MemoryChunk, region_index_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MemoryChunk, offset_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MemoryChunk, data_),
+  };
+  MemoryChunk_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      MemoryChunk_descriptor_,
+      MemoryChunk::default_instance_,
+      MemoryChunk_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MemoryChunk, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MemoryChunk, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(MemoryChunk));
+  AnalyzeExternalRefsRequest_descriptor_ = file->message_type(15);
   static const int AnalyzeExternalRefsRequest_offsets_[5] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AnalyzeExternalRefsRequest, ea_from_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AnalyzeExternalRefsRequest, ea_to_),
@@ -342,7 +515,7 @@ void protobuf_AssignDesc_rpc_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(AnalyzeExternalRefsRequest));
-  AnalyzeExternalRefsResult_descriptor_ = file->message_type(9);
+  AnalyzeExternalRefsResult_descriptor_ = file->message_type(16);
   static const int AnalyzeExternalRefsResult_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AnalyzeExternalRefsResult, api_constants_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AnalyzeExternalRefsResult, refs_),
@@ -423,7 +596,7 @@ void protobuf_AssignDesc_rpc_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(AnalyzeExternalRefsResult_reg_t));
-  CheckPEHeadersRequest_descriptor_ = file->message_type(10);
+  CheckPEHeadersRequest_descriptor_ = file->message_type(17);
   static const int CheckPEHeadersRequest_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CheckPEHeadersRequest, base_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CheckPEHeadersRequest, size_),
@@ -439,7 +612,7 @@ void protobuf_AssignDesc_rpc_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(CheckPEHeadersRequest));
-  CheckPEHeadersResult_descriptor_ = file->message_type(11);
+  CheckPEHeadersResult_descriptor_ = file->message_type(18);
   static const int CheckPEHeadersResult_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CheckPEHeadersResult, pe_valid_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CheckPEHeadersResult, exps_),
@@ -507,10 +680,16 @@ void protobuf_RegisterTypes(const ::std::string&) {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     RpcRequest_descriptor_, &RpcRequest::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Relocation_descriptor_, &Relocation::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Hello_descriptor_, &Hello::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     Execute_descriptor_, &Execute::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     Response_descriptor_, &Response::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    PackedNames_descriptor_, &PackedNames::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     MakeNamesRequest_descriptor_, &MakeNamesRequest::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -519,6 +698,12 @@ void protobuf_RegisterTypes(const ::std::string&) {
     MakeCommentsRequest_descriptor_, &MakeCommentsRequest::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     MakeCommentsRequest_Name_descriptor_, &MakeCommentsRequest_Name::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    GetNamesRequest_descriptor_, &GetNamesRequest::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    GetNamesResult_descriptor_, &GetNamesResult::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    GetNamesResult_Name_descriptor_, &GetNamesResult_Name::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     GetMemoryMapResult_descriptor_, &GetMemoryMapResult::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -531,6 +716,10 @@ void protobuf_RegisterTypes(const ::std::string&) {
     ReadMemoryRegionsResult_descriptor_, &ReadMemoryRegionsResult::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     ReadMemoryRegionsResult_Memory_descriptor_, &ReadMemoryRegionsResult_Memory::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    OutputChunk_descriptor_, &OutputChunk::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    MemoryChunk_descriptor_, &MemoryChunk::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     AnalyzeExternalRefsRequest_descriptor_, &AnalyzeExternalRefsRequest::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -556,10 +745,16 @@ void protobuf_RegisterTypes(const ::std::string&) {
 void protobuf_ShutdownFile_rpc_2eproto() {
   delete RpcRequest::default_instance_;
   delete RpcRequest_reflection_;
+  delete Relocation::default_instance_;
+  delete Relocation_reflection_;
+  delete Hello::default_instance_;
+  delete Hello_reflection_;
   delete Execute::default_instance_;
   delete Execute_reflection_;
   delete Response::default_instance_;
   delete Response_reflection_;
+  delete PackedNames::default_instance_;
+  delete PackedNames_reflection_;
   delete MakeNamesRequest::default_instance_;
   delete MakeNamesRequest_reflection_;
   delete MakeNamesRequest_Name::default_instance_;
@@ -568,6 +763,12 @@ void protobuf_ShutdownFile_rpc_2eproto() {
   delete MakeCommentsRequest_reflection_;
   delete MakeCommentsRequest_Name::default_instance_;
   delete MakeCommentsRequest_Name_reflection_;
+  delete GetNamesRequest::default_instance_;
+  delete GetNamesRequest_reflection_;
+  delete GetNamesResult::default_instance_;
+  delete GetNamesResult_reflection_;
+  delete GetNamesResult_Name::default_instance_;
+  delete GetNamesResult_Name_reflection_;
   delete GetMemoryMapResult::default_instance_;
   delete GetMemoryMapResult_reflection_;
   delete GetMemoryMapResult_Memory::default_instance_;
@@ -580,6 +781,10 @@ void protobuf_ShutdownFile_rpc_2eproto() {
   delete ReadMemoryRegionsResult_reflection_;
   delete ReadMemoryRegionsResult_Memory::default_instance_;
   delete ReadMemoryRegionsResult_Memory_reflection_;
+  delete OutputChunk::default_instance_;
+  delete OutputChunk_reflection_;
+  delete MemoryChunk::default_instance_;
+  delete MemoryChunk_reflection_;
   delete AnalyzeExternalRefsRequest::default_instance_;
   delete AnalyzeExternalRefsRequest_reflection_;
   delete AnalyzeExternalRefsResult::default_instance_;
@@ -607,7 +812,7 @@ void protobuf_AddDesc_rpc_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\trpc.proto\022\003rpc\"\242\004\n\nRpcRequest\0221\n\014reque"
+    "\n\trpc.proto\022\003rpc\"\343\004\n\nRpcRequest\0221\n\014reque"
     "st_type\030\001 \002(\0162\033.rpc.RpcRequest.RequestTy"
     "pe\022-\n\016make_names_req\030\002 \001(\0132\025.rpc.MakeNam"
     "esRequest\0223\n\021make_comments_req\030\003 \001(\0132\030.r"
@@ -616,81 +821,113 @@ void protobuf_AddDesc_rpc_2eproto() {
     "equest\022B\n\031analyze_external_refs_req\030\005 \001("
     "\0132\037.rpc.AnalyzeExternalRefsRequest\0228\n\024ch"
     "eck_pe_headers_req\030\006 \001(\0132\032.rpc.CheckPEHe"
-    "adersRequest\"\276\001\n\013RequestType\022\020\n\014RPCT_UNK"
-    "NOWN\020\000\022\023\n\017RPCT_MAKE_NAMES\020\001\022\026\n\022RPCT_MAKE"
-    "_COMMENTS\020\002\022\027\n\023RPCT_GET_MEMORY_MAP\020\003\022\034\n\030"
-    "RPCT_READ_MEMORY_REGIONS\020\004\022\036\n\032RPCT_ANALY"
-    "ZE_EXTERNAL_REFS\020\005\022\031\n\025RPCT_CHECK_PE_HEAD"
-    "ERS\020\006\"t\n\007Execute\022\016\n\006script\030\001 \001(\t\022\031\n\021scri"
-    "pt_extern_obj\030\002 \001(\t\022\023\n\013rpc_request\030\003 \001(\014"
-    "\022\031\n\nbackground\030\004 \001(\010:\005false\022\016\n\006job_id\030\005 "
-    "\001(\004\"\272\001\n\010Response\022\016\n\006job_id\030\001 \002(\004\022\017\n\007std_"
-    "out\030\002 \001(\t\022\017\n\007std_err\030\003 \001(\t\022\r\n\005error\030\004 \001("
-    "\t\022\022\n\nrpc_result\030\005 \001(\014\022+\n\njob_status\030\006 \001("
-    "\0162\027.rpc.Response.JobStatus\",\n\tJobStatus\022"
-    "\017\n\013JS_FINISHED\020\001\022\016\n\nJS_PENDING\020\002\"\202\001\n\020Mak"
-    "eNamesRequest\022)\n\005names\030\001 \003(\0132\032.rpc.MakeN"
-    "amesRequest.Name\022\014\n\004base\030\002 \002(\r\022\023\n\013remote"
-    "_base\030\003 \002(\r\032 \n\004Name\022\n\n\002ea\030\001 \002(\r\022\014\n\004name\030"
-    "\002 \002(\t\"\210\001\n\023MakeCommentsRequest\022,\n\005names\030\001"
-    " \003(\0132\035.rpc.MakeCommentsRequest.Name\022\014\n\004b"
-    "ase\030\002 \002(\r\022\023\n\013remote_base\030\003 \002(\r\032 \n\004Name\022\n"
-    "\n\002ea\030\001 \002(\r\022\014\n\004name\030\002 \002(\t\"\212\001\n\022GetMemoryMa"
-    "pResult\0220\n\010memories\030\001 \003(\0132\036.rpc.GetMemor"
-    "yMapResult.Memory\032B\n\006Memory\022\014\n\004base\030\001 \002("
-    "\r\022\014\n\004size\030\002 \002(\r\022\016\n\006access\030\003 \002(\r\022\014\n\004name\030"
-    "\004 \002(\t\"w\n\030ReadMemoryRegionsRequest\0225\n\007reg"
-    "ions\030\001 \003(\0132$.rpc.ReadMemoryRegionsReques"
-    "t.Region\032$\n\006Region\022\014\n\004addr\030\001 \002(\r\022\014\n\004size"
-    "\030\002 \002(\r\"\224\001\n\027ReadMemoryRegionsResult\0225\n\010me"
-    "mories\030\001 \003(\0132#.rpc.ReadMemoryRegionsResu"
-    "lt.Memory\032B\n\006Memory\022\014\n\004addr\030\001 \002(\r\022\014\n\004siz"
-    "e\030\002 \002(\r\022\013\n\003mem\030\003 \002(\014\022\017\n\007protect\030\004 \002(\r\"\177\n"
-    "\032AnalyzeExternalRefsRequest\022\017\n\007ea_from\030\001"
-    " \002(\r\022\r\n\005ea_to\030\002 \002(\r\022\021\n\tincrement\030\003 \002(\r\022\026"
-    "\n\016analysing_base\030\004 \002(\r\022\026\n\016analysing_size"
-    "\030\005 \002(\r\"\254\005\n\031AnalyzeExternalRefsResult\022A\n\r"
-    "api_constants\030\001 \003(\0132*.rpc.AnalyzeExterna"
-    "lRefsResult.PointerData\0224\n\004refs\030\002 \003(\0132&."
-    "rpc.AnalyzeExternalRefsResult.RefData\0225\n"
-    "\007context\030\003 \002(\0132$.rpc.AnalyzeExternalRefs"
-    "Result.reg_t\032[\n\013PointerData\022\n\n\002ea\030\001 \002(\r\022"
-    "\016\n\006module\030\002 \002(\t\022\014\n\004proc\030\003 \002(\t\022\"\n\032ordinal"
-    "_collision_dll_path\030\004 \001(\t\032\203\002\n\007RefData\022\n\n"
-    "\002ea\030\001 \002(\r\022\013\n\003len\030\002 \002(\r\022\013\n\003dis\030\003 \002(\t\022\t\n\001v"
-    "\030\004 \002(\r\022@\n\010ref_type\030\005 \002(\0162..rpc.AnalyzeEx"
-    "ternalRefsResult.RefData.RefType\022\016\n\006modu"
-    "le\030\006 \002(\t\022\014\n\004proc\030\007 \002(\t\022\"\n\032ordinal_collis"
-    "ion_dll_path\030\010 \001(\t\"C\n\007RefType\022\021\n\rREFT_JM"
-    "PCONST\020\001\022\021\n\rREFT_IMMCONST\020\002\022\022\n\016REFT_ADDR"
-    "CONST\020\003\032|\n\005reg_t\022\013\n\003eax\030\001 \002(\r\022\013\n\003ecx\030\002 \002"
-    "(\r\022\013\n\003edx\030\003 \002(\r\022\013\n\003ebx\030\004 \002(\r\022\013\n\003esp\030\005 \002("
-    "\r\022\013\n\003ebp\030\006 \002(\r\022\013\n\003esi\030\007 \002(\r\022\013\n\003edi\030\010 \002(\r"
-    "\022\013\n\003eip\030\t \002(\r\"3\n\025CheckPEHeadersRequest\022\014"
-    "\n\004base\030\001 \002(\r\022\014\n\004size\030\002 \002(\r\"\255\002\n\024CheckPEHe"
-    "adersResult\022\020\n\010pe_valid\030\001 \002(\010\022/\n\004exps\030\002 "
-    "\003(\0132!.rpc.CheckPEHeadersResult.Exports\0223"
-    "\n\010sections\030\003 \003(\0132!.rpc.CheckPEHeadersRes"
-    "ult.Section\0320\n\007Exports\022\n\n\002ea\030\001 \002(\r\022\013\n\003or"
-    "d\030\002 \002(\r\022\014\n\004name\030\003 \001(\t\032k\n\007Section\022\014\n\004name"
-    "\030\001 \001(\t\022\n\n\002va\030\002 \001(\r\022\016\n\006v_size\030\003 \001(\r\022\013\n\003ra"
-    "w\030\004 \001(\r\022\020\n\010raw_size\030\005 \001(\r\022\027\n\017characteris"
-    "tics\030\006 \001(\r", 2730);
+    "adersRequest\022+\n\rget_names_req\030\007 \001(\0132\024.rp"
+    "c.GetNamesRequest\"\322\001\n\013RequestType\022\020\n\014RPC"
+    "T_UNKNOWN\020\000\022\023\n\017RPCT_MAKE_NAMES\020\001\022\026\n\022RPCT"
+    "_MAKE_COMMENTS\020\002\022\027\n\023RPCT_GET_MEMORY_MAP\020"
+    "\003\022\034\n\030RPCT_READ_MEMORY_REGIONS\020\004\022\036\n\032RPCT_"
+    "ANALYZE_EXTERNAL_REFS\020\005\022\031\n\025RPCT_CHECK_PE"
+    "_HEADERS\020\006\022\022\n\016RPCT_GET_NAMES\020\007\">\n\nReloca"
+    "tion\022\r\n\005start\030\001 \002(\r\022\013\n\003end\030\002 \002(\r\022\024\n\014remo"
+    "te_start\030\003 \002(\r\"q\n\005Hello\022\030\n\020protocol_vers"
+    "ion\030\001 \002(\r\022\030\n\020labeless_version\030\002 \001(\t\022\016\n\006c"
+    "odecs\030\003 \001(\r\022$\n\013relocations\030\004 \003(\0132\017.rpc.R"
+    "elocation\"\247\001\n\007Execute\022\016\n\006script\030\001 \001(\t\022\031\n"
+    "\021script_extern_obj\030\002 \001(\t\022\023\n\013rpc_request\030"
+    "\003 \001(\014\022\031\n\nbackground\030\004 \001(\010:\005false\022\016\n\006job_"
+    "id\030\005 \001(\004\022\022\n\nrequest_id\030\006 \001(\004\022\035\n\025script_e"
+    "xtern_marshal\030\007 \001(\014\"\316\001\n\010Response\022\016\n\006job_"
+    "id\030\001 \002(\004\022\017\n\007std_out\030\002 \001(\t\022\017\n\007std_err\030\003 \001"
+    "(\t\022\r\n\005error\030\004 \001(\t\022\022\n\nrpc_result\030\005 \001(\014\022+\n"
+    "\njob_status\030\006 \001(\0162\027.rpc.Response.JobStat"
+    "us\022\022\n\nrequest_id\030\007 \001(\004\",\n\tJobStatus\022\017\n\013J"
+    "S_FINISHED\020\001\022\016\n\nJS_PENDING\020\002\"j\n\013PackedNa"
+    "mes\022\025\n\tea_deltas\030\001 \003(\rB\002\020\001\022\030\n\014shared_siz"
+    "es\030\002 \003(\rB\002\020\001\022\030\n\014suffix_sizes\030\003 \003(\rB\002\020\001\022\020"
+    "\n\010suffixes\030\004 \001(\014\"\252\001\n\020MakeNamesRequest\022)\n"
+    "\005names\030\001 \003(\0132\032.rpc.MakeNamesRequest.Name"
+    "\022\014\n\004base\030\002 \002(\r\022\023\n\013remote_base\030\003 \002(\r\022&\n\014p"
+    "acked_names\030\004 \001(\0132\020.rpc.PackedNames\032 \n\004N"
+    "ame\022\n\n\002ea\030\001 \002(\r\022\014\n\004name\030\002 \002(\t\"\260\001\n\023MakeCo"
+    "mmentsRequest\022,\n\005names\030\001 \003(\0132\035.rpc.MakeC"
+    "ommentsRequest.Name\022\014\n\004base\030\002 \002(\r\022\023\n\013rem"
+    "ote_base\030\003 \002(\r\022&\n\014packed_names\030\004 \001(\0132\020.r"
+    "pc.PackedNames\032 \n\004Name\022\n\n\002ea\030\001 \002(\r\022\014\n\004na"
+    "me\030\002 \002(\t\"~\n\017GetNamesRequest\022\014\n\004base\030\001 \002("
+    "\r\022\023\n\013remote_base\030\002 \002(\r\022\r\n\005start\030\003 \002(\r\022\013\n"
+    "\003end\030\004 \002(\r\022\024\n\006labels\030\005 \001(\010:\004true\022\026\n\010comm"
+    "ents\030\006 \001(\010:\004true\"s\n\016GetNamesResult\022\'\n\005na"
+    "mes\030\001 \003(\0132\030.rpc.GetNamesResult.Name\0328\n\004N"
+    "ame\022\020\n\010ea_delta\030\001 \002(\r\022\r\n\005label\030\002 \001(\t\022\017\n\007"
+    "comment\030\003 \001(\t\"\212\001\n\022GetMemoryMapResult\0220\n\010"
+    "memories\030\001 \003(\0132\036.rpc.GetMemoryMapResult."
+    "Memory\032B\n\006Memory\022\014\n\004base\030\001 \002(\r\022\014\n\004size\030\002"
+    " \002(\r\022\016\n\006access\030\003 \002(\r\022\014\n\004name\030\004 \002(\t\"\244\001\n\030R"
+    "eadMemoryRegionsRequest\0225\n\007regions\030\001 \003(\013"
+    "2$.rpc.ReadMemoryRegionsRequest.Region\022\022"
+    "\n\nchunk_size\030\002 \001(\r\032=\n\006Region\022\014\n\004addr\030\001 \002"
+    "(\r\022\014\n\004size\030\002 \002(\r\022\027\n\013page_hashes\030\003 \003(\006B\002\020"
+    "\001\"\254\001\n\027ReadMemoryRegionsResult\0225\n\010memorie"
+    "s\030\001 \003(\0132#.rpc.ReadMemoryRegionsResult.Me"
+    "mory\032Z\n\006Memory\022\014\n\004addr\030\001 \002(\r\022\014\n\004size\030\002 \002"
+    "(\r\022\013\n\003mem\030\003 \002(\014\022\017\n\007protect\030\004 \002(\r\022\026\n\016unch"
+    "anged_size\030\005 \001(\r\"C\n\013OutputChunk\022\022\n\nreque"
+    "st_id\030\001 \001(\004\022\017\n\007std_out\030\002 \001(\t\022\017\n\007std_err\030"
+    "\003 \001(\t\"U\n\013MemoryChunk\022\022\n\nrequest_id\030\001 \001(\004"
+    "\022\024\n\014region_index\030\002 \002(\r\022\016\n\006offset\030\003 \002(\r\022\014"
+    "\n\004data\030\004 \002(\014\"\177\n\032AnalyzeExternalRefsReque"
+    "st\022\017\n\007ea_from\030\001 \002(\r\022\r\n\005ea_to\030\002 \002(\r\022\021\n\tin"
+    "crement\030\003 \002(\r\022\026\n\016analysing_base\030\004 \002(\r\022\026\n"
+    "\016analysing_size\030\005 \002(\r\"\254\005\n\031AnalyzeExterna"
+    "lRefsResult\022A\n\rapi_constants\030\001 \003(\0132*.rpc"
+    ".AnalyzeExternalRefsResult.PointerData\0224"
+    "\n\004refs\030\002 \003(\0132&.rpc.AnalyzeExternalRefsRe"
+    "sult.RefData\0225\n\007context\030\003 \002(\0132$.rpc.Anal"
+    "yzeExternalRefsResult.reg_t\032[\n\013PointerDa"
+    "ta\022\n\n\002ea\030\001 \002(\r\022\016\n\006module\030\002 \002(\t\022\014\n\004proc\030\003"
+    " \002(\t\022\"\n\032ordinal_collision_dll_path\030\004 \001(\t"
+    "\032\203\002\n\007RefData\022\n\n\002ea\030\001 \002(\r\022\013\n\003len\030\002 \002(\r\022\013\n"
+    "\003dis\030\003 \002(\t\022\t\n\001v\030\004 \002(\r\022@\n\010ref_type\030\005 \002(\0162"
+    "..rpc.AnalyzeExternalRefsResult.RefData."
+    "RefType\022\016\n\006module\030\006 \002(\t\022\014\n\004proc\030\007 \002(\t\022\"\n"
+    "\032ordinal_collision_dll_path\030\010 \001(\t\"C\n\007Ref"
+    "Type\022\021\n\rREFT_JMPCONST\020\001\022\021\n\rREFT_IMMCONST"
+    "\020\002\022\022\n\016REFT_ADDRCONST\020\003\032|\n\005reg_t\022\013\n\003eax\030\001"
+    " \002(\r\022\013\n\003ecx\030\002 \002(\r\022\013\n\003edx\030\003 \002(\r\022\013\n\003ebx\030\004 "
+    "\002(\r\022\013\n\003esp\030\005 \002(\r\022\013\n\003ebp\030\006 \002(\r\022\013\n\003esi\030\007 \002"
+    "(\r\022\013\n\003edi\030\010 \002(\r\022\013\n\003eip\030\t \002(\r\"3\n\025CheckPEH"
+    "eadersRequest\022\014\n\004base\030\001 \002(\r\022\014\n\004size\030\002 \002("
+    "\r\"\255\002\n\024CheckPEHeadersResult\022\020\n\010pe_valid\030\001"
+    " \002(\010\022/\n\004exps\030\002 \003(\0132!.rpc.CheckPEHeadersR"
+    "esult.Exports\0223\n\010sections\030\003 \003(\0132!.rpc.Ch"
+    "eckPEHeadersResult.Section\0320\n\007Exports\022\n\n"
+    "\002ea\030\001 \002(\r\022\013\n\003ord\030\002 \002(\r\022\014\n\004name\030\003 \001(\t\032k\n\007"
+    "Section\022\014\n\004name\030\001 \001(\t\022\n\n\002va\030\002 \001(\r\022\016\n\006v_s"
+    "ize\030\003 \001(\r\022\013\n\003raw\030\004 \001(\r\022\020\n\010raw_size\030\005 \001(\r"
+    "\022\027\n\017characteristics\030\006 \001(\r", 3705);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "rpc.proto", &protobuf_RegisterTypes);
   RpcRequest::default_instance_ = new RpcRequest();
+  Relocation::default_instance_ = new Relocation();
+  Hello::default_instance_ = new Hello();
   Execute::default_instance_ = new Execute();
   Response::default_instance_ = new Response();
+  PackedNames::default_instance_ = new PackedNames();
   MakeNamesRequest::default_instance_ = new MakeNamesRequest();
   MakeNamesRequest_Name::default_instance_ = new MakeNamesRequest_Name();
   MakeCommentsRequest::default_instance_ = new MakeCommentsRequest();
   MakeCommentsRequest_Name::default_instance_ = new MakeCommentsRequest_Name();
+  GetNamesRequest::default_instance_ = new GetNamesRequest();
+  GetNamesResult::default_instance_ = new GetNamesResult();
+  GetNamesResult_Name::default_instance_ = new GetNamesResult_Name();
   GetMemoryMapResult::default_instance_ = new GetMemoryMapResult();
   GetMemoryMapResult_Memory::default_instance_ = new GetMemoryMapResult_Memory();
   ReadMemoryRegionsRequest::default_instance_ = new ReadMemoryRegionsRequest();
   ReadMemoryRegionsRequest_Region::default_instance_ = new ReadMemoryRegionsRequest_Region();
   ReadMemoryRegionsResult::default_instance_ = new ReadMemoryRegionsResult();
   ReadMemoryRegionsResult_Memory::default_instance_ = new ReadMemoryRegionsResult_Memory();
+  OutputChunk::default_instance_ = new OutputChunk();
+  MemoryChunk::default_instance_ = new MemoryChunk();
   AnalyzeExternalRefsRequest::default_instance_ = new AnalyzeExternalRefsRequest();
   AnalyzeExternalRefsResult::default_instance_ = new AnalyzeExternalRefsResult();
   AnalyzeExternalRefsResult_PointerData::default_instance_ = new AnalyzeExternalRefsResult_PointerData();
@@ -701,18 +938,26 @@ void protobuf_AddDesc_rpc_2eproto() {
   CheckPEHeadersResult_Exports::default_instance_ = new CheckPEHeadersResult_Exports();
   CheckPEHeadersResult_Section::default_instance_ = new CheckPEHeadersResult_Section();
   RpcRequest::default_instance_->InitAsDefaultInstance();
+  Relocation::default_instance_->InitAsDefaultInstance();
+  Hello::default_instance_->InitAsDefaultInstance();
   Execute::default_instance_->InitAsDefaultInstance();
   Response::default_instance_->InitAsDefaultInstance();
+  PackedNames::default_instance_->InitAsDefaultInstance();
   MakeNamesRequest::default_instance_->InitAsDefaultInstance();
   MakeNamesRequest_Name::default_instance_->InitAsDefaultInstance();
   MakeCommentsRequest::default_instance_->InitAsDefaultInstance();
   MakeCommentsRequest_Name::default_instance_->InitAsDefaultInstance();
+  GetNamesRequest::default_instance_->InitAsDefaultInstance();
+  GetNamesResult::default_instance_->InitAsDefaultInstance();
+  GetNamesResult_Name::default_instance_->InitAsDefaultInstance();
   GetMemoryMapResult::default_instance_->InitAsDefaultInstance();
   GetMemoryMapResult_Memory::default_instance_->InitAsDefaultInstance();
   ReadMemoryRegionsRequest::default_instance_->InitAsDefaultInstance();
   ReadMemoryRegionsRequest_Region::default_instance_->InitAsDefaultInstance();
   ReadMemoryRegionsResult::default_instance_->InitAsDefaultInstance();
   ReadMemoryRegionsResult_Memory::default_instance_->InitAsDefaultInstance();
+  OutputChunk::default_instance_->InitAsDefaultInstance();
+  MemoryChunk::default_instance_->InitAsDefaultInstance();
   AnalyzeExternalRefsRequest::default_instance_->InitAsDefaultInstance();
   AnalyzeExternalRefsResult::default_instance_->InitAsDefaultInstance();
   AnalyzeExternalRefsResult_PointerData::default_instance_->InitAsDefaultInstance();
@@ -747,6 +992,7 @@ bool RpcRequest_RequestType_IsValid(int value) {
     case 4:
     case 5:
     case 6:
+    case 7:
       return true;
     default:
       return false;
@@ -761,6 +1007,7 @@ const RpcRequest_RequestType RpcRequest::RPCT_GET_MEMORY_MAP;
 const RpcRequest_RequestType RpcRequest::RPCT_READ_MEMORY_REGIONS;
 const RpcRequest_RequestType RpcRequest::RPCT_ANALYZE_EXTERNAL_REFS;
 const RpcRequest_RequestType RpcRequest::RPCT_CHECK_PE_HEADERS;
+const RpcRequest_RequestType RpcRequest::RPCT_GET_NAMES;
 const RpcRequest_RequestType RpcRequest::RequestType_MIN;
 const RpcRequest_RequestType RpcRequest::RequestType_MAX;
 const int RpcRequest::RequestType_ARRAYSIZE;
@@ -772,6 +1019,7 @@ const int RpcRequest::kMakeCommentsReqFieldNumber;
 const int RpcRequest::kReadMemoryRegionsReqFieldNumber;
 const int RpcRequest::kAnalyzeExternalRefsReqFieldNumber;
 const int RpcRequest::kCheckPeHeadersReqFieldNumber;
+const int RpcRequest::kGetNamesReqFieldNumber;
 #endif  // !_MSC_VER
 
 RpcRequest::RpcRequest()
@@ -786,6 +1034,7 @@ void RpcRequest::InitAsDefaultInstance() {
   read_memory_regions_req_ = const_cast< ::rpc::ReadMemoryRegionsRequest*>(&::rpc::ReadMemoryRegionsRequest::default_instance());
   analyze_external_refs_req_ = const_cast< ::rpc::AnalyzeExternalRefsRequest*>(&::rpc::AnalyzeExternalRefsRequest::default_instance());
   check_pe_headers_req_ = const_cast< ::rpc::CheckPEHeadersRequest*>(&::rpc::CheckPEHeadersRequest::default_instance());
+  get_names_req_ = const_cast< ::rpc::GetNamesRequest*>(&::rpc::GetNamesRequest::default_instance());
 }
 
 RpcRequest::RpcRequest(const RpcRequest& from)
@@ -803,6 +1052,7 @@ void RpcRequest::SharedCtor() {
   read_memory_regions_req_ = NULL;
   analyze_external_refs_req_ = NULL;
   check_pe_headers_req_ = NULL;
+  get_names_req_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -818,6 +1068,7 @@ void RpcRequest::SharedDtor() {
     delete read_memory_regions_req_;
     delete analyze_external_refs_req_;
     delete check_pe_headers_req_;
+    delete get_names_req_;
   }
 }
 
@@ -843,7 +1094,7 @@ RpcRequest* RpcRequest::New() const {
 }
 
 void RpcRequest::Clear() {
-  if (_has_bits_[0 / 32] & 63) {
+  if (_has_bits_[0 / 32] & 127) {
     request_type_ = 0;
     if (has_make_names_req()) {
       if (make_names_req_ != NULL) make_names_req_->::rpc::MakeNamesRequest::Clear();
@@ -860,6 +1111,9 @@ void RpcRequest::Clear() {
     if (has_check_pe_headers_req()) {
       if (check_pe_headers_req_ != NULL) check_pe_headers_req_->::rpc::CheckPEHeadersRequest::Clear();
     }
+    if (has_get_names_req()) {
+      if (get_names_req_ != NULL) get_names_req_->::rpc::GetNamesRequest::Clear();
+    }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -955,6 +1209,19 @@ bool RpcRequest::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(58)) goto parse_get_names_req;
+        break;
+      }
+
+      // optional .rpc.GetNamesRequest get_names_req = 7;
+      case 7: {
+        if (tag == 58) {
+         parse_get_names_req:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_get_names_req()));
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -1020,6 +1287,12 @@ void RpcRequest::SerializeWithCachedSizes(
       6, this->check_pe_headers_req(), output);
   }
 
+  // optional .rpc.GetNamesRequest get_names_req = 7;
+  if (has_get_names_req()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, this->get_names_req(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -1071,6 +1344,13 @@ void RpcRequest::SerializeWithCachedSizes(
         6, this->check_pe_headers_req(), target);
   }
 
+  // optional .rpc.GetNamesRequest get_names_req = 7;
+  if (has_get_names_req()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        7, this->get_names_req(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -1124,6 +1404,13 @@ int RpcRequest::ByteSize() const {
           this->check_pe_headers_req());
     }
 
+    // optional .rpc.GetNamesRequest get_names_req = 7;
+    if (has_get_names_req()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->get_names_req());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -1169,6 +1456,9 @@ void RpcRequest::MergeFrom(const RpcRequest& from) {
     if (from.has_check_pe_headers_req()) {
       mutable_check_pe_headers_req()->::rpc::CheckPEHeadersRequest::MergeFrom(from.check_pe_headers_req());
     }
+    if (from.has_get_names_req()) {
+      mutable_get_names_req()->::rpc::GetNamesRequest::MergeFrom(from.get_names_req());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -1203,6 +1493,9 @@ bool RpcRequest::IsInitialized() const {
   if (has_check_pe_headers_req()) {
     if (!this->check_pe_headers_req().IsInitialized()) return false;
   }
+  if (has_get_names_req()) {
+    if (!this->get_names_req().IsInitialized()) return false;
+  }
   return true;
 }
 
@@ -1214,6 +1507,7 @@ void RpcRequest::Swap(RpcRequest* other) {
     std::swap(read_memory_regions_req_, other->read_memory_regions_req_);
     std::swap(analyze_external_refs_req_, other->analyze_external_refs_req_);
     std::swap(check_pe_headers_req_, other->check_pe_headers_req_);
+    std::swap(get_names_req_, other->get_names_req_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -1232,83 +1526,69 @@ void RpcRequest::Swap(RpcRequest* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int Execute::kScriptFieldNumber;
-const int Execute::kScriptExternObjFieldNumber;
-const int Execute::kRpcRequestFieldNumber;
-const int Execute::kBackgroundFieldNumber;
-const int Execute::kJobIdFieldNumber;
+const int Relocation::kStartFieldNumber;
+const int Relocation::kEndFieldNumber;
+const int Relocation::kRemoteStartFieldNumber;
 #endif  // !_MSC_VER
 
-Execute::Execute()
+Relocation::Relocation()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:rpc.Execute)
+  // @@protoc_insertion_point(constructor:rpc.Relocation)
 }
 
-void Execute::InitAsDefaultInstance() {
+void Relocation::InitAsDefaultInstance() {
 }
 
-Execute::Execute(const Execute& from)
+Relocation::Relocation(const Relocation& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:rpc.Execute)
+  // @@protoc_insertion_point(copy_constructor:rpc.Relocation)
 }
 
-void Execute::SharedCtor() {
-  ::google::protobuf::internal::GetEmptyString();
+void Relocation::SharedCtor() {
   _cached_size_ = 0;
-  script_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  script_extern_obj_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  rpc_request_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  background_ = false;
-  job_id_ = GOOGLE_ULONGLONG(0);
+  start_ = 0u;
+  end_ = 0u;
+  remote_start_ = 0u;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Execute::~Execute() {
-  // @@protoc_insertion_point(destructor:rpc.Execute)
+Relocation::~Relocation() {
+  // @@protoc_insertion_point(destructor:rpc.Relocation)
   SharedDtor();
 }
 
-void Execute::SharedDtor() {
-  if (script_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete script_;
-  }
-  if (script_extern_obj_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete script_extern_obj_;
-  }
-  if (rpc_request_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete rpc_request_;
-  }
+void Relocation::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void Execute::SetCachedSize(int size) const {
+void Relocation::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Execute::descriptor() {
+const ::google::protobuf::Descriptor* Relocation::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Execute_descriptor_;
+  return Relocation_descriptor_;
 }
 
-const Execute& Execute::default_instance() {
+const Relocation& Relocation::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
   return *default_instance_;
 }
 
-Execute* Execute::default_instance_ = NULL;
+Relocation* Relocation::default_instance_ = NULL;
 
-Execute* Execute::New() const {
-  return new Execute;
+Relocation* Relocation::New() const {
+  return new Relocation;
 }
 
-void Execute::Clear() {
+void Relocation::Clear() {
 #define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
-  &reinterpret_cast<Execute*>(16)->f) - \
+  &reinterpret_cast<Relocation*>(16)->f) - \
    reinterpret_cast<char*>(16))
 
 #define ZR_(first, last) do {                              \
@@ -1317,24 +1597,7 @@ void Execute::Clear() {
     ::memset(&first, 0, n);                                \
   } while (0)
 
-  if (_has_bits_[0 / 32] & 31) {
-    ZR_(job_id_, background_);
-    if (has_script()) {
-      if (script_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        script_->clear();
-      }
-    }
-    if (has_script_extern_obj()) {
-      if (script_extern_obj_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        script_extern_obj_->clear();
-      }
-    }
-    if (has_rpc_request()) {
-      if (rpc_request_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        rpc_request_->clear();
-      }
-    }
-  }
+  ZR_(start_, remote_start_);
 
 #undef OFFSET_OF_FIELD_
 #undef ZR_
@@ -1343,85 +1606,53 @@ void Execute::Clear() {
   mutable_unknown_fields()->Clear();
 }
 
-bool Execute::MergePartialFromCodedStream(
+bool Relocation::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:rpc.Execute)
+  // @@protoc_insertion_point(parse_start:rpc.Relocation)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string script = 1;
+      // required uint32 start = 1;
       case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_script()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->script().data(), this->script().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "script");
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &start_)));
+          set_has_start();
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(18)) goto parse_script_extern_obj;
+        if (input->ExpectTag(16)) goto parse_end;
         break;
       }
 
-      // optional string script_extern_obj = 2;
+      // required uint32 end = 2;
       case 2: {
-        if (tag == 18) {
-         parse_script_extern_obj:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_script_extern_obj()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->script_extern_obj().data(), this->script_extern_obj().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "script_extern_obj");
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(26)) goto parse_rpc_request;
-        break;
-      }
-
-      // optional bytes rpc_request = 3;
-      case 3: {
-        if (tag == 26) {
-         parse_rpc_request:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_rpc_request()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(32)) goto parse_background;
-        break;
-      }
-
-      // optional bool background = 4 [default = false];
-      case 4: {
-        if (tag == 32) {
-         parse_background:
+        if (tag == 16) {
+         parse_end:
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &background_)));
-          set_has_background();
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &end_)));
+          set_has_end();
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(40)) goto parse_job_id;
+        if (input->ExpectTag(24)) goto parse_remote_start;
         break;
       }
 
-      // optional uint64 job_id = 5;
-      case 5: {
-        if (tag == 40) {
-         parse_job_id:
+      // required uint32 remote_start = 3;
+      case 3: {
+        if (tag == 24) {
+         parse_remote_start:
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &job_id_)));
-          set_has_job_id();
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &remote_start_)));
+          set_has_remote_start();
         } else {
           goto handle_unusual;
         }
@@ -1443,145 +1674,88 @@ bool Execute::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:rpc.Execute)
+  // @@protoc_insertion_point(parse_success:rpc.Relocation)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:rpc.Execute)
+  // @@protoc_insertion_point(parse_failure:rpc.Relocation)
   return false;
 #undef DO_
 }
 
-void Execute::SerializeWithCachedSizes(
+void Relocation::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:rpc.Execute)
-  // optional string script = 1;
-  if (has_script()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->script().data(), this->script().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "script");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->script(), output);
-  }
-
-  // optional string script_extern_obj = 2;
-  if (has_script_extern_obj()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->script_extern_obj().data(), this->script_extern_obj().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "script_extern_obj");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->script_extern_obj(), output);
-  }
-
-  // optional bytes rpc_request = 3;
-  if (has_rpc_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      3, this->rpc_request(), output);
+  // @@protoc_insertion_point(serialize_start:rpc.Relocation)
+  // required uint32 start = 1;
+  if (has_start()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->start(), output);
   }
 
-  // optional bool background = 4 [default = false];
-  if (has_background()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->background(), output);
+  // required uint32 end = 2;
+  if (has_end()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->end(), output);
   }
 
-  // optional uint64 job_id = 5;
-  if (has_job_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->job_id(), output);
+  // required uint32 remote_start = 3;
+  if (has_remote_start()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->remote_start(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:rpc.Execute)
+  // @@protoc_insertion_point(serialize_end:rpc.Relocation)
 }
 
-::google::protobuf::uint8* Execute::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Relocation::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rpc.Execute)
-  // optional string script = 1;
-  if (has_script()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->script().data(), this->script().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "script");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->script(), target);
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.Relocation)
+  // required uint32 start = 1;
+  if (has_start()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->start(), target);
   }
 
-  // optional string script_extern_obj = 2;
-  if (has_script_extern_obj()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->script_extern_obj().data(), this->script_extern_obj().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "script_extern_obj");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->script_extern_obj(), target);
+  // required uint32 end = 2;
+  if (has_end()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->end(), target);
   }
 
-  // optional bytes rpc_request = 3;
-  if (has_rpc_request()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        3, this->rpc_request(), target);
-  }
-
-  // optional bool background = 4 [default = false];
-  if (has_background()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->background(), target);
-  }
-
-  // optional uint64 job_id = 5;
-  if (has_job_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->job_id(), target);
+  // required uint32 remote_start = 3;
+  if (has_remote_start()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->remote_start(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rpc.Execute)
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.Relocation)
   return target;
 }
 
-int Execute::ByteSize() const {
+int Relocation::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string script = 1;
-    if (has_script()) {
+    // required uint32 start = 1;
+    if (has_start()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->script());
-    }
-
-    // optional string script_extern_obj = 2;
-    if (has_script_extern_obj()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->script_extern_obj());
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->start());
     }
 
-    // optional bytes rpc_request = 3;
-    if (has_rpc_request()) {
+    // required uint32 end = 2;
+    if (has_end()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->rpc_request());
-    }
-
-    // optional bool background = 4 [default = false];
-    if (has_background()) {
-      total_size += 1 + 1;
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->end());
     }
 
-    // optional uint64 job_id = 5;
-    if (has_job_id()) {
+    // required uint32 remote_start = 3;
+    if (has_remote_start()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->job_id());
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->remote_start());
     }
 
   }
@@ -1596,10 +1770,10 @@ int Execute::ByteSize() const {
   return total_size;
 }
 
-void Execute::MergeFrom(const ::google::protobuf::Message& from) {
+void Relocation::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Execute* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Execute*>(
+  const Relocation* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Relocation*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -1608,303 +1782,222 @@ void Execute::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void Execute::MergeFrom(const Execute& from) {
+void Relocation::MergeFrom(const Relocation& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_script()) {
-      set_script(from.script());
-    }
-    if (from.has_script_extern_obj()) {
-      set_script_extern_obj(from.script_extern_obj());
-    }
-    if (from.has_rpc_request()) {
-      set_rpc_request(from.rpc_request());
+    if (from.has_start()) {
+      set_start(from.start());
     }
-    if (from.has_background()) {
-      set_background(from.background());
+    if (from.has_end()) {
+      set_end(from.end());
     }
-    if (from.has_job_id()) {
-      set_job_id(from.job_id());
+    if (from.has_remote_start()) {
+      set_remote_start(from.remote_start());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Execute::CopyFrom(const ::google::protobuf::Message& from) {
+void Relocation::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Execute::CopyFrom(const Execute& from) {
+void Relocation::CopyFrom(const Relocation& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Execute::IsInitialized() const {
+bool Relocation::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
 
   return true;
 }
 
-void Execute::Swap(Execute* other) {
+void Relocation::Swap(Relocation* other) {
   if (other != this) {
-    std::swap(script_, other->script_);
-    std::swap(script_extern_obj_, other->script_extern_obj_);
-    std::swap(rpc_request_, other->rpc_request_);
-    std::swap(background_, other->background_);
-    std::swap(job_id_, other->job_id_);
+    std::swap(start_, other->start_);
+    std::swap(end_, other->end_);
+    std::swap(remote_start_, other->remote_start_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Execute::GetMetadata() const {
+::google::protobuf::Metadata Relocation::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Execute_descriptor_;
-  metadata.reflection = Execute_reflection_;
+  metadata.descriptor = Relocation_descriptor_;
+  metadata.reflection = Relocation_reflection_;
   return metadata;
 }
 
 
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* Response_JobStatus_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Response_JobStatus_descriptor_;
-}
-bool Response_JobStatus_IsValid(int value) {
-  switch(value) {
-    case 1:
-    case 2:
-      return true;
-    default:
-      return false;
-  }
-}
-
-#ifndef _MSC_VER
-const Response_JobStatus Response::JS_FINISHED;
-const Response_JobStatus Response::JS_PENDING;
-const Response_JobStatus Response::JobStatus_MIN;
-const Response_JobStatus Response::JobStatus_MAX;
-const int Response::JobStatus_ARRAYSIZE;
-#endif  // _MSC_VER
 #ifndef _MSC_VER
-const int Response::kJobIdFieldNumber;
-const int Response::kStdOutFieldNumber;
-const int Response::kStdErrFieldNumber;
-const int Response::kErrorFieldNumber;
-const int Response::kRpcResultFieldNumber;
-const int Response::kJobStatusFieldNumber;
+const int Hello::kProtocolVersionFieldNumber;
+const int Hello::kLabelessVersionFieldNumber;
+const int Hello::kCodecsFieldNumber;
+const int Hello::kRelocationsFieldNumber;
 #endif  // !_MSC_VER
 
-Response::Response()
+Hello::Hello()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:rpc.Response)
+  // @@protoc_insertion_point(constructor:rpc.Hello)
 }
 
-void Response::InitAsDefaultInstance() {
+void Hello::InitAsDefaultInstance() {
 }
 
-Response::Response(const Response& from)
+Hello::Hello(const Hello& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:rpc.Response)
+  // @@protoc_insertion_point(copy_constructor:rpc.Hello)
 }
 
-void Response::SharedCtor() {
+void Hello::SharedCtor() {
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
-  job_id_ = GOOGLE_ULONGLONG(0);
-  std_out_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  std_err_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  error_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  rpc_result_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  job_status_ = 1;
+  protocol_version_ = 0u;
+  labeless_version_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  codecs_ = 0u;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Response::~Response() {
-  // @@protoc_insertion_point(destructor:rpc.Response)
+Hello::~Hello() {
+  // @@protoc_insertion_point(destructor:rpc.Hello)
   SharedDtor();
 }
 
-void Response::SharedDtor() {
-  if (std_out_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete std_out_;
-  }
-  if (std_err_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete std_err_;
-  }
-  if (error_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete error_;
-  }
-  if (rpc_result_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete rpc_result_;
+void Hello::SharedDtor() {
+  if (labeless_version_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete labeless_version_;
   }
   if (this != default_instance_) {
   }
 }
 
-void Response::SetCachedSize(int size) const {
+void Hello::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Response::descriptor() {
+const ::google::protobuf::Descriptor* Hello::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Response_descriptor_;
+  return Hello_descriptor_;
 }
 
-const Response& Response::default_instance() {
+const Hello& Hello::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
   return *default_instance_;
 }
 
-Response* Response::default_instance_ = NULL;
+Hello* Hello::default_instance_ = NULL;
 
-Response* Response::New() const {
-  return new Response;
+Hello* Hello::New() const {
+  return new Hello;
 }
 
-void Response::Clear() {
-  if (_has_bits_[0 / 32] & 63) {
-    job_id_ = GOOGLE_ULONGLONG(0);
-    if (has_std_out()) {
-      if (std_out_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        std_out_->clear();
-      }
-    }
-    if (has_std_err()) {
-      if (std_err_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        std_err_->clear();
-      }
-    }
-    if (has_error()) {
-      if (error_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        error_->clear();
-      }
-    }
-    if (has_rpc_result()) {
-      if (rpc_result_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        rpc_result_->clear();
+void Hello::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<Hello*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  if (_has_bits_[0 / 32] & 7) {
+    ZR_(protocol_version_, codecs_);
+    if (has_labeless_version()) {
+      if (labeless_version_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        labeless_version_->clear();
       }
     }
-    job_status_ = 1;
   }
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
+  relocations_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Response::MergePartialFromCodedStream(
+bool Hello::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:rpc.Response)
+  // @@protoc_insertion_point(parse_start:rpc.Hello)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required uint64 job_id = 1;
+      // required uint32 protocol_version = 1;
       case 1: {
         if (tag == 8) {
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &job_id_)));
-          set_has_job_id();
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &protocol_version_)));
+          set_has_protocol_version();
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(18)) goto parse_std_out;
+        if (input->ExpectTag(18)) goto parse_labeless_version;
         break;
       }
 
-      // optional string std_out = 2;
+      // optional string labeless_version = 2;
       case 2: {
         if (tag == 18) {
-         parse_std_out:
+         parse_labeless_version:
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_std_out()));
+                input, this->mutable_labeless_version()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->std_out().data(), this->std_out().length(),
+            this->labeless_version().data(), this->labeless_version().length(),
             ::google::protobuf::internal::WireFormat::PARSE,
-            "std_out");
+            "labeless_version");
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(26)) goto parse_std_err;
+        if (input->ExpectTag(24)) goto parse_codecs;
         break;
       }
 
-      // optional string std_err = 3;
+      // optional uint32 codecs = 3;
       case 3: {
-        if (tag == 26) {
-         parse_std_err:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_std_err()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->std_err().data(), this->std_err().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "std_err");
+        if (tag == 24) {
+         parse_codecs:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &codecs_)));
+          set_has_codecs();
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(34)) goto parse_error;
+        if (input->ExpectTag(34)) goto parse_relocations;
         break;
       }
 
-      // optional string error = 4;
+      // repeated .rpc.Relocation relocations = 4;
       case 4: {
         if (tag == 34) {
-         parse_error:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_error()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->error().data(), this->error().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "error");
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(42)) goto parse_rpc_result;
-        break;
-      }
-
-      // optional bytes rpc_result = 5;
-      case 5: {
-        if (tag == 42) {
-         parse_rpc_result:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_rpc_result()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(48)) goto parse_job_status;
-        break;
-      }
-
-      // optional .rpc.Response.JobStatus job_status = 6;
-      case 6: {
-        if (tag == 48) {
-         parse_job_status:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::rpc::Response_JobStatus_IsValid(value)) {
-            set_job_status(static_cast< ::rpc::Response_JobStatus >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(6, value);
-          }
+         parse_relocations:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_relocations()));
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(34)) goto parse_relocations;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -1923,176 +2016,3333 @@ bool Response::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:rpc.Response)
+  // @@protoc_insertion_point(parse_success:rpc.Hello)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:rpc.Response)
+  // @@protoc_insertion_point(parse_failure:rpc.Hello)
   return false;
 #undef DO_
 }
 
-void Response::SerializeWithCachedSizes(
+void Hello::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:rpc.Response)
-  // required uint64 job_id = 1;
-  if (has_job_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->job_id(), output);
+  // @@protoc_insertion_point(serialize_start:rpc.Hello)
+  // required uint32 protocol_version = 1;
+  if (has_protocol_version()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->protocol_version(), output);
   }
 
-  // optional string std_out = 2;
-  if (has_std_out()) {
+  // optional string labeless_version = 2;
+  if (has_labeless_version()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->std_out().data(), this->std_out().length(),
+      this->labeless_version().data(), this->labeless_version().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "std_out");
+      "labeless_version");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->std_out(), output);
+      2, this->labeless_version(), output);
   }
 
-  // optional string std_err = 3;
-  if (has_std_err()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->std_err().data(), this->std_err().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "std_err");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->std_err(), output);
+  // optional uint32 codecs = 3;
+  if (has_codecs()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->codecs(), output);
   }
 
-  // optional string error = 4;
-  if (has_error()) {
+  // repeated .rpc.Relocation relocations = 4;
+  for (int i = 0; i < this->relocations_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->relocations(i), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:rpc.Hello)
+}
+
+::google::protobuf::uint8* Hello::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.Hello)
+  // required uint32 protocol_version = 1;
+  if (has_protocol_version()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->protocol_version(), target);
+  }
+
+  // optional string labeless_version = 2;
+  if (has_labeless_version()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->error().data(), this->error().length(),
+      this->labeless_version().data(), this->labeless_version().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "error");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      4, this->error(), output);
+      "labeless_version");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->labeless_version(), target);
+  }
+
+  // optional uint32 codecs = 3;
+  if (has_codecs()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->codecs(), target);
+  }
+
+  // repeated .rpc.Relocation relocations = 4;
+  for (int i = 0; i < this->relocations_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        4, this->relocations(i), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.Hello)
+  return target;
+}
+
+int Hello::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint32 protocol_version = 1;
+    if (has_protocol_version()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->protocol_version());
+    }
+
+    // optional string labeless_version = 2;
+    if (has_labeless_version()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->labeless_version());
+    }
+
+    // optional uint32 codecs = 3;
+    if (has_codecs()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->codecs());
+    }
+
+  }
+  // repeated .rpc.Relocation relocations = 4;
+  total_size += 1 * this->relocations_size();
+  for (int i = 0; i < this->relocations_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->relocations(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Hello::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Hello* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Hello*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Hello::MergeFrom(const Hello& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  relocations_.MergeFrom(from.relocations_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_protocol_version()) {
+      set_protocol_version(from.protocol_version());
+    }
+    if (from.has_labeless_version()) {
+      set_labeless_version(from.labeless_version());
+    }
+    if (from.has_codecs()) {
+      set_codecs(from.codecs());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Hello::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Hello::CopyFrom(const Hello& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Hello::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+
+  if (!::google::protobuf::internal::AllAreInitialized(this->relocations())) return false;
+  return true;
+}
+
+void Hello::Swap(Hello* other) {
+  if (other != this) {
+    std::swap(protocol_version_, other->protocol_version_);
+    std::swap(labeless_version_, other->labeless_version_);
+    std::swap(codecs_, other->codecs_);
+    relocations_.Swap(&other->relocations_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata Hello::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = Hello_descriptor_;
+  metadata.reflection = Hello_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int Execute::kScriptFieldNumber;
+const int Execute::kScriptExternObjFieldNumber;
+const int Execute::kRpcRequestFieldNumber;
+const int Execute::kBackgroundFieldNumber;
+const int Execute::kJobIdFieldNumber;
+const int Execute::kRequestIdFieldNumber;
+const int Execute::kScriptExternMarshalFieldNumber;
+#endif  // !_MSC_VER
+
+Execute::Execute()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:rpc.Execute)
+}
+
+void Execute::InitAsDefaultInstance() {
+}
+
+Execute::Execute(const Execute& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:rpc.Execute)
+}
+
+void Execute::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  script_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  script_extern_obj_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  rpc_request_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  background_ = false;
+  job_id_ = GOOGLE_ULONGLONG(0);
+  request_id_ = GOOGLE_ULONGLONG(0);
+  script_extern_marshal_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+Execute::~Execute() {
+  // @@protoc_insertion_point(destructor:rpc.Execute)
+  SharedDtor();
+}
+
+void Execute::SharedDtor() {
+  if (script_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete script_;
+  }
+  if (script_extern_obj_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete script_extern_obj_;
+  }
+  if (rpc_request_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete rpc_request_;
+  }
+  if (script_extern_marshal_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete script_extern_marshal_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void Execute::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* Execute::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Execute_descriptor_;
+}
+
+const Execute& Execute::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
+  return *default_instance_;
+}
+
+Execute* Execute::default_instance_ = NULL;
+
+Execute* Execute::New() const {
+  return new Execute;
+}
+
+void Execute::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<Execute*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  if (_has_bits_[0 / 32] & 127) {
+    ZR_(job_id_, request_id_);
+    if (has_script()) {
+      if (script_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        script_->clear();
+      }
+    }
+    if (has_script_extern_obj()) {
+      if (script_extern_obj_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        script_extern_obj_->clear();
+      }
+    }
+    if (has_rpc_request()) {
+      if (rpc_request_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        rpc_request_->clear();
+      }
+    }
+    background_ = false;
+    if (has_script_extern_marshal()) {
+      if (script_extern_marshal_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        script_extern_marshal_->clear();
+      }
+    }
+  }
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Execute::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:rpc.Execute)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional string script = 1;
+      case 1: {
+        if (tag == 10) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_script()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->script().data(), this->script().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "script");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_script_extern_obj;
+        break;
+      }
+
+      // optional string script_extern_obj = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_script_extern_obj:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_script_extern_obj()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->script_extern_obj().data(), this->script_extern_obj().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "script_extern_obj");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_rpc_request;
+        break;
+      }
+
+      // optional bytes rpc_request = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_rpc_request:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_rpc_request()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(32)) goto parse_background;
+        break;
+      }
+
+      // optional bool background = 4 [default = false];
+      case 4: {
+        if (tag == 32) {
+         parse_background:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &background_)));
+          set_has_background();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(40)) goto parse_job_id;
+        break;
+      }
+
+      // optional uint64 job_id = 5;
+      case 5: {
+        if (tag == 40) {
+         parse_job_id:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &job_id_)));
+          set_has_job_id();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(48)) goto parse_request_id;
+        break;
+      }
+
+      // optional uint64 request_id = 6;
+      case 6: {
+        if (tag == 48) {
+         parse_request_id:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &request_id_)));
+          set_has_request_id();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(58)) goto parse_script_extern_marshal;
+        break;
+      }
+
+      // optional bytes script_extern_marshal = 7;
+      case 7: {
+        if (tag == 58) {
+         parse_script_extern_marshal:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_script_extern_marshal()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:rpc.Execute)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:rpc.Execute)
+  return false;
+#undef DO_
+}
+
+void Execute::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:rpc.Execute)
+  // optional string script = 1;
+  if (has_script()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->script().data(), this->script().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "script");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->script(), output);
+  }
+
+  // optional string script_extern_obj = 2;
+  if (has_script_extern_obj()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->script_extern_obj().data(), this->script_extern_obj().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "script_extern_obj");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->script_extern_obj(), output);
+  }
+
+  // optional bytes rpc_request = 3;
+  if (has_rpc_request()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      3, this->rpc_request(), output);
+  }
+
+  // optional bool background = 4 [default = false];
+  if (has_background()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->background(), output);
+  }
+
+  // optional uint64 job_id = 5;
+  if (has_job_id()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->job_id(), output);
+  }
+
+  // optional uint64 request_id = 6;
+  if (has_request_id()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->request_id(), output);
+  }
+
+  // optional bytes script_extern_marshal = 7;
+  if (has_script_extern_marshal()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      7, this->script_extern_marshal(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:rpc.Execute)
+}
+
+::google::protobuf::uint8* Execute::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.Execute)
+  // optional string script = 1;
+  if (has_script()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->script().data(), this->script().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "script");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->script(), target);
+  }
+
+  // optional string script_extern_obj = 2;
+  if (has_script_extern_obj()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->script_extern_obj().data(), this->script_extern_obj().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "script_extern_obj");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->script_extern_obj(), target);
+  }
+
+  // optional bytes rpc_request = 3;
+  if (has_rpc_request()) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        3, this->rpc_request(), target);
+  }
+
+  // optional bool background = 4 [default = false];
+  if (has_background()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->background(), target);
+  }
+
+  // optional uint64 job_id = 5;
+  if (has_job_id()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->job_id(), target);
+  }
+
+  // optional uint64 request_id = 6;
+  if (has_request_id()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(6, this->request_id(), target);
+  }
+
+  // optional bytes script_extern_marshal = 7;
+  if (has_script_extern_marshal()) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        7, this->script_extern_marshal(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.Execute)
+  return target;
+}
+
+int Execute::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional string script = 1;
+    if (has_script()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->script());
+    }
+
+    // optional string script_extern_obj = 2;
+    if (has_script_extern_obj()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->script_extern_obj());
+    }
+
+    // optional bytes rpc_request = 3;
+    if (has_rpc_request()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->rpc_request());
+    }
+
+    // optional bool background = 4 [default = false];
+    if (has_background()) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint64 job_id = 5;
+    if (has_job_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->job_id());
+    }
+
+    // optional uint64 request_id = 6;
+    if (has_request_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->request_id());
+    }
+
+    // optional bytes script_extern_marshal = 7;
+    if (has_script_extern_marshal()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->script_extern_marshal());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Execute::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Execute* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Execute*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Execute::MergeFrom(const Execute& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_script()) {
+      set_script(from.script());
+    }
+    if (from.has_script_extern_obj()) {
+      set_script_extern_obj(from.script_extern_obj());
+    }
+    if (from.has_rpc_request()) {
+      set_rpc_request(from.rpc_request());
+    }
+    if (from.has_background()) {
+      set_background(from.background());
+    }
+    if (from.has_job_id()) {
+      set_job_id(from.job_id());
+    }
+    if (from.has_request_id()) {
+      set_request_id(from.request_id());
+    }
+    if (from.has_script_extern_marshal()) {
+      set_script_extern_marshal(from.script_extern_marshal());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Execute::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Execute::CopyFrom(const Execute& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Execute::IsInitialized() const {
+
+  return true;
+}
+
+void Execute::Swap(Execute* other) {
+  if (other != this) {
+    std::swap(script_, other->script_);
+    std::swap(script_extern_obj_, other->script_extern_obj_);
+    std::swap(rpc_request_, other->rpc_request_);
+    std::swap(background_, other->background_);
+    std::swap(job_id_, other->job_id_);
+    std::swap(request_id_, other->request_id_);
+    std::swap(script_extern_marshal_, other->script_extern_marshal_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata Execute::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = Execute_descriptor_;
+  metadata.reflection = Execute_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+const ::google::protobuf::EnumDescriptor* Response_JobStatus_descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Response_JobStatus_descriptor_;
+}
+bool Response_JobStatus_IsValid(int value) {
+  switch(value) {
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#ifndef _MSC_VER
+const Response_JobStatus Response::JS_FINISHED;
+const Response_JobStatus Response::JS_PENDING;
+const Response_JobStatus Response::JobStatus_MIN;
+const Response_JobStatus Response::JobStatus_MAX;
+const int Response::JobStatus_ARRAYSIZE;
+#endif  // _MSC_VER
+#ifndef _MSC_VER
+const int Response::kJobIdFieldNumber;
+const int Response::kStdOutFieldNumber;
+const int Response::kStdErrFieldNumber;
+const int Response::kErrorFieldNumber;
+const int Response::kRpcResultFieldNumber;
+const int Response::kJobStatusFieldNumber;
+const int Response::kRequestIdFieldNumber;
+#endif  // !_MSC_VER
+
+Response::Response()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:rpc.Response)
+}
+
+void Response::InitAsDefaultInstance() {
+}
+
+Response::Response(const Response& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:rpc.Response)
+}
+
+void Response::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  job_id_ = GOOGLE_ULONGLONG(0);
+  std_out_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  std_err_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  error_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  rpc_result_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  job_status_ = 1;
+  request_id_ = GOOGLE_ULONGLONG(0);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+Response::~Response() {
+  // @@protoc_insertion_point(destructor:rpc.Response)
+  SharedDtor();
+}
+
+void Response::SharedDtor() {
+  if (std_out_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete std_out_;
+  }
+  if (std_err_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete std_err_;
+  }
+  if (error_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete error_;
+  }
+  if (rpc_result_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete rpc_result_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void Response::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* Response::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Response_descriptor_;
+}
+
+const Response& Response::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
+  return *default_instance_;
+}
+
+Response* Response::default_instance_ = NULL;
+
+Response* Response::New() const {
+  return new Response;
+}
+
+void Response::Clear() {
+  if (_has_bits_[0 / 32] & 127) {
+    job_id_ = GOOGLE_ULONGLONG(0);
+    if (has_std_out()) {
+      if (std_out_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        std_out_->clear();
+      }
+    }
+    if (has_std_err()) {
+      if (std_err_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        std_err_->clear();
+      }
+    }
+    if (has_error()) {
+      if (error_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        error_->clear();
+      }
+    }
+    if (has_rpc_result()) {
+      if (rpc_result_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        rpc_result_->clear();
+      }
+    }
+    job_status_ = 1;
+    request_id_ = GOOGLE_ULONGLONG(0);
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Response::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:rpc.Response)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint64 job_id = 1;
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &job_id_)));
+          set_has_job_id();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_std_out;
+        break;
+      }
+
+      // optional string std_out = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_std_out:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_std_out()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->std_out().data(), this->std_out().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "std_out");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_std_err;
+        break;
+      }
+
+      // optional string std_err = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_std_err:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_std_err()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->std_err().data(), this->std_err().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "std_err");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_error;
+        break;
+      }
+
+      // optional string error = 4;
+      case 4: {
+        if (tag == 34) {
+         parse_error:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_error()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->error().data(), this->error().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "error");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(42)) goto parse_rpc_result;
+        break;
+      }
+
+      // optional bytes rpc_result = 5;
+      case 5: {
+        if (tag == 42) {
+         parse_rpc_result:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_rpc_result()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(48)) goto parse_job_status;
+        break;
+      }
+
+      // optional .rpc.Response.JobStatus job_status = 6;
+      case 6: {
+        if (tag == 48) {
+         parse_job_status:
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::rpc::Response_JobStatus_IsValid(value)) {
+            set_job_status(static_cast< ::rpc::Response_JobStatus >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(6, value);
+          }
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(56)) goto parse_request_id;
+        break;
+      }
+
+      // optional uint64 request_id = 7;
+      case 7: {
+        if (tag == 56) {
+         parse_request_id:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &request_id_)));
+          set_has_request_id();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:rpc.Response)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:rpc.Response)
+  return false;
+#undef DO_
+}
+
+void Response::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:rpc.Response)
+  // required uint64 job_id = 1;
+  if (has_job_id()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->job_id(), output);
+  }
+
+  // optional string std_out = 2;
+  if (has_std_out()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->std_out().data(), this->std_out().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "std_out");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->std_out(), output);
+  }
+
+  // optional string std_err = 3;
+  if (has_std_err()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->std_err().data(), this->std_err().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "std_err");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->std_err(), output);
+  }
+
+  // optional string error = 4;
+  if (has_error()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->error().data(), this->error().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "error");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      4, this->error(), output);
+  }
+
+  // optional bytes rpc_result = 5;
+  if (has_rpc_result()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      5, this->rpc_result(), output);
+  }
+
+  // optional .rpc.Response.JobStatus job_status = 6;
+  if (has_job_status()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      6, this->job_status(), output);
+  }
+
+  // optional uint64 request_id = 7;
+  if (has_request_id()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(7, this->request_id(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:rpc.Response)
+}
+
+::google::protobuf::uint8* Response::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.Response)
+  // required uint64 job_id = 1;
+  if (has_job_id()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->job_id(), target);
+  }
+
+  // optional string std_out = 2;
+  if (has_std_out()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->std_out().data(), this->std_out().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "std_out");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->std_out(), target);
+  }
+
+  // optional string std_err = 3;
+  if (has_std_err()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->std_err().data(), this->std_err().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "std_err");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->std_err(), target);
+  }
+
+  // optional string error = 4;
+  if (has_error()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->error().data(), this->error().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "error");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        4, this->error(), target);
+  }
+
+  // optional bytes rpc_result = 5;
+  if (has_rpc_result()) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        5, this->rpc_result(), target);
+  }
+
+  // optional .rpc.Response.JobStatus job_status = 6;
+  if (has_job_status()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      6, this->job_status(), target);
+  }
+
+  // optional uint64 request_id = 7;
+  if (has_request_id()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(7, this->request_id(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.Response)
+  return target;
+}
+
+int Response::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint64 job_id = 1;
+    if (has_job_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->job_id());
+    }
+
+    // optional string std_out = 2;
+    if (has_std_out()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->std_out());
+    }
+
+    // optional string std_err = 3;
+    if (has_std_err()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->std_err());
+    }
+
+    // optional string error = 4;
+    if (has_error()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->error());
+    }
+
+    // optional bytes rpc_result = 5;
+    if (has_rpc_result()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->rpc_result());
+    }
+
+    // optional .rpc.Response.JobStatus job_status = 6;
+    if (has_job_status()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->job_status());
+    }
+
+    // optional uint64 request_id = 7;
+    if (has_request_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->request_id());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Response::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Response* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Response::MergeFrom(const Response& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_job_id()) {
+      set_job_id(from.job_id());
+    }
+    if (from.has_std_out()) {
+      set_std_out(from.std_out());
+    }
+    if (from.has_std_err()) {
+      set_std_err(from.std_err());
+    }
+    if (from.has_error()) {
+      set_error(from.error());
+    }
+    if (from.has_rpc_result()) {
+      set_rpc_result(from.rpc_result());
+    }
+    if (from.has_job_status()) {
+      set_job_status(from.job_status());
+    }
+    if (from.has_request_id()) {
+      set_request_id(from.request_id());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Response::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Response::CopyFrom(const Response& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Response::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+
+  return true;
+}
+
+void Response::Swap(Response* other) {
+  if (other != this) {
+    std::swap(job_id_, other->job_id_);
+    std::swap(std_out_, other->std_out_);
+    std::swap(std_err_, other->std_err_);
+    std::swap(error_, other->error_);
+    std::swap(rpc_result_, other->rpc_result_);
+    std::swap(job_status_, other->job_status_);
+    std::swap(request_id_, other->request_id_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata Response::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = Response_descriptor_;
+  metadata.reflection = Response_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int PackedNames::kEaDeltasFieldNumber;
+const int PackedNames::kSharedSizesFieldNumber;
+const int PackedNames::kSuffixSizesFieldNumber;
+const int PackedNames::kSuffixesFieldNumber;
+#endif  // !_MSC_VER
+
+PackedNames::PackedNames()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:rpc.PackedNames)
+}
+
+void PackedNames::InitAsDefaultInstance() {
+}
+
+PackedNames::PackedNames(const PackedNames& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:rpc.PackedNames)
+}
+
+void PackedNames::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  suffixes_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+PackedNames::~PackedNames() {
+  // @@protoc_insertion_point(destructor:rpc.PackedNames)
+  SharedDtor();
+}
+
+void PackedNames::SharedDtor() {
+  if (suffixes_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete suffixes_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void PackedNames::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* PackedNames::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return PackedNames_descriptor_;
+}
+
+const PackedNames& PackedNames::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
+  return *default_instance_;
+}
+
+PackedNames* PackedNames::default_instance_ = NULL;
+
+PackedNames* PackedNames::New() const {
+  return new PackedNames;
+}
+
+void PackedNames::Clear() {
+  if (has_suffixes()) {
+    if (suffixes_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+      suffixes_->clear();
+    }
+  }
+  ea_deltas_.Clear();
+  shared_sizes_.Clear();
+  suffix_sizes_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool PackedNames::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:rpc.PackedNames)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated uint32 ea_deltas = 1 [packed = true];
+      case 1: {
+        if (tag == 10) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, this->mutable_ea_deltas())));
+        } else if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 1, 10, input, this->mutable_ea_deltas())));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_shared_sizes;
+        break;
+      }
+
+      // repeated uint32 shared_sizes = 2 [packed = true];
+      case 2: {
+        if (tag == 18) {
+         parse_shared_sizes:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, this->mutable_shared_sizes())));
+        } else if (tag == 16) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 1, 18, input, this->mutable_shared_sizes())));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_suffix_sizes;
+        break;
+      }
+
+      // repeated uint32 suffix_sizes = 3 [packed = true];
+      case 3: {
+        if (tag == 26) {
+         parse_suffix_sizes:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, this->mutable_suffix_sizes())));
+        } else if (tag == 24) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 1, 26, input, this->mutable_suffix_sizes())));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_suffixes;
+        break;
+      }
+
+      // optional bytes suffixes = 4;
+      case 4: {
+        if (tag == 34) {
+         parse_suffixes:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_suffixes()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:rpc.PackedNames)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:rpc.PackedNames)
+  return false;
+#undef DO_
+}
+
+void PackedNames::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:rpc.PackedNames)
+  // repeated uint32 ea_deltas = 1 [packed = true];
+  if (this->ea_deltas_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(1, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_ea_deltas_cached_byte_size_);
+  }
+  for (int i = 0; i < this->ea_deltas_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
+      this->ea_deltas(i), output);
+  }
+
+  // repeated uint32 shared_sizes = 2 [packed = true];
+  if (this->shared_sizes_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(2, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_shared_sizes_cached_byte_size_);
+  }
+  for (int i = 0; i < this->shared_sizes_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
+      this->shared_sizes(i), output);
+  }
+
+  // repeated uint32 suffix_sizes = 3 [packed = true];
+  if (this->suffix_sizes_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(3, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_suffix_sizes_cached_byte_size_);
+  }
+  for (int i = 0; i < this->suffix_sizes_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
+      this->suffix_sizes(i), output);
+  }
+
+  // optional bytes suffixes = 4;
+  if (has_suffixes()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      4, this->suffixes(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:rpc.PackedNames)
+}
+
+::google::protobuf::uint8* PackedNames::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.PackedNames)
+  // repeated uint32 ea_deltas = 1 [packed = true];
+  if (this->ea_deltas_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      1,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      _ea_deltas_cached_byte_size_, target);
+  }
+  for (int i = 0; i < this->ea_deltas_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt32NoTagToArray(this->ea_deltas(i), target);
+  }
+
+  // repeated uint32 shared_sizes = 2 [packed = true];
+  if (this->shared_sizes_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      2,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      _shared_sizes_cached_byte_size_, target);
+  }
+  for (int i = 0; i < this->shared_sizes_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt32NoTagToArray(this->shared_sizes(i), target);
+  }
+
+  // repeated uint32 suffix_sizes = 3 [packed = true];
+  if (this->suffix_sizes_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      3,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      _suffix_sizes_cached_byte_size_, target);
+  }
+  for (int i = 0; i < this->suffix_sizes_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt32NoTagToArray(this->suffix_sizes(i), target);
+  }
+
+  // optional bytes suffixes = 4;
+  if (has_suffixes()) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        4, this->suffixes(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.PackedNames)
+  return target;
+}
+
+int PackedNames::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[3 / 32] & (0xffu << (3 % 32))) {
+    // optional bytes suffixes = 4;
+    if (has_suffixes()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->suffixes());
+    }
+
+  }
+  // repeated uint32 ea_deltas = 1 [packed = true];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->ea_deltas_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt32Size(this->ea_deltas(i));
+    }
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _ea_deltas_cached_byte_size_ = data_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated uint32 shared_sizes = 2 [packed = true];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->shared_sizes_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt32Size(this->shared_sizes(i));
+    }
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _shared_sizes_cached_byte_size_ = data_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated uint32 suffix_sizes = 3 [packed = true];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->suffix_sizes_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt32Size(this->suffix_sizes(i));
+    }
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _suffix_sizes_cached_byte_size_ = data_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void PackedNames::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const PackedNames* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const PackedNames*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void PackedNames::MergeFrom(const PackedNames& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  ea_deltas_.MergeFrom(from.ea_deltas_);
+  shared_sizes_.MergeFrom(from.shared_sizes_);
+  suffix_sizes_.MergeFrom(from.suffix_sizes_);
+  if (from._has_bits_[3 / 32] & (0xffu << (3 % 32))) {
+    if (from.has_suffixes()) {
+      set_suffixes(from.suffixes());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void PackedNames::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PackedNames::CopyFrom(const PackedNames& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PackedNames::IsInitialized() const {
+
+  return true;
+}
+
+void PackedNames::Swap(PackedNames* other) {
+  if (other != this) {
+    ea_deltas_.Swap(&other->ea_deltas_);
+    shared_sizes_.Swap(&other->shared_sizes_);
+    suffix_sizes_.Swap(&other->suffix_sizes_);
+    std::swap(suffixes_, other->suffixes_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata PackedNames::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = PackedNames_descriptor_;
+  metadata.reflection = PackedNames_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int MakeNamesRequest_Name::kEaFieldNumber;
+const int MakeNamesRequest_Name::kNameFieldNumber;
+#endif  // !_MSC_VER
+
+MakeNamesRequest_Name::MakeNamesRequest_Name()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:rpc.MakeNamesRequest.Name)
+}
+
+void MakeNamesRequest_Name::InitAsDefaultInstance() {
+}
+
+MakeNamesRequest_Name::MakeNamesRequest_Name(const MakeNamesRequest_Name& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:rpc.MakeNamesRequest.Name)
+}
+
+void MakeNamesRequest_Name::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  ea_ = 0u;
+  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+MakeNamesRequest_Name::~MakeNamesRequest_Name() {
+  // @@protoc_insertion_point(destructor:rpc.MakeNamesRequest.Name)
+  SharedDtor();
+}
+
+void MakeNamesRequest_Name::SharedDtor() {
+  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete name_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void MakeNamesRequest_Name::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* MakeNamesRequest_Name::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return MakeNamesRequest_Name_descriptor_;
+}
+
+const MakeNamesRequest_Name& MakeNamesRequest_Name::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
+  return *default_instance_;
+}
+
+MakeNamesRequest_Name* MakeNamesRequest_Name::default_instance_ = NULL;
+
+MakeNamesRequest_Name* MakeNamesRequest_Name::New() const {
+  return new MakeNamesRequest_Name;
+}
+
+void MakeNamesRequest_Name::Clear() {
+  if (_has_bits_[0 / 32] & 3) {
+    ea_ = 0u;
+    if (has_name()) {
+      if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        name_->clear();
+      }
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool MakeNamesRequest_Name::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:rpc.MakeNamesRequest.Name)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint32 ea = 1;
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &ea_)));
+          set_has_ea();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_name;
+        break;
+      }
+
+      // required string name = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_name:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->name().data(), this->name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "name");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:rpc.MakeNamesRequest.Name)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:rpc.MakeNamesRequest.Name)
+  return false;
+#undef DO_
+}
+
+void MakeNamesRequest_Name::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:rpc.MakeNamesRequest.Name)
+  // required uint32 ea = 1;
+  if (has_ea()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->ea(), output);
+  }
+
+  // required string name = 2;
+  if (has_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->name(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:rpc.MakeNamesRequest.Name)
+}
+
+::google::protobuf::uint8* MakeNamesRequest_Name::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.MakeNamesRequest.Name)
+  // required uint32 ea = 1;
+  if (has_ea()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->ea(), target);
+  }
+
+  // required string name = 2;
+  if (has_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->name(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.MakeNamesRequest.Name)
+  return target;
+}
+
+int MakeNamesRequest_Name::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint32 ea = 1;
+    if (has_ea()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->ea());
+    }
+
+    // required string name = 2;
+    if (has_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->name());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void MakeNamesRequest_Name::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const MakeNamesRequest_Name* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const MakeNamesRequest_Name*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void MakeNamesRequest_Name::MergeFrom(const MakeNamesRequest_Name& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_ea()) {
+      set_ea(from.ea());
+    }
+    if (from.has_name()) {
+      set_name(from.name());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void MakeNamesRequest_Name::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void MakeNamesRequest_Name::CopyFrom(const MakeNamesRequest_Name& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MakeNamesRequest_Name::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+
+  return true;
+}
+
+void MakeNamesRequest_Name::Swap(MakeNamesRequest_Name* other) {
+  if (other != this) {
+    std::swap(ea_, other->ea_);
+    std::swap(name_, other->name_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata MakeNamesRequest_Name::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = MakeNamesRequest_Name_descriptor_;
+  metadata.reflection = MakeNamesRequest_Name_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int MakeNamesRequest::kNamesFieldNumber;
+const int MakeNamesRequest::kBaseFieldNumber;
+const int MakeNamesRequest::kRemoteBaseFieldNumber;
+const int MakeNamesRequest::kPackedNamesFieldNumber;
+#endif  // !_MSC_VER
+
+MakeNamesRequest::MakeNamesRequest()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:rpc.MakeNamesRequest)
+}
+
+void MakeNamesRequest::InitAsDefaultInstance() {
+  packed_names_ = const_cast< ::rpc::PackedNames*>(&::rpc::PackedNames::default_instance());
+}
+
+MakeNamesRequest::MakeNamesRequest(const MakeNamesRequest& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:rpc.MakeNamesRequest)
+}
+
+void MakeNamesRequest::SharedCtor() {
+  _cached_size_ = 0;
+  base_ = 0u;
+  remote_base_ = 0u;
+  packed_names_ = NULL;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+MakeNamesRequest::~MakeNamesRequest() {
+  // @@protoc_insertion_point(destructor:rpc.MakeNamesRequest)
+  SharedDtor();
+}
+
+void MakeNamesRequest::SharedDtor() {
+  if (this != default_instance_) {
+    delete packed_names_;
+  }
+}
+
+void MakeNamesRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* MakeNamesRequest::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return MakeNamesRequest_descriptor_;
+}
+
+const MakeNamesRequest& MakeNamesRequest::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
+  return *default_instance_;
+}
+
+MakeNamesRequest* MakeNamesRequest::default_instance_ = NULL;
+
+MakeNamesRequest* MakeNamesRequest::New() const {
+  return new MakeNamesRequest;
+}
+
+void MakeNamesRequest::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<MakeNamesRequest*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  if (_has_bits_[0 / 32] & 14) {
+    ZR_(base_, remote_base_);
+    if (has_packed_names()) {
+      if (packed_names_ != NULL) packed_names_->::rpc::PackedNames::Clear();
+    }
+  }
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
+  names_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool MakeNamesRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:rpc.MakeNamesRequest)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .rpc.MakeNamesRequest.Name names = 1;
+      case 1: {
+        if (tag == 10) {
+         parse_names:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_names()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(10)) goto parse_names;
+        if (input->ExpectTag(16)) goto parse_base;
+        break;
+      }
+
+      // required uint32 base = 2;
+      case 2: {
+        if (tag == 16) {
+         parse_base:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &base_)));
+          set_has_base();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(24)) goto parse_remote_base;
+        break;
+      }
+
+      // required uint32 remote_base = 3;
+      case 3: {
+        if (tag == 24) {
+         parse_remote_base:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &remote_base_)));
+          set_has_remote_base();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_packed_names;
+        break;
+      }
+
+      // optional .rpc.PackedNames packed_names = 4;
+      case 4: {
+        if (tag == 34) {
+         parse_packed_names:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_packed_names()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:rpc.MakeNamesRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:rpc.MakeNamesRequest)
+  return false;
+#undef DO_
+}
+
+void MakeNamesRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:rpc.MakeNamesRequest)
+  // repeated .rpc.MakeNamesRequest.Name names = 1;
+  for (int i = 0; i < this->names_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->names(i), output);
+  }
+
+  // required uint32 base = 2;
+  if (has_base()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->base(), output);
+  }
+
+  // required uint32 remote_base = 3;
+  if (has_remote_base()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->remote_base(), output);
+  }
+
+  // optional .rpc.PackedNames packed_names = 4;
+  if (has_packed_names()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->packed_names(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:rpc.MakeNamesRequest)
+}
+
+::google::protobuf::uint8* MakeNamesRequest::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.MakeNamesRequest)
+  // repeated .rpc.MakeNamesRequest.Name names = 1;
+  for (int i = 0; i < this->names_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->names(i), target);
+  }
+
+  // required uint32 base = 2;
+  if (has_base()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->base(), target);
+  }
+
+  // required uint32 remote_base = 3;
+  if (has_remote_base()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->remote_base(), target);
+  }
+
+  // optional .rpc.PackedNames packed_names = 4;
+  if (has_packed_names()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        4, this->packed_names(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.MakeNamesRequest)
+  return target;
+}
+
+int MakeNamesRequest::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[1 / 32] & (0xffu << (1 % 32))) {
+    // required uint32 base = 2;
+    if (has_base()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->base());
+    }
+
+    // required uint32 remote_base = 3;
+    if (has_remote_base()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->remote_base());
+    }
+
+    // optional .rpc.PackedNames packed_names = 4;
+    if (has_packed_names()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->packed_names());
+    }
+
+  }
+  // repeated .rpc.MakeNamesRequest.Name names = 1;
+  total_size += 1 * this->names_size();
+  for (int i = 0; i < this->names_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->names(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void MakeNamesRequest::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const MakeNamesRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const MakeNamesRequest*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void MakeNamesRequest::MergeFrom(const MakeNamesRequest& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  names_.MergeFrom(from.names_);
+  if (from._has_bits_[1 / 32] & (0xffu << (1 % 32))) {
+    if (from.has_base()) {
+      set_base(from.base());
+    }
+    if (from.has_remote_base()) {
+      set_remote_base(from.remote_base());
+    }
+    if (from.has_packed_names()) {
+      mutable_packed_names()->::rpc::PackedNames::MergeFrom(from.packed_names());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void MakeNamesRequest::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void MakeNamesRequest::CopyFrom(const MakeNamesRequest& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MakeNamesRequest::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000006) != 0x00000006) return false;
+
+  if (!::google::protobuf::internal::AllAreInitialized(this->names())) return false;
+  return true;
+}
+
+void MakeNamesRequest::Swap(MakeNamesRequest* other) {
+  if (other != this) {
+    names_.Swap(&other->names_);
+    std::swap(base_, other->base_);
+    std::swap(remote_base_, other->remote_base_);
+    std::swap(packed_names_, other->packed_names_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata MakeNamesRequest::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = MakeNamesRequest_descriptor_;
+  metadata.reflection = MakeNamesRequest_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int MakeCommentsRequest_Name::kEaFieldNumber;
+const int MakeCommentsRequest_Name::kNameFieldNumber;
+#endif  // !_MSC_VER
+
+MakeCommentsRequest_Name::MakeCommentsRequest_Name()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:rpc.MakeCommentsRequest.Name)
+}
+
+void MakeCommentsRequest_Name::InitAsDefaultInstance() {
+}
+
+MakeCommentsRequest_Name::MakeCommentsRequest_Name(const MakeCommentsRequest_Name& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:rpc.MakeCommentsRequest.Name)
+}
+
+void MakeCommentsRequest_Name::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  ea_ = 0u;
+  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+MakeCommentsRequest_Name::~MakeCommentsRequest_Name() {
+  // @@protoc_insertion_point(destructor:rpc.MakeCommentsRequest.Name)
+  SharedDtor();
+}
+
+void MakeCommentsRequest_Name::SharedDtor() {
+  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete name_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void MakeCommentsRequest_Name::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* MakeCommentsRequest_Name::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return MakeCommentsRequest_Name_descriptor_;
+}
+
+const MakeCommentsRequest_Name& MakeCommentsRequest_Name::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
+  return *default_instance_;
+}
+
+MakeCommentsRequest_Name* MakeCommentsRequest_Name::default_instance_ = NULL;
+
+MakeCommentsRequest_Name* MakeCommentsRequest_Name::New() const {
+  return new MakeCommentsRequest_Name;
+}
+
+void MakeCommentsRequest_Name::Clear() {
+  if (_has_bits_[0 / 32] & 3) {
+    ea_ = 0u;
+    if (has_name()) {
+      if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        name_->clear();
+      }
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool MakeCommentsRequest_Name::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:rpc.MakeCommentsRequest.Name)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint32 ea = 1;
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &ea_)));
+          set_has_ea();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_name;
+        break;
+      }
+
+      // required string name = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_name:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->name().data(), this->name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "name");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:rpc.MakeCommentsRequest.Name)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:rpc.MakeCommentsRequest.Name)
+  return false;
+#undef DO_
+}
+
+void MakeCommentsRequest_Name::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:rpc.MakeCommentsRequest.Name)
+  // required uint32 ea = 1;
+  if (has_ea()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->ea(), output);
+  }
+
+  // required string name = 2;
+  if (has_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->name(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:rpc.MakeCommentsRequest.Name)
+}
+
+::google::protobuf::uint8* MakeCommentsRequest_Name::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.MakeCommentsRequest.Name)
+  // required uint32 ea = 1;
+  if (has_ea()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->ea(), target);
+  }
+
+  // required string name = 2;
+  if (has_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->name(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.MakeCommentsRequest.Name)
+  return target;
+}
+
+int MakeCommentsRequest_Name::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint32 ea = 1;
+    if (has_ea()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->ea());
+    }
+
+    // required string name = 2;
+    if (has_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->name());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void MakeCommentsRequest_Name::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const MakeCommentsRequest_Name* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const MakeCommentsRequest_Name*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void MakeCommentsRequest_Name::MergeFrom(const MakeCommentsRequest_Name& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_ea()) {
+      set_ea(from.ea());
+    }
+    if (from.has_name()) {
+      set_name(from.name());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void MakeCommentsRequest_Name::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void MakeCommentsRequest_Name::CopyFrom(const MakeCommentsRequest_Name& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MakeCommentsRequest_Name::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+
+  return true;
+}
+
+void MakeCommentsRequest_Name::Swap(MakeCommentsRequest_Name* other) {
+  if (other != this) {
+    std::swap(ea_, other->ea_);
+    std::swap(name_, other->name_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata MakeCommentsRequest_Name::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = MakeCommentsRequest_Name_descriptor_;
+  metadata.reflection = MakeCommentsRequest_Name_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int MakeCommentsRequest::kNamesFieldNumber;
+const int MakeCommentsRequest::kBaseFieldNumber;
+const int MakeCommentsRequest::kRemoteBaseFieldNumber;
+const int MakeCommentsRequest::kPackedNamesFieldNumber;
+#endif  // !_MSC_VER
+
+MakeCommentsRequest::MakeCommentsRequest()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:rpc.MakeCommentsRequest)
+}
+
+void MakeCommentsRequest::InitAsDefaultInstance() {
+  packed_names_ = const_cast< ::rpc::PackedNames*>(&::rpc::PackedNames::default_instance());
+}
+
+MakeCommentsRequest::MakeCommentsRequest(const MakeCommentsRequest& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:rpc.MakeCommentsRequest)
+}
+
+void MakeCommentsRequest::SharedCtor() {
+  _cached_size_ = 0;
+  base_ = 0u;
+  remote_base_ = 0u;
+  packed_names_ = NULL;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+MakeCommentsRequest::~MakeCommentsRequest() {
+  // @@protoc_insertion_point(destructor:rpc.MakeCommentsRequest)
+  SharedDtor();
+}
+
+void MakeCommentsRequest::SharedDtor() {
+  if (this != default_instance_) {
+    delete packed_names_;
+  }
+}
+
+void MakeCommentsRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* MakeCommentsRequest::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return MakeCommentsRequest_descriptor_;
+}
+
+const MakeCommentsRequest& MakeCommentsRequest::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
+  return *default_instance_;
+}
+
+MakeCommentsRequest* MakeCommentsRequest::default_instance_ = NULL;
+
+MakeCommentsRequest* MakeCommentsRequest::New() const {
+  return new MakeCommentsRequest;
+}
+
+void MakeCommentsRequest::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<MakeCommentsRequest*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  if (_has_bits_[0 / 32] & 14) {
+    ZR_(base_, remote_base_);
+    if (has_packed_names()) {
+      if (packed_names_ != NULL) packed_names_->::rpc::PackedNames::Clear();
+    }
+  }
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
+  names_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool MakeCommentsRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:rpc.MakeCommentsRequest)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .rpc.MakeCommentsRequest.Name names = 1;
+      case 1: {
+        if (tag == 10) {
+         parse_names:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_names()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(10)) goto parse_names;
+        if (input->ExpectTag(16)) goto parse_base;
+        break;
+      }
+
+      // required uint32 base = 2;
+      case 2: {
+        if (tag == 16) {
+         parse_base:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &base_)));
+          set_has_base();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(24)) goto parse_remote_base;
+        break;
+      }
+
+      // required uint32 remote_base = 3;
+      case 3: {
+        if (tag == 24) {
+         parse_remote_base:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &remote_base_)));
+          set_has_remote_base();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_packed_names;
+        break;
+      }
+
+      // optional .rpc.PackedNames packed_names = 4;
+      case 4: {
+        if (tag == 34) {
+         parse_packed_names:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_packed_names()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:rpc.MakeCommentsRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:rpc.MakeCommentsRequest)
+  return false;
+#undef DO_
+}
+
+void MakeCommentsRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:rpc.MakeCommentsRequest)
+  // repeated .rpc.MakeCommentsRequest.Name names = 1;
+  for (int i = 0; i < this->names_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->names(i), output);
+  }
+
+  // required uint32 base = 2;
+  if (has_base()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->base(), output);
+  }
+
+  // required uint32 remote_base = 3;
+  if (has_remote_base()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->remote_base(), output);
+  }
+
+  // optional .rpc.PackedNames packed_names = 4;
+  if (has_packed_names()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->packed_names(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:rpc.MakeCommentsRequest)
+}
+
+::google::protobuf::uint8* MakeCommentsRequest::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.MakeCommentsRequest)
+  // repeated .rpc.MakeCommentsRequest.Name names = 1;
+  for (int i = 0; i < this->names_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->names(i), target);
+  }
+
+  // required uint32 base = 2;
+  if (has_base()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->base(), target);
+  }
+
+  // required uint32 remote_base = 3;
+  if (has_remote_base()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->remote_base(), target);
+  }
+
+  // optional .rpc.PackedNames packed_names = 4;
+  if (has_packed_names()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        4, this->packed_names(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.MakeCommentsRequest)
+  return target;
+}
+
+int MakeCommentsRequest::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[1 / 32] & (0xffu << (1 % 32))) {
+    // required uint32 base = 2;
+    if (has_base()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->base());
+    }
+
+    // required uint32 remote_base = 3;
+    if (has_remote_base()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->remote_base());
+    }
+
+    // optional .rpc.PackedNames packed_names = 4;
+    if (has_packed_names()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->packed_names());
+    }
+
+  }
+  // repeated .rpc.MakeCommentsRequest.Name names = 1;
+  total_size += 1 * this->names_size();
+  for (int i = 0; i < this->names_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->names(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void MakeCommentsRequest::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const MakeCommentsRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const MakeCommentsRequest*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void MakeCommentsRequest::MergeFrom(const MakeCommentsRequest& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  names_.MergeFrom(from.names_);
+  if (from._has_bits_[1 / 32] & (0xffu << (1 % 32))) {
+    if (from.has_base()) {
+      set_base(from.base());
+    }
+    if (from.has_remote_base()) {
+      set_remote_base(from.remote_base());
+    }
+    if (from.has_packed_names()) {
+      mutable_packed_names()->::rpc::PackedNames::MergeFrom(from.packed_names());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void MakeCommentsRequest::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void MakeCommentsRequest::CopyFrom(const MakeCommentsRequest& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MakeCommentsRequest::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000006) != 0x00000006) return false;
+
+  if (!::google::protobuf::internal::AllAreInitialized(this->names())) return false;
+  return true;
+}
+
+void MakeCommentsRequest::Swap(MakeCommentsRequest* other) {
+  if (other != this) {
+    names_.Swap(&other->names_);
+    std::swap(base_, other->base_);
+    std::swap(remote_base_, other->remote_base_);
+    std::swap(packed_names_, other->packed_names_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata MakeCommentsRequest::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = MakeCommentsRequest_descriptor_;
+  metadata.reflection = MakeCommentsRequest_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int GetNamesRequest::kBaseFieldNumber;
+const int GetNamesRequest::kRemoteBaseFieldNumber;
+const int GetNamesRequest::kStartFieldNumber;
+const int GetNamesRequest::kEndFieldNumber;
+const int GetNamesRequest::kLabelsFieldNumber;
+const int GetNamesRequest::kCommentsFieldNumber;
+#endif  // !_MSC_VER
+
+GetNamesRequest::GetNamesRequest()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:rpc.GetNamesRequest)
+}
+
+void GetNamesRequest::InitAsDefaultInstance() {
+}
+
+GetNamesRequest::GetNamesRequest(const GetNamesRequest& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:rpc.GetNamesRequest)
+}
+
+void GetNamesRequest::SharedCtor() {
+  _cached_size_ = 0;
+  base_ = 0u;
+  remote_base_ = 0u;
+  start_ = 0u;
+  end_ = 0u;
+  labels_ = true;
+  comments_ = true;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+GetNamesRequest::~GetNamesRequest() {
+  // @@protoc_insertion_point(destructor:rpc.GetNamesRequest)
+  SharedDtor();
+}
+
+void GetNamesRequest::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void GetNamesRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* GetNamesRequest::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return GetNamesRequest_descriptor_;
+}
+
+const GetNamesRequest& GetNamesRequest::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
+  return *default_instance_;
+}
+
+GetNamesRequest* GetNamesRequest::default_instance_ = NULL;
+
+GetNamesRequest* GetNamesRequest::New() const {
+  return new GetNamesRequest;
+}
+
+void GetNamesRequest::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<GetNamesRequest*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  if (_has_bits_[0 / 32] & 63) {
+    ZR_(base_, end_);
+    labels_ = true;
+    comments_ = true;
   }
 
-  // optional bytes rpc_result = 5;
-  if (has_rpc_result()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      5, this->rpc_result(), output);
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool GetNamesRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:rpc.GetNamesRequest)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint32 base = 1;
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &base_)));
+          set_has_base();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(16)) goto parse_remote_base;
+        break;
+      }
+
+      // required uint32 remote_base = 2;
+      case 2: {
+        if (tag == 16) {
+         parse_remote_base:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &remote_base_)));
+          set_has_remote_base();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(24)) goto parse_start;
+        break;
+      }
+
+      // required uint32 start = 3;
+      case 3: {
+        if (tag == 24) {
+         parse_start:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &start_)));
+          set_has_start();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(32)) goto parse_end;
+        break;
+      }
+
+      // required uint32 end = 4;
+      case 4: {
+        if (tag == 32) {
+         parse_end:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &end_)));
+          set_has_end();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(40)) goto parse_labels;
+        break;
+      }
+
+      // optional bool labels = 5 [default = true];
+      case 5: {
+        if (tag == 40) {
+         parse_labels:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &labels_)));
+          set_has_labels();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(48)) goto parse_comments;
+        break;
+      }
+
+      // optional bool comments = 6 [default = true];
+      case 6: {
+        if (tag == 48) {
+         parse_comments:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &comments_)));
+          set_has_comments();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:rpc.GetNamesRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:rpc.GetNamesRequest)
+  return false;
+#undef DO_
+}
+
+void GetNamesRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:rpc.GetNamesRequest)
+  // required uint32 base = 1;
+  if (has_base()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->base(), output);
   }
 
-  // optional .rpc.Response.JobStatus job_status = 6;
-  if (has_job_status()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      6, this->job_status(), output);
+  // required uint32 remote_base = 2;
+  if (has_remote_base()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->remote_base(), output);
+  }
+
+  // required uint32 start = 3;
+  if (has_start()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->start(), output);
+  }
+
+  // required uint32 end = 4;
+  if (has_end()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->end(), output);
+  }
+
+  // optional bool labels = 5 [default = true];
+  if (has_labels()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(5, this->labels(), output);
+  }
+
+  // optional bool comments = 6 [default = true];
+  if (has_comments()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(6, this->comments(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:rpc.Response)
+  // @@protoc_insertion_point(serialize_end:rpc.GetNamesRequest)
 }
 
-::google::protobuf::uint8* Response::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetNamesRequest::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rpc.Response)
-  // required uint64 job_id = 1;
-  if (has_job_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->job_id(), target);
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.GetNamesRequest)
+  // required uint32 base = 1;
+  if (has_base()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->base(), target);
   }
 
-  // optional string std_out = 2;
-  if (has_std_out()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->std_out().data(), this->std_out().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "std_out");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->std_out(), target);
+  // required uint32 remote_base = 2;
+  if (has_remote_base()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->remote_base(), target);
   }
 
-  // optional string std_err = 3;
-  if (has_std_err()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->std_err().data(), this->std_err().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "std_err");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->std_err(), target);
+  // required uint32 start = 3;
+  if (has_start()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->start(), target);
   }
 
-  // optional string error = 4;
-  if (has_error()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->error().data(), this->error().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "error");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->error(), target);
+  // required uint32 end = 4;
+  if (has_end()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->end(), target);
   }
 
-  // optional bytes rpc_result = 5;
-  if (has_rpc_result()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        5, this->rpc_result(), target);
+  // optional bool labels = 5 [default = true];
+  if (has_labels()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(5, this->labels(), target);
   }
 
-  // optional .rpc.Response.JobStatus job_status = 6;
-  if (has_job_status()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      6, this->job_status(), target);
+  // optional bool comments = 6 [default = true];
+  if (has_comments()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(6, this->comments(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rpc.Response)
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.GetNamesRequest)
   return target;
 }
 
-int Response::ByteSize() const {
+int GetNamesRequest::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required uint64 job_id = 1;
-    if (has_job_id()) {
+    // required uint32 base = 1;
+    if (has_base()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->job_id());
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->base());
     }
 
-    // optional string std_out = 2;
-    if (has_std_out()) {
+    // required uint32 remote_base = 2;
+    if (has_remote_base()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->std_out());
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->remote_base());
     }
 
-    // optional string std_err = 3;
-    if (has_std_err()) {
+    // required uint32 start = 3;
+    if (has_start()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->std_err());
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->start());
     }
 
-    // optional string error = 4;
-    if (has_error()) {
+    // required uint32 end = 4;
+    if (has_end()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->error());
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->end());
     }
 
-    // optional bytes rpc_result = 5;
-    if (has_rpc_result()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->rpc_result());
+    // optional bool labels = 5 [default = true];
+    if (has_labels()) {
+      total_size += 1 + 1;
     }
 
-    // optional .rpc.Response.JobStatus job_status = 6;
-    if (has_job_status()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->job_status());
+    // optional bool comments = 6 [default = true];
+    if (has_comments()) {
+      total_size += 1 + 1;
     }
 
   }
@@ -2107,10 +5357,10 @@ int Response::ByteSize() const {
   return total_size;
 }
 
-void Response::MergeFrom(const ::google::protobuf::Message& from) {
+void GetNamesRequest::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Response* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Response*>(
+  const GetNamesRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const GetNamesRequest*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -2119,68 +5369,68 @@ void Response::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void Response::MergeFrom(const Response& from) {
+void GetNamesRequest::MergeFrom(const GetNamesRequest& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_job_id()) {
-      set_job_id(from.job_id());
+    if (from.has_base()) {
+      set_base(from.base());
     }
-    if (from.has_std_out()) {
-      set_std_out(from.std_out());
+    if (from.has_remote_base()) {
+      set_remote_base(from.remote_base());
     }
-    if (from.has_std_err()) {
-      set_std_err(from.std_err());
+    if (from.has_start()) {
+      set_start(from.start());
     }
-    if (from.has_error()) {
-      set_error(from.error());
+    if (from.has_end()) {
+      set_end(from.end());
     }
-    if (from.has_rpc_result()) {
-      set_rpc_result(from.rpc_result());
+    if (from.has_labels()) {
+      set_labels(from.labels());
     }
-    if (from.has_job_status()) {
-      set_job_status(from.job_status());
+    if (from.has_comments()) {
+      set_comments(from.comments());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Response::CopyFrom(const ::google::protobuf::Message& from) {
+void GetNamesRequest::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Response::CopyFrom(const Response& from) {
+void GetNamesRequest::CopyFrom(const GetNamesRequest& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  return true;
-}
+bool GetNamesRequest::IsInitialized() const {
+  if ((_has_bits_[0] & 0x0000000f) != 0x0000000f) return false;
 
-void Response::Swap(Response* other) {
-  if (other != this) {
-    std::swap(job_id_, other->job_id_);
-    std::swap(std_out_, other->std_out_);
-    std::swap(std_err_, other->std_err_);
-    std::swap(error_, other->error_);
-    std::swap(rpc_result_, other->rpc_result_);
-    std::swap(job_status_, other->job_status_);
+  return true;
+}
+
+void GetNamesRequest::Swap(GetNamesRequest* other) {
+  if (other != this) {
+    std::swap(base_, other->base_);
+    std::swap(remote_base_, other->remote_base_);
+    std::swap(start_, other->start_);
+    std::swap(end_, other->end_);
+    std::swap(labels_, other->labels_);
+    std::swap(comments_, other->comments_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Response::GetMetadata() const {
+::google::protobuf::Metadata GetNamesRequest::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_descriptor_;
-  metadata.reflection = Response_reflection_;
+  metadata.descriptor = GetNamesRequest_descriptor_;
+  metadata.reflection = GetNamesRequest_reflection_;
   return metadata;
 }
 
@@ -2188,74 +5438,84 @@ void Response::Swap(Response* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int MakeNamesRequest_Name::kEaFieldNumber;
-const int MakeNamesRequest_Name::kNameFieldNumber;
+const int GetNamesResult_Name::kEaDeltaFieldNumber;
+const int GetNamesResult_Name::kLabelFieldNumber;
+const int GetNamesResult_Name::kCommentFieldNumber;
 #endif  // !_MSC_VER
 
-MakeNamesRequest_Name::MakeNamesRequest_Name()
+GetNamesResult_Name::GetNamesResult_Name()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:rpc.MakeNamesRequest.Name)
+  // @@protoc_insertion_point(constructor:rpc.GetNamesResult.Name)
 }
 
-void MakeNamesRequest_Name::InitAsDefaultInstance() {
+void GetNamesResult_Name::InitAsDefaultInstance() {
 }
 
-MakeNamesRequest_Name::MakeNamesRequest_Name(const MakeNamesRequest_Name& from)
+GetNamesResult_Name::GetNamesResult_Name(const GetNamesResult_Name& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:rpc.MakeNamesRequest.Name)
+  // @@protoc_insertion_point(copy_constructor:rpc.GetNamesResult.Name)
 }
 
-void MakeNamesRequest_Name::SharedCtor() {
+void GetNamesResult_Name::SharedCtor() {
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
-  ea_ = 0u;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ea_delta_ = 0u;
+  label_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  comment_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-MakeNamesRequest_Name::~MakeNamesRequest_Name() {
-  // @@protoc_insertion_point(destructor:rpc.MakeNamesRequest.Name)
+GetNamesResult_Name::~GetNamesResult_Name() {
+  // @@protoc_insertion_point(destructor:rpc.GetNamesResult.Name)
   SharedDtor();
 }
 
-void MakeNamesRequest_Name::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete name_;
+void GetNamesResult_Name::SharedDtor() {
+  if (label_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete label_;
+  }
+  if (comment_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete comment_;
   }
   if (this != default_instance_) {
   }
 }
 
-void MakeNamesRequest_Name::SetCachedSize(int size) const {
+void GetNamesResult_Name::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* MakeNamesRequest_Name::descriptor() {
+const ::google::protobuf::Descriptor* GetNamesResult_Name::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return MakeNamesRequest_Name_descriptor_;
+  return GetNamesResult_Name_descriptor_;
 }
 
-const MakeNamesRequest_Name& MakeNamesRequest_Name::default_instance() {
+const GetNamesResult_Name& GetNamesResult_Name::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
   return *default_instance_;
 }
 
-MakeNamesRequest_Name* MakeNamesRequest_Name::default_instance_ = NULL;
+GetNamesResult_Name* GetNamesResult_Name::default_instance_ = NULL;
 
-MakeNamesRequest_Name* MakeNamesRequest_Name::New() const {
-  return new MakeNamesRequest_Name;
+GetNamesResult_Name* GetNamesResult_Name::New() const {
+  return new GetNamesResult_Name;
 }
 
-void MakeNamesRequest_Name::Clear() {
-  if (_has_bits_[0 / 32] & 3) {
-    ea_ = 0u;
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        name_->clear();
+void GetNamesResult_Name::Clear() {
+  if (_has_bits_[0 / 32] & 7) {
+    ea_delta_ = 0u;
+    if (has_label()) {
+      if (label_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        label_->clear();
+      }
+    }
+    if (has_comment()) {
+      if (comment_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        comment_->clear();
       }
     }
   }
@@ -2263,40 +5523,57 @@ void MakeNamesRequest_Name::Clear() {
   mutable_unknown_fields()->Clear();
 }
 
-bool MakeNamesRequest_Name::MergePartialFromCodedStream(
+bool GetNamesResult_Name::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:rpc.MakeNamesRequest.Name)
+  // @@protoc_insertion_point(parse_start:rpc.GetNamesResult.Name)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required uint32 ea = 1;
+      // required uint32 ea_delta = 1;
       case 1: {
         if (tag == 8) {
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &ea_)));
-          set_has_ea();
+                 input, &ea_delta_)));
+          set_has_ea_delta();
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(18)) goto parse_name;
+        if (input->ExpectTag(18)) goto parse_label;
         break;
       }
 
-      // required string name = 2;
+      // optional string label = 2;
       case 2: {
         if (tag == 18) {
-         parse_name:
+         parse_label:
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
+                input, this->mutable_label()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->name().data(), this->name().length(),
+            this->label().data(), this->label().length(),
             ::google::protobuf::internal::WireFormat::PARSE,
-            "name");
+            "label");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_comment;
+        break;
+      }
+
+      // optional string comment = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_comment:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_comment()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->comment().data(), this->comment().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "comment");
         } else {
           goto handle_unusual;
         }
@@ -2318,82 +5595,110 @@ bool MakeNamesRequest_Name::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:rpc.MakeNamesRequest.Name)
+  // @@protoc_insertion_point(parse_success:rpc.GetNamesResult.Name)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:rpc.MakeNamesRequest.Name)
+  // @@protoc_insertion_point(parse_failure:rpc.GetNamesResult.Name)
   return false;
 #undef DO_
 }
 
-void MakeNamesRequest_Name::SerializeWithCachedSizes(
+void GetNamesResult_Name::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:rpc.MakeNamesRequest.Name)
-  // required uint32 ea = 1;
-  if (has_ea()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->ea(), output);
+  // @@protoc_insertion_point(serialize_start:rpc.GetNamesResult.Name)
+  // required uint32 ea_delta = 1;
+  if (has_ea_delta()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->ea_delta(), output);
   }
 
-  // required string name = 2;
-  if (has_name()) {
+  // optional string label = 2;
+  if (has_label()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->name().data(), this->name().length(),
+      this->label().data(), this->label().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "name");
+      "label");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->name(), output);
+      2, this->label(), output);
+  }
+
+  // optional string comment = 3;
+  if (has_comment()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->comment().data(), this->comment().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "comment");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->comment(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:rpc.MakeNamesRequest.Name)
+  // @@protoc_insertion_point(serialize_end:rpc.GetNamesResult.Name)
 }
 
-::google::protobuf::uint8* MakeNamesRequest_Name::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetNamesResult_Name::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rpc.MakeNamesRequest.Name)
-  // required uint32 ea = 1;
-  if (has_ea()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->ea(), target);
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.GetNamesResult.Name)
+  // required uint32 ea_delta = 1;
+  if (has_ea_delta()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->ea_delta(), target);
   }
 
-  // required string name = 2;
-  if (has_name()) {
+  // optional string label = 2;
+  if (has_label()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->name().data(), this->name().length(),
+      this->label().data(), this->label().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "name");
+      "label");
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->name(), target);
+        2, this->label(), target);
+  }
+
+  // optional string comment = 3;
+  if (has_comment()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->comment().data(), this->comment().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "comment");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->comment(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rpc.MakeNamesRequest.Name)
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.GetNamesResult.Name)
   return target;
 }
 
-int MakeNamesRequest_Name::ByteSize() const {
+int GetNamesResult_Name::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required uint32 ea = 1;
-    if (has_ea()) {
+    // required uint32 ea_delta = 1;
+    if (has_ea_delta()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->ea());
+          this->ea_delta());
     }
 
-    // required string name = 2;
-    if (has_name()) {
+    // optional string label = 2;
+    if (has_label()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
+          this->label());
+    }
+
+    // optional string comment = 3;
+    if (has_comment()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->comment());
     }
 
   }
@@ -2408,10 +5713,10 @@ int MakeNamesRequest_Name::ByteSize() const {
   return total_size;
 }
 
-void MakeNamesRequest_Name::MergeFrom(const ::google::protobuf::Message& from) {
+void GetNamesResult_Name::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const MakeNamesRequest_Name* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MakeNamesRequest_Name*>(
+  const GetNamesResult_Name* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const GetNamesResult_Name*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -2420,52 +5725,56 @@ void MakeNamesRequest_Name::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void MakeNamesRequest_Name::MergeFrom(const MakeNamesRequest_Name& from) {
+void GetNamesResult_Name::MergeFrom(const GetNamesResult_Name& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_ea()) {
-      set_ea(from.ea());
+    if (from.has_ea_delta()) {
+      set_ea_delta(from.ea_delta());
     }
-    if (from.has_name()) {
-      set_name(from.name());
+    if (from.has_label()) {
+      set_label(from.label());
+    }
+    if (from.has_comment()) {
+      set_comment(from.comment());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void MakeNamesRequest_Name::CopyFrom(const ::google::protobuf::Message& from) {
+void GetNamesResult_Name::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void MakeNamesRequest_Name::CopyFrom(const MakeNamesRequest_Name& from) {
+void GetNamesResult_Name::CopyFrom(const GetNamesResult_Name& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool MakeNamesRequest_Name::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+bool GetNamesResult_Name::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
 
   return true;
 }
 
-void MakeNamesRequest_Name::Swap(MakeNamesRequest_Name* other) {
+void GetNamesResult_Name::Swap(GetNamesResult_Name* other) {
   if (other != this) {
-    std::swap(ea_, other->ea_);
-    std::swap(name_, other->name_);
+    std::swap(ea_delta_, other->ea_delta_);
+    std::swap(label_, other->label_);
+    std::swap(comment_, other->comment_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata MakeNamesRequest_Name::GetMetadata() const {
+::google::protobuf::Metadata GetNamesResult_Name::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MakeNamesRequest_Name_descriptor_;
-  metadata.reflection = MakeNamesRequest_Name_reflection_;
+  metadata.descriptor = GetNamesResult_Name_descriptor_;
+  metadata.reflection = GetNamesResult_Name_reflection_;
   return metadata;
 }
 
@@ -2473,97 +5782,78 @@ void MakeNamesRequest_Name::Swap(MakeNamesRequest_Name* other) {
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int MakeNamesRequest::kNamesFieldNumber;
-const int MakeNamesRequest::kBaseFieldNumber;
-const int MakeNamesRequest::kRemoteBaseFieldNumber;
+const int GetNamesResult::kNamesFieldNumber;
 #endif  // !_MSC_VER
 
-MakeNamesRequest::MakeNamesRequest()
+GetNamesResult::GetNamesResult()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:rpc.MakeNamesRequest)
+  // @@protoc_insertion_point(constructor:rpc.GetNamesResult)
 }
 
-void MakeNamesRequest::InitAsDefaultInstance() {
+void GetNamesResult::InitAsDefaultInstance() {
 }
 
-MakeNamesRequest::MakeNamesRequest(const MakeNamesRequest& from)
+GetNamesResult::GetNamesResult(const GetNamesResult& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:rpc.MakeNamesRequest)
+  // @@protoc_insertion_point(copy_constructor:rpc.GetNamesResult)
 }
 
-void MakeNamesRequest::SharedCtor() {
+void GetNamesResult::SharedCtor() {
   _cached_size_ = 0;
-  base_ = 0u;
-  remote_base_ = 0u;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-MakeNamesRequest::~MakeNamesRequest() {
-  // @@protoc_insertion_point(destructor:rpc.MakeNamesRequest)
+GetNamesResult::~GetNamesResult() {
+  // @@protoc_insertion_point(destructor:rpc.GetNamesResult)
   SharedDtor();
 }
 
-void MakeNamesRequest::SharedDtor() {
+void GetNamesResult::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void MakeNamesRequest::SetCachedSize(int size) const {
+void GetNamesResult::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* MakeNamesRequest::descriptor() {
+const ::google::protobuf::Descriptor* GetNamesResult::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return MakeNamesRequest_descriptor_;
+  return GetNamesResult_descriptor_;
 }
 
-const MakeNamesRequest& MakeNamesRequest::default_instance() {
+const GetNamesResult& GetNamesResult::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
   return *default_instance_;
 }
 
-MakeNamesRequest* MakeNamesRequest::default_instance_ = NULL;
+GetNamesResult* GetNamesResult::default_instance_ = NULL;
 
-MakeNamesRequest* MakeNamesRequest::New() const {
-  return new MakeNamesRequest;
+GetNamesResult* GetNamesResult::New() const {
+  return new GetNamesResult;
 }
 
-void MakeNamesRequest::Clear() {
-#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
-  &reinterpret_cast<MakeNamesRequest*>(16)->f) - \
-   reinterpret_cast<char*>(16))
-
-#define ZR_(first, last) do {                              \
-    size_t f = OFFSET_OF_FIELD_(first);                    \
-    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
-    ::memset(&first, 0, n);                                \
-  } while (0)
-
-  ZR_(base_, remote_base_);
-
-#undef OFFSET_OF_FIELD_
-#undef ZR_
-
+void GetNamesResult::Clear() {
   names_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool MakeNamesRequest::MergePartialFromCodedStream(
+bool GetNamesResult::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:rpc.MakeNamesRequest)
+  // @@protoc_insertion_point(parse_start:rpc.GetNamesResult)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .rpc.MakeNamesRequest.Name names = 1;
+      // repeated .rpc.GetNamesResult.Name names = 1;
       case 1: {
         if (tag == 10) {
          parse_names:
@@ -2573,36 +5863,6 @@ bool MakeNamesRequest::MergePartialFromCodedStream(
           goto handle_unusual;
         }
         if (input->ExpectTag(10)) goto parse_names;
-        if (input->ExpectTag(16)) goto parse_base;
-        break;
-      }
-
-      // required uint32 base = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_base:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &base_)));
-          set_has_base();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_remote_base;
-        break;
-      }
-
-      // required uint32 remote_base = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_remote_base:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &remote_base_)));
-          set_has_remote_base();
-        } else {
-          goto handle_unusual;
-        }
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -2621,88 +5881,52 @@ bool MakeNamesRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:rpc.MakeNamesRequest)
+  // @@protoc_insertion_point(parse_success:rpc.GetNamesResult)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:rpc.MakeNamesRequest)
+  // @@protoc_insertion_point(parse_failure:rpc.GetNamesResult)
   return false;
 #undef DO_
 }
 
-void MakeNamesRequest::SerializeWithCachedSizes(
+void GetNamesResult::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:rpc.MakeNamesRequest)
-  // repeated .rpc.MakeNamesRequest.Name names = 1;
+  // @@protoc_insertion_point(serialize_start:rpc.GetNamesResult)
+  // repeated .rpc.GetNamesResult.Name names = 1;
   for (int i = 0; i < this->names_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
       1, this->names(i), output);
   }
 
-  // required uint32 base = 2;
-  if (has_base()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->base(), output);
-  }
-
-  // required uint32 remote_base = 3;
-  if (has_remote_base()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->remote_base(), output);
-  }
-
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:rpc.MakeNamesRequest)
+  // @@protoc_insertion_point(serialize_end:rpc.GetNamesResult)
 }
 
-::google::protobuf::uint8* MakeNamesRequest::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetNamesResult::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rpc.MakeNamesRequest)
-  // repeated .rpc.MakeNamesRequest.Name names = 1;
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.GetNamesResult)
+  // repeated .rpc.GetNamesResult.Name names = 1;
   for (int i = 0; i < this->names_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->names(i), target);
-  }
-
-  // required uint32 base = 2;
-  if (has_base()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->base(), target);
-  }
-
-  // required uint32 remote_base = 3;
-  if (has_remote_base()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->remote_base(), target);
-  }
-
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:rpc.MakeNamesRequest)
-  return target;
-}
-
-int MakeNamesRequest::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[1 / 32] & (0xffu << (1 % 32))) {
-    // required uint32 base = 2;
-    if (has_base()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->base());
-    }
-
-    // required uint32 remote_base = 3;
-    if (has_remote_base()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->remote_base());
-    }
+      WriteMessageNoVirtualToArray(
+        1, this->names(i), target);
+  }
 
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
   }
-  // repeated .rpc.MakeNamesRequest.Name names = 1;
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.GetNamesResult)
+  return target;
+}
+
+int GetNamesResult::ByteSize() const {
+  int total_size = 0;
+
+  // repeated .rpc.GetNamesResult.Name names = 1;
   total_size += 1 * this->names_size();
   for (int i = 0; i < this->names_size(); i++) {
     total_size +=
@@ -2721,10 +5945,10 @@ int MakeNamesRequest::ByteSize() const {
   return total_size;
 }
 
-void MakeNamesRequest::MergeFrom(const ::google::protobuf::Message& from) {
+void GetNamesResult::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const MakeNamesRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MakeNamesRequest*>(
+  const GetNamesResult* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const GetNamesResult*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -2733,55 +5957,44 @@ void MakeNamesRequest::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void MakeNamesRequest::MergeFrom(const MakeNamesRequest& from) {
+void GetNamesResult::MergeFrom(const GetNamesResult& from) {
   GOOGLE_CHECK_NE(&from, this);
   names_.MergeFrom(from.names_);
-  if (from._has_bits_[1 / 32] & (0xffu << (1 % 32))) {
-    if (from.has_base()) {
-      set_base(from.base());
-    }
-    if (from.has_remote_base()) {
-      set_remote_base(from.remote_base());
-    }
-  }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void MakeNamesRequest::CopyFrom(const ::google::protobuf::Message& from) {
+void GetNamesResult::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void MakeNamesRequest::CopyFrom(const MakeNamesRequest& from) {
+void GetNamesResult::CopyFrom(const GetNamesResult& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool MakeNamesRequest::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000006) != 0x00000006) return false;
+bool GetNamesResult::IsInitialized() const {
 
   if (!::google::protobuf::internal::AllAreInitialized(this->names())) return false;
   return true;
 }
 
-void MakeNamesRequest::Swap(MakeNamesRequest* other) {
+void GetNamesResult::Swap(GetNamesResult* other) {
   if (other != this) {
     names_.Swap(&other->names_);
-    std::swap(base_, other->base_);
-    std::swap(remote_base_, other->remote_base_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata MakeNamesRequest::GetMetadata() const {
+::google::protobuf::Metadata GetNamesResult::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MakeNamesRequest_descriptor_;
-  metadata.reflection = MakeNamesRequest_reflection_;
+  metadata.descriptor = GetNamesResult_descriptor_;
+  metadata.reflection = GetNamesResult_reflection_;
   return metadata;
 }
 
@@ -2789,40 +6002,44 @@ void MakeNamesRequest::Swap(MakeNamesRequest* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int MakeCommentsRequest_Name::kEaFieldNumber;
-const int MakeCommentsRequest_Name::kNameFieldNumber;
+const int GetMemoryMapResult_Memory::kBaseFieldNumber;
+const int GetMemoryMapResult_Memory::kSizeFieldNumber;
+const int GetMemoryMapResult_Memory::kAccessFieldNumber;
+const int GetMemoryMapResult_Memory::kNameFieldNumber;
 #endif  // !_MSC_VER
 
-MakeCommentsRequest_Name::MakeCommentsRequest_Name()
+GetMemoryMapResult_Memory::GetMemoryMapResult_Memory()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:rpc.MakeCommentsRequest.Name)
+  // @@protoc_insertion_point(constructor:rpc.GetMemoryMapResult.Memory)
 }
 
-void MakeCommentsRequest_Name::InitAsDefaultInstance() {
+void GetMemoryMapResult_Memory::InitAsDefaultInstance() {
 }
 
-MakeCommentsRequest_Name::MakeCommentsRequest_Name(const MakeCommentsRequest_Name& from)
+GetMemoryMapResult_Memory::GetMemoryMapResult_Memory(const GetMemoryMapResult_Memory& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:rpc.MakeCommentsRequest.Name)
+  // @@protoc_insertion_point(copy_constructor:rpc.GetMemoryMapResult.Memory)
 }
 
-void MakeCommentsRequest_Name::SharedCtor() {
+void GetMemoryMapResult_Memory::SharedCtor() {
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
-  ea_ = 0u;
+  base_ = 0u;
+  size_ = 0u;
+  access_ = 0u;
   name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-MakeCommentsRequest_Name::~MakeCommentsRequest_Name() {
-  // @@protoc_insertion_point(destructor:rpc.MakeCommentsRequest.Name)
+GetMemoryMapResult_Memory::~GetMemoryMapResult_Memory() {
+  // @@protoc_insertion_point(destructor:rpc.GetMemoryMapResult.Memory)
   SharedDtor();
 }
 
-void MakeCommentsRequest_Name::SharedDtor() {
+void GetMemoryMapResult_Memory::SharedDtor() {
   if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
     delete name_;
   }
@@ -2830,67 +6047,112 @@ void MakeCommentsRequest_Name::SharedDtor() {
   }
 }
 
-void MakeCommentsRequest_Name::SetCachedSize(int size) const {
+void GetMemoryMapResult_Memory::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* MakeCommentsRequest_Name::descriptor() {
+const ::google::protobuf::Descriptor* GetMemoryMapResult_Memory::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return MakeCommentsRequest_Name_descriptor_;
+  return GetMemoryMapResult_Memory_descriptor_;
 }
 
-const MakeCommentsRequest_Name& MakeCommentsRequest_Name::default_instance() {
+const GetMemoryMapResult_Memory& GetMemoryMapResult_Memory::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
   return *default_instance_;
 }
 
-MakeCommentsRequest_Name* MakeCommentsRequest_Name::default_instance_ = NULL;
+GetMemoryMapResult_Memory* GetMemoryMapResult_Memory::default_instance_ = NULL;
 
-MakeCommentsRequest_Name* MakeCommentsRequest_Name::New() const {
-  return new MakeCommentsRequest_Name;
+GetMemoryMapResult_Memory* GetMemoryMapResult_Memory::New() const {
+  return new GetMemoryMapResult_Memory;
 }
 
-void MakeCommentsRequest_Name::Clear() {
-  if (_has_bits_[0 / 32] & 3) {
-    ea_ = 0u;
+void GetMemoryMapResult_Memory::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<GetMemoryMapResult_Memory*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  if (_has_bits_[0 / 32] & 15) {
+    ZR_(base_, size_);
+    access_ = 0u;
     if (has_name()) {
       if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
         name_->clear();
       }
     }
   }
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool MakeCommentsRequest_Name::MergePartialFromCodedStream(
+bool GetMemoryMapResult_Memory::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:rpc.MakeCommentsRequest.Name)
+  // @@protoc_insertion_point(parse_start:rpc.GetMemoryMapResult.Memory)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required uint32 ea = 1;
+      // required uint32 base = 1;
       case 1: {
         if (tag == 8) {
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &ea_)));
-          set_has_ea();
+                 input, &base_)));
+          set_has_base();
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(18)) goto parse_name;
+        if (input->ExpectTag(16)) goto parse_size;
         break;
       }
 
-      // required string name = 2;
+      // required uint32 size = 2;
       case 2: {
-        if (tag == 18) {
+        if (tag == 16) {
+         parse_size:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &size_)));
+          set_has_size();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(24)) goto parse_access;
+        break;
+      }
+
+      // required uint32 access = 3;
+      case 3: {
+        if (tag == 24) {
+         parse_access:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &access_)));
+          set_has_access();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_name;
+        break;
+      }
+
+      // required string name = 4;
+      case 4: {
+        if (tag == 34) {
          parse_name:
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
                 input, this->mutable_name()));
@@ -2919,48 +6181,68 @@ bool MakeCommentsRequest_Name::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:rpc.MakeCommentsRequest.Name)
+  // @@protoc_insertion_point(parse_success:rpc.GetMemoryMapResult.Memory)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:rpc.MakeCommentsRequest.Name)
+  // @@protoc_insertion_point(parse_failure:rpc.GetMemoryMapResult.Memory)
   return false;
 #undef DO_
 }
 
-void MakeCommentsRequest_Name::SerializeWithCachedSizes(
+void GetMemoryMapResult_Memory::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:rpc.MakeCommentsRequest.Name)
-  // required uint32 ea = 1;
-  if (has_ea()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->ea(), output);
+  // @@protoc_insertion_point(serialize_start:rpc.GetMemoryMapResult.Memory)
+  // required uint32 base = 1;
+  if (has_base()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->base(), output);
   }
 
-  // required string name = 2;
+  // required uint32 size = 2;
+  if (has_size()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->size(), output);
+  }
+
+  // required uint32 access = 3;
+  if (has_access()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->access(), output);
+  }
+
+  // required string name = 4;
   if (has_name()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
       this->name().data(), this->name().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
       "name");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->name(), output);
+      4, this->name(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:rpc.MakeCommentsRequest.Name)
+  // @@protoc_insertion_point(serialize_end:rpc.GetMemoryMapResult.Memory)
 }
 
-::google::protobuf::uint8* MakeCommentsRequest_Name::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetMemoryMapResult_Memory::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rpc.MakeCommentsRequest.Name)
-  // required uint32 ea = 1;
-  if (has_ea()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->ea(), target);
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.GetMemoryMapResult.Memory)
+  // required uint32 base = 1;
+  if (has_base()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->base(), target);
   }
 
-  // required string name = 2;
+  // required uint32 size = 2;
+  if (has_size()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->size(), target);
+  }
+
+  // required uint32 access = 3;
+  if (has_access()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->access(), target);
+  }
+
+  // required string name = 4;
   if (has_name()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
       this->name().data(), this->name().length(),
@@ -2968,29 +6250,43 @@ void MakeCommentsRequest_Name::SerializeWithCachedSizes(
       "name");
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->name(), target);
+        4, this->name(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rpc.MakeCommentsRequest.Name)
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.GetMemoryMapResult.Memory)
   return target;
 }
 
-int MakeCommentsRequest_Name::ByteSize() const {
+int GetMemoryMapResult_Memory::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required uint32 ea = 1;
-    if (has_ea()) {
+    // required uint32 base = 1;
+    if (has_base()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->ea());
+          this->base());
     }
 
-    // required string name = 2;
+    // required uint32 size = 2;
+    if (has_size()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->size());
+    }
+
+    // required uint32 access = 3;
+    if (has_access()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->access());
+    }
+
+    // required string name = 4;
     if (has_name()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::StringSize(
@@ -3009,10 +6305,10 @@ int MakeCommentsRequest_Name::ByteSize() const {
   return total_size;
 }
 
-void MakeCommentsRequest_Name::MergeFrom(const ::google::protobuf::Message& from) {
+void GetMemoryMapResult_Memory::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const MakeCommentsRequest_Name* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MakeCommentsRequest_Name*>(
+  const GetMemoryMapResult_Memory* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const GetMemoryMapResult_Memory*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -3021,11 +6317,17 @@ void MakeCommentsRequest_Name::MergeFrom(const ::google::protobuf::Message& from
   }
 }
 
-void MakeCommentsRequest_Name::MergeFrom(const MakeCommentsRequest_Name& from) {
+void GetMemoryMapResult_Memory::MergeFrom(const GetMemoryMapResult_Memory& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_ea()) {
-      set_ea(from.ea());
+    if (from.has_base()) {
+      set_base(from.base());
+    }
+    if (from.has_size()) {
+      set_size(from.size());
+    }
+    if (from.has_access()) {
+      set_access(from.access());
     }
     if (from.has_name()) {
       set_name(from.name());
@@ -3034,27 +6336,29 @@ void MakeCommentsRequest_Name::MergeFrom(const MakeCommentsRequest_Name& from) {
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void MakeCommentsRequest_Name::CopyFrom(const ::google::protobuf::Message& from) {
+void GetMemoryMapResult_Memory::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void MakeCommentsRequest_Name::CopyFrom(const MakeCommentsRequest_Name& from) {
+void GetMemoryMapResult_Memory::CopyFrom(const GetMemoryMapResult_Memory& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool MakeCommentsRequest_Name::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+bool GetMemoryMapResult_Memory::IsInitialized() const {
+  if ((_has_bits_[0] & 0x0000000f) != 0x0000000f) return false;
 
   return true;
 }
 
-void MakeCommentsRequest_Name::Swap(MakeCommentsRequest_Name* other) {
+void GetMemoryMapResult_Memory::Swap(GetMemoryMapResult_Memory* other) {
   if (other != this) {
-    std::swap(ea_, other->ea_);
+    std::swap(base_, other->base_);
+    std::swap(size_, other->size_);
+    std::swap(access_, other->access_);
     std::swap(name_, other->name_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
@@ -3062,11 +6366,11 @@ void MakeCommentsRequest_Name::Swap(MakeCommentsRequest_Name* other) {
   }
 }
 
-::google::protobuf::Metadata MakeCommentsRequest_Name::GetMetadata() const {
+::google::protobuf::Metadata GetMemoryMapResult_Memory::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MakeCommentsRequest_Name_descriptor_;
-  metadata.reflection = MakeCommentsRequest_Name_reflection_;
+  metadata.descriptor = GetMemoryMapResult_Memory_descriptor_;
+  metadata.reflection = GetMemoryMapResult_Memory_reflection_;
   return metadata;
 }
 
@@ -3074,136 +6378,87 @@ void MakeCommentsRequest_Name::Swap(MakeCommentsRequest_Name* other) {
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int MakeCommentsRequest::kNamesFieldNumber;
-const int MakeCommentsRequest::kBaseFieldNumber;
-const int MakeCommentsRequest::kRemoteBaseFieldNumber;
+const int GetMemoryMapResult::kMemoriesFieldNumber;
 #endif  // !_MSC_VER
 
-MakeCommentsRequest::MakeCommentsRequest()
+GetMemoryMapResult::GetMemoryMapResult()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:rpc.MakeCommentsRequest)
+  // @@protoc_insertion_point(constructor:rpc.GetMemoryMapResult)
 }
 
-void MakeCommentsRequest::InitAsDefaultInstance() {
+void GetMemoryMapResult::InitAsDefaultInstance() {
 }
 
-MakeCommentsRequest::MakeCommentsRequest(const MakeCommentsRequest& from)
+GetMemoryMapResult::GetMemoryMapResult(const GetMemoryMapResult& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:rpc.MakeCommentsRequest)
+  // @@protoc_insertion_point(copy_constructor:rpc.GetMemoryMapResult)
 }
 
-void MakeCommentsRequest::SharedCtor() {
+void GetMemoryMapResult::SharedCtor() {
   _cached_size_ = 0;
-  base_ = 0u;
-  remote_base_ = 0u;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-MakeCommentsRequest::~MakeCommentsRequest() {
-  // @@protoc_insertion_point(destructor:rpc.MakeCommentsRequest)
+GetMemoryMapResult::~GetMemoryMapResult() {
+  // @@protoc_insertion_point(destructor:rpc.GetMemoryMapResult)
   SharedDtor();
 }
 
-void MakeCommentsRequest::SharedDtor() {
+void GetMemoryMapResult::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void MakeCommentsRequest::SetCachedSize(int size) const {
+void GetMemoryMapResult::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* MakeCommentsRequest::descriptor() {
+const ::google::protobuf::Descriptor* GetMemoryMapResult::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return MakeCommentsRequest_descriptor_;
+  return GetMemoryMapResult_descriptor_;
 }
 
-const MakeCommentsRequest& MakeCommentsRequest::default_instance() {
+const GetMemoryMapResult& GetMemoryMapResult::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
   return *default_instance_;
 }
 
-MakeCommentsRequest* MakeCommentsRequest::default_instance_ = NULL;
+GetMemoryMapResult* GetMemoryMapResult::default_instance_ = NULL;
 
-MakeCommentsRequest* MakeCommentsRequest::New() const {
-  return new MakeCommentsRequest;
+GetMemoryMapResult* GetMemoryMapResult::New() const {
+  return new GetMemoryMapResult;
 }
 
-void MakeCommentsRequest::Clear() {
-#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
-  &reinterpret_cast<MakeCommentsRequest*>(16)->f) - \
-   reinterpret_cast<char*>(16))
-
-#define ZR_(first, last) do {                              \
-    size_t f = OFFSET_OF_FIELD_(first);                    \
-    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
-    ::memset(&first, 0, n);                                \
-  } while (0)
-
-  ZR_(base_, remote_base_);
-
-#undef OFFSET_OF_FIELD_
-#undef ZR_
-
-  names_.Clear();
+void GetMemoryMapResult::Clear() {
+  memories_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool MakeCommentsRequest::MergePartialFromCodedStream(
+bool GetMemoryMapResult::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:rpc.MakeCommentsRequest)
+  // @@protoc_insertion_point(parse_start:rpc.GetMemoryMapResult)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .rpc.MakeCommentsRequest.Name names = 1;
+      // repeated .rpc.GetMemoryMapResult.Memory memories = 1;
       case 1: {
         if (tag == 10) {
-         parse_names:
+         parse_memories:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_names()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(10)) goto parse_names;
-        if (input->ExpectTag(16)) goto parse_base;
-        break;
-      }
-
-      // required uint32 base = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_base:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &base_)));
-          set_has_base();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_remote_base;
-        break;
-      }
-
-      // required uint32 remote_base = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_remote_base:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &remote_base_)));
-          set_has_remote_base();
+                input, add_memories()));
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(10)) goto parse_memories;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -3222,93 +6477,57 @@ bool MakeCommentsRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:rpc.MakeCommentsRequest)
+  // @@protoc_insertion_point(parse_success:rpc.GetMemoryMapResult)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:rpc.MakeCommentsRequest)
+  // @@protoc_insertion_point(parse_failure:rpc.GetMemoryMapResult)
   return false;
 #undef DO_
 }
 
-void MakeCommentsRequest::SerializeWithCachedSizes(
+void GetMemoryMapResult::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:rpc.MakeCommentsRequest)
-  // repeated .rpc.MakeCommentsRequest.Name names = 1;
-  for (int i = 0; i < this->names_size(); i++) {
+  // @@protoc_insertion_point(serialize_start:rpc.GetMemoryMapResult)
+  // repeated .rpc.GetMemoryMapResult.Memory memories = 1;
+  for (int i = 0; i < this->memories_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->names(i), output);
-  }
-
-  // required uint32 base = 2;
-  if (has_base()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->base(), output);
-  }
-
-  // required uint32 remote_base = 3;
-  if (has_remote_base()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->remote_base(), output);
+      1, this->memories(i), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:rpc.MakeCommentsRequest)
+  // @@protoc_insertion_point(serialize_end:rpc.GetMemoryMapResult)
 }
 
-::google::protobuf::uint8* MakeCommentsRequest::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetMemoryMapResult::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rpc.MakeCommentsRequest)
-  // repeated .rpc.MakeCommentsRequest.Name names = 1;
-  for (int i = 0; i < this->names_size(); i++) {
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.GetMemoryMapResult)
+  // repeated .rpc.GetMemoryMapResult.Memory memories = 1;
+  for (int i = 0; i < this->memories_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        1, this->names(i), target);
-  }
-
-  // required uint32 base = 2;
-  if (has_base()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->base(), target);
-  }
-
-  // required uint32 remote_base = 3;
-  if (has_remote_base()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->remote_base(), target);
+        1, this->memories(i), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rpc.MakeCommentsRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.GetMemoryMapResult)
   return target;
 }
 
-int MakeCommentsRequest::ByteSize() const {
+int GetMemoryMapResult::ByteSize() const {
   int total_size = 0;
 
-  if (_has_bits_[1 / 32] & (0xffu << (1 % 32))) {
-    // required uint32 base = 2;
-    if (has_base()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->base());
-    }
-
-    // required uint32 remote_base = 3;
-    if (has_remote_base()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->remote_base());
-    }
-
-  }
-  // repeated .rpc.MakeCommentsRequest.Name names = 1;
-  total_size += 1 * this->names_size();
-  for (int i = 0; i < this->names_size(); i++) {
+  // repeated .rpc.GetMemoryMapResult.Memory memories = 1;
+  total_size += 1 * this->memories_size();
+  for (int i = 0; i < this->memories_size(); i++) {
     total_size +=
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->names(i));
+        this->memories(i));
   }
 
   if (!unknown_fields().empty()) {
@@ -3322,10 +6541,10 @@ int MakeCommentsRequest::ByteSize() const {
   return total_size;
 }
 
-void MakeCommentsRequest::MergeFrom(const ::google::protobuf::Message& from) {
+void GetMemoryMapResult::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const MakeCommentsRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MakeCommentsRequest*>(
+  const GetMemoryMapResult* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const GetMemoryMapResult*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -3334,55 +6553,44 @@ void MakeCommentsRequest::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void MakeCommentsRequest::MergeFrom(const MakeCommentsRequest& from) {
+void GetMemoryMapResult::MergeFrom(const GetMemoryMapResult& from) {
   GOOGLE_CHECK_NE(&from, this);
-  names_.MergeFrom(from.names_);
-  if (from._has_bits_[1 / 32] & (0xffu << (1 % 32))) {
-    if (from.has_base()) {
-      set_base(from.base());
-    }
-    if (from.has_remote_base()) {
-      set_remote_base(from.remote_base());
-    }
-  }
+  memories_.MergeFrom(from.memories_);
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void MakeCommentsRequest::CopyFrom(const ::google::protobuf::Message& from) {
+void GetMemoryMapResult::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void MakeCommentsRequest::CopyFrom(const MakeCommentsRequest& from) {
+void GetMemoryMapResult::CopyFrom(const GetMemoryMapResult& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool MakeCommentsRequest::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000006) != 0x00000006) return false;
+bool GetMemoryMapResult::IsInitialized() const {
 
-  if (!::google::protobuf::internal::AllAreInitialized(this->names())) return false;
+  if (!::google::protobuf::internal::AllAreInitialized(this->memories())) return false;
   return true;
 }
 
-void MakeCommentsRequest::Swap(MakeCommentsRequest* other) {
+void GetMemoryMapResult::Swap(GetMemoryMapResult* other) {
   if (other != this) {
-    names_.Swap(&other->names_);
-    std::swap(base_, other->base_);
-    std::swap(remote_base_, other->remote_base_);
+    memories_.Swap(&other->memories_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata MakeCommentsRequest::GetMetadata() const {
+::google::protobuf::Metadata GetMemoryMapResult::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MakeCommentsRequest_descriptor_;
-  metadata.reflection = MakeCommentsRequest_reflection_;
+  metadata.descriptor = GetMemoryMapResult_descriptor_;
+  metadata.reflection = GetMemoryMapResult_reflection_;
   return metadata;
 }
 
@@ -3390,75 +6598,68 @@ void MakeCommentsRequest::Swap(MakeCommentsRequest* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int GetMemoryMapResult_Memory::kBaseFieldNumber;
-const int GetMemoryMapResult_Memory::kSizeFieldNumber;
-const int GetMemoryMapResult_Memory::kAccessFieldNumber;
-const int GetMemoryMapResult_Memory::kNameFieldNumber;
+const int ReadMemoryRegionsRequest_Region::kAddrFieldNumber;
+const int ReadMemoryRegionsRequest_Region::kSizeFieldNumber;
+const int ReadMemoryRegionsRequest_Region::kPageHashesFieldNumber;
 #endif  // !_MSC_VER
 
-GetMemoryMapResult_Memory::GetMemoryMapResult_Memory()
+ReadMemoryRegionsRequest_Region::ReadMemoryRegionsRequest_Region()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:rpc.GetMemoryMapResult.Memory)
+  // @@protoc_insertion_point(constructor:rpc.ReadMemoryRegionsRequest.Region)
 }
 
-void GetMemoryMapResult_Memory::InitAsDefaultInstance() {
+void ReadMemoryRegionsRequest_Region::InitAsDefaultInstance() {
 }
 
-GetMemoryMapResult_Memory::GetMemoryMapResult_Memory(const GetMemoryMapResult_Memory& from)
+ReadMemoryRegionsRequest_Region::ReadMemoryRegionsRequest_Region(const ReadMemoryRegionsRequest_Region& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:rpc.GetMemoryMapResult.Memory)
+  // @@protoc_insertion_point(copy_constructor:rpc.ReadMemoryRegionsRequest.Region)
 }
 
-void GetMemoryMapResult_Memory::SharedCtor() {
-  ::google::protobuf::internal::GetEmptyString();
+void ReadMemoryRegionsRequest_Region::SharedCtor() {
   _cached_size_ = 0;
-  base_ = 0u;
+  addr_ = 0u;
   size_ = 0u;
-  access_ = 0u;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-GetMemoryMapResult_Memory::~GetMemoryMapResult_Memory() {
-  // @@protoc_insertion_point(destructor:rpc.GetMemoryMapResult.Memory)
+ReadMemoryRegionsRequest_Region::~ReadMemoryRegionsRequest_Region() {
+  // @@protoc_insertion_point(destructor:rpc.ReadMemoryRegionsRequest.Region)
   SharedDtor();
 }
 
-void GetMemoryMapResult_Memory::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete name_;
-  }
+void ReadMemoryRegionsRequest_Region::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void GetMemoryMapResult_Memory::SetCachedSize(int size) const {
+void ReadMemoryRegionsRequest_Region::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetMemoryMapResult_Memory::descriptor() {
+const ::google::protobuf::Descriptor* ReadMemoryRegionsRequest_Region::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return GetMemoryMapResult_Memory_descriptor_;
+  return ReadMemoryRegionsRequest_Region_descriptor_;
 }
 
-const GetMemoryMapResult_Memory& GetMemoryMapResult_Memory::default_instance() {
+const ReadMemoryRegionsRequest_Region& ReadMemoryRegionsRequest_Region::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
   return *default_instance_;
 }
 
-GetMemoryMapResult_Memory* GetMemoryMapResult_Memory::default_instance_ = NULL;
+ReadMemoryRegionsRequest_Region* ReadMemoryRegionsRequest_Region::default_instance_ = NULL;
 
-GetMemoryMapResult_Memory* GetMemoryMapResult_Memory::New() const {
-  return new GetMemoryMapResult_Memory;
+ReadMemoryRegionsRequest_Region* ReadMemoryRegionsRequest_Region::New() const {
+  return new ReadMemoryRegionsRequest_Region;
 }
 
-void GetMemoryMapResult_Memory::Clear() {
+void ReadMemoryRegionsRequest_Region::Clear() {
 #define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
-  &reinterpret_cast<GetMemoryMapResult_Memory*>(16)->f) - \
+  &reinterpret_cast<ReadMemoryRegionsRequest_Region*>(16)->f) - \
    reinterpret_cast<char*>(16))
 
 #define ZR_(first, last) do {                              \
@@ -3467,40 +6668,33 @@ void GetMemoryMapResult_Memory::Clear() {
     ::memset(&first, 0, n);                                \
   } while (0)
 
-  if (_has_bits_[0 / 32] & 15) {
-    ZR_(base_, size_);
-    access_ = 0u;
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        name_->clear();
-      }
-    }
-  }
+  ZR_(addr_, size_);
 
 #undef OFFSET_OF_FIELD_
 #undef ZR_
 
+  page_hashes_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool GetMemoryMapResult_Memory::MergePartialFromCodedStream(
+bool ReadMemoryRegionsRequest_Region::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:rpc.GetMemoryMapResult.Memory)
+  // @@protoc_insertion_point(parse_start:rpc.ReadMemoryRegionsRequest.Region)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required uint32 base = 1;
+      // required uint32 addr = 1;
       case 1: {
         if (tag == 8) {
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &base_)));
-          set_has_base();
+                 input, &addr_)));
+          set_has_addr();
         } else {
           goto handle_unusual;
         }
@@ -3519,35 +6713,21 @@ bool GetMemoryMapResult_Memory::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(24)) goto parse_access;
+        if (input->ExpectTag(26)) goto parse_page_hashes;
         break;
       }
 
-      // required uint32 access = 3;
+      // repeated fixed64 page_hashes = 3 [packed = true];
       case 3: {
-        if (tag == 24) {
-         parse_access:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &access_)));
-          set_has_access();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(34)) goto parse_name;
-        break;
-      }
-
-      // required string name = 4;
-      case 4: {
-        if (tag == 34) {
-         parse_name:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "name");
+        if (tag == 26) {
+         parse_page_hashes:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64>(
+                 input, this->mutable_page_hashes())));
+        } else if (tag == 25) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64>(
+                 1, 26, input, this->mutable_page_hashes())));
         } else {
           goto handle_unusual;
         }
@@ -3569,20 +6749,20 @@ bool GetMemoryMapResult_Memory::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:rpc.GetMemoryMapResult.Memory)
+  // @@protoc_insertion_point(parse_success:rpc.ReadMemoryRegionsRequest.Region)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:rpc.GetMemoryMapResult.Memory)
+  // @@protoc_insertion_point(parse_failure:rpc.ReadMemoryRegionsRequest.Region)
   return false;
 #undef DO_
 }
 
-void GetMemoryMapResult_Memory::SerializeWithCachedSizes(
+void ReadMemoryRegionsRequest_Region::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:rpc.GetMemoryMapResult.Memory)
-  // required uint32 base = 1;
-  if (has_base()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->base(), output);
+  // @@protoc_insertion_point(serialize_start:rpc.ReadMemoryRegionsRequest.Region)
+  // required uint32 addr = 1;
+  if (has_addr()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->addr(), output);
   }
 
   // required uint32 size = 2;
@@ -3590,34 +6770,29 @@ void GetMemoryMapResult_Memory::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->size(), output);
   }
 
-  // required uint32 access = 3;
-  if (has_access()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->access(), output);
+  // repeated fixed64 page_hashes = 3 [packed = true];
+  if (this->page_hashes_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(3, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_page_hashes_cached_byte_size_);
   }
-
-  // required string name = 4;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      4, this->name(), output);
+  for (int i = 0; i < this->page_hashes_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteFixed64NoTag(
+      this->page_hashes(i), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:rpc.GetMemoryMapResult.Memory)
+  // @@protoc_insertion_point(serialize_end:rpc.ReadMemoryRegionsRequest.Region)
 }
 
-::google::protobuf::uint8* GetMemoryMapResult_Memory::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ReadMemoryRegionsRequest_Region::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rpc.GetMemoryMapResult.Memory)
-  // required uint32 base = 1;
-  if (has_base()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->base(), target);
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.ReadMemoryRegionsRequest.Region)
+  // required uint32 addr = 1;
+  if (has_addr()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->addr(), target);
   }
 
   // required uint32 size = 2;
@@ -3625,39 +6800,37 @@ void GetMemoryMapResult_Memory::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->size(), target);
   }
 
-  // required uint32 access = 3;
-  if (has_access()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->access(), target);
+  // repeated fixed64 page_hashes = 3 [packed = true];
+  if (this->page_hashes_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      3,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      _page_hashes_cached_byte_size_, target);
   }
-
-  // required string name = 4;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->name(), target);
+  for (int i = 0; i < this->page_hashes_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteFixed64NoTagToArray(this->page_hashes(i), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rpc.GetMemoryMapResult.Memory)
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.ReadMemoryRegionsRequest.Region)
   return target;
 }
 
-int GetMemoryMapResult_Memory::ByteSize() const {
+int ReadMemoryRegionsRequest_Region::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required uint32 base = 1;
-    if (has_base()) {
+    // required uint32 addr = 1;
+    if (has_addr()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->base());
+          this->addr());
     }
 
     // required uint32 size = 2;
@@ -3667,21 +6840,21 @@ int GetMemoryMapResult_Memory::ByteSize() const {
           this->size());
     }
 
-    // required uint32 access = 3;
-    if (has_access()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->access());
-    }
-
-    // required string name = 4;
-    if (has_name()) {
+  }
+  // repeated fixed64 page_hashes = 3 [packed = true];
+  {
+    int data_size = 0;
+    data_size = 8 * this->page_hashes_size();
+    if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
     }
-
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _page_hashes_cached_byte_size_ = data_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
   }
+
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -3693,10 +6866,10 @@ int GetMemoryMapResult_Memory::ByteSize() const {
   return total_size;
 }
 
-void GetMemoryMapResult_Memory::MergeFrom(const ::google::protobuf::Message& from) {
+void ReadMemoryRegionsRequest_Region::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const GetMemoryMapResult_Memory* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const GetMemoryMapResult_Memory*>(
+  const ReadMemoryRegionsRequest_Region* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const ReadMemoryRegionsRequest_Region*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -3705,60 +6878,54 @@ void GetMemoryMapResult_Memory::MergeFrom(const ::google::protobuf::Message& fro
   }
 }
 
-void GetMemoryMapResult_Memory::MergeFrom(const GetMemoryMapResult_Memory& from) {
+void ReadMemoryRegionsRequest_Region::MergeFrom(const ReadMemoryRegionsRequest_Region& from) {
   GOOGLE_CHECK_NE(&from, this);
+  page_hashes_.MergeFrom(from.page_hashes_);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_base()) {
-      set_base(from.base());
+    if (from.has_addr()) {
+      set_addr(from.addr());
     }
     if (from.has_size()) {
       set_size(from.size());
     }
-    if (from.has_access()) {
-      set_access(from.access());
-    }
-    if (from.has_name()) {
-      set_name(from.name());
-    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void GetMemoryMapResult_Memory::CopyFrom(const ::google::protobuf::Message& from) {
+void ReadMemoryRegionsRequest_Region::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetMemoryMapResult_Memory::CopyFrom(const GetMemoryMapResult_Memory& from) {
+void ReadMemoryRegionsRequest_Region::CopyFrom(const ReadMemoryRegionsRequest_Region& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetMemoryMapResult_Memory::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000000f) != 0x0000000f) return false;
+bool ReadMemoryRegionsRequest_Region::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
 
   return true;
 }
 
-void GetMemoryMapResult_Memory::Swap(GetMemoryMapResult_Memory* other) {
+void ReadMemoryRegionsRequest_Region::Swap(ReadMemoryRegionsRequest_Region* other) {
   if (other != this) {
-    std::swap(base_, other->base_);
+    std::swap(addr_, other->addr_);
     std::swap(size_, other->size_);
-    std::swap(access_, other->access_);
-    std::swap(name_, other->name_);
+    page_hashes_.Swap(&other->page_hashes_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata GetMemoryMapResult_Memory::GetMetadata() const {
+::google::protobuf::Metadata ReadMemoryRegionsRequest_Region::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = GetMemoryMapResult_Memory_descriptor_;
-  metadata.reflection = GetMemoryMapResult_Memory_reflection_;
+  metadata.descriptor = ReadMemoryRegionsRequest_Region_descriptor_;
+  metadata.reflection = ReadMemoryRegionsRequest_Region_reflection_;
   return metadata;
 }
 
@@ -3766,87 +6933,105 @@ void GetMemoryMapResult_Memory::Swap(GetMemoryMapResult_Memory* other) {
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int GetMemoryMapResult::kMemoriesFieldNumber;
+const int ReadMemoryRegionsRequest::kRegionsFieldNumber;
+const int ReadMemoryRegionsRequest::kChunkSizeFieldNumber;
 #endif  // !_MSC_VER
 
-GetMemoryMapResult::GetMemoryMapResult()
+ReadMemoryRegionsRequest::ReadMemoryRegionsRequest()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:rpc.GetMemoryMapResult)
+  // @@protoc_insertion_point(constructor:rpc.ReadMemoryRegionsRequest)
 }
 
-void GetMemoryMapResult::InitAsDefaultInstance() {
+void ReadMemoryRegionsRequest::InitAsDefaultInstance() {
 }
 
-GetMemoryMapResult::GetMemoryMapResult(const GetMemoryMapResult& from)
+ReadMemoryRegionsRequest::ReadMemoryRegionsRequest(const ReadMemoryRegionsRequest& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:rpc.GetMemoryMapResult)
+  // @@protoc_insertion_point(copy_constructor:rpc.ReadMemoryRegionsRequest)
 }
 
-void GetMemoryMapResult::SharedCtor() {
+void ReadMemoryRegionsRequest::SharedCtor() {
   _cached_size_ = 0;
+  chunk_size_ = 0u;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-GetMemoryMapResult::~GetMemoryMapResult() {
-  // @@protoc_insertion_point(destructor:rpc.GetMemoryMapResult)
+ReadMemoryRegionsRequest::~ReadMemoryRegionsRequest() {
+  // @@protoc_insertion_point(destructor:rpc.ReadMemoryRegionsRequest)
   SharedDtor();
 }
 
-void GetMemoryMapResult::SharedDtor() {
+void ReadMemoryRegionsRequest::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void GetMemoryMapResult::SetCachedSize(int size) const {
+void ReadMemoryRegionsRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetMemoryMapResult::descriptor() {
+const ::google::protobuf::Descriptor* ReadMemoryRegionsRequest::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return GetMemoryMapResult_descriptor_;
+  return ReadMemoryRegionsRequest_descriptor_;
 }
 
-const GetMemoryMapResult& GetMemoryMapResult::default_instance() {
+const ReadMemoryRegionsRequest& ReadMemoryRegionsRequest::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
   return *default_instance_;
 }
 
-GetMemoryMapResult* GetMemoryMapResult::default_instance_ = NULL;
+ReadMemoryRegionsRequest* ReadMemoryRegionsRequest::default_instance_ = NULL;
 
-GetMemoryMapResult* GetMemoryMapResult::New() const {
-  return new GetMemoryMapResult;
+ReadMemoryRegionsRequest* ReadMemoryRegionsRequest::New() const {
+  return new ReadMemoryRegionsRequest;
 }
 
-void GetMemoryMapResult::Clear() {
-  memories_.Clear();
+void ReadMemoryRegionsRequest::Clear() {
+  chunk_size_ = 0u;
+  regions_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool GetMemoryMapResult::MergePartialFromCodedStream(
+bool ReadMemoryRegionsRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:rpc.GetMemoryMapResult)
+  // @@protoc_insertion_point(parse_start:rpc.ReadMemoryRegionsRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .rpc.GetMemoryMapResult.Memory memories = 1;
+      // repeated .rpc.ReadMemoryRegionsRequest.Region regions = 1;
       case 1: {
         if (tag == 10) {
-         parse_memories:
+         parse_regions:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_memories()));
+                input, add_regions()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(10)) goto parse_regions;
+        if (input->ExpectTag(16)) goto parse_chunk_size;
+        break;
+      }
+
+      // optional uint32 chunk_size = 2;
+      case 2: {
+        if (tag == 16) {
+         parse_chunk_size:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &chunk_size_)));
+          set_has_chunk_size();
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(10)) goto parse_memories;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -3865,57 +7050,76 @@ bool GetMemoryMapResult::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:rpc.GetMemoryMapResult)
+  // @@protoc_insertion_point(parse_success:rpc.ReadMemoryRegionsRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:rpc.GetMemoryMapResult)
+  // @@protoc_insertion_point(parse_failure:rpc.ReadMemoryRegionsRequest)
   return false;
 #undef DO_
 }
 
-void GetMemoryMapResult::SerializeWithCachedSizes(
+void ReadMemoryRegionsRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:rpc.GetMemoryMapResult)
-  // repeated .rpc.GetMemoryMapResult.Memory memories = 1;
-  for (int i = 0; i < this->memories_size(); i++) {
+  // @@protoc_insertion_point(serialize_start:rpc.ReadMemoryRegionsRequest)
+  // repeated .rpc.ReadMemoryRegionsRequest.Region regions = 1;
+  for (int i = 0; i < this->regions_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->memories(i), output);
+      1, this->regions(i), output);
+  }
+
+  // optional uint32 chunk_size = 2;
+  if (has_chunk_size()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->chunk_size(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:rpc.GetMemoryMapResult)
+  // @@protoc_insertion_point(serialize_end:rpc.ReadMemoryRegionsRequest)
 }
 
-::google::protobuf::uint8* GetMemoryMapResult::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ReadMemoryRegionsRequest::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rpc.GetMemoryMapResult)
-  // repeated .rpc.GetMemoryMapResult.Memory memories = 1;
-  for (int i = 0; i < this->memories_size(); i++) {
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.ReadMemoryRegionsRequest)
+  // repeated .rpc.ReadMemoryRegionsRequest.Region regions = 1;
+  for (int i = 0; i < this->regions_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        1, this->memories(i), target);
+        1, this->regions(i), target);
+  }
+
+  // optional uint32 chunk_size = 2;
+  if (has_chunk_size()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->chunk_size(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rpc.GetMemoryMapResult)
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.ReadMemoryRegionsRequest)
   return target;
 }
 
-int GetMemoryMapResult::ByteSize() const {
+int ReadMemoryRegionsRequest::ByteSize() const {
   int total_size = 0;
 
-  // repeated .rpc.GetMemoryMapResult.Memory memories = 1;
-  total_size += 1 * this->memories_size();
-  for (int i = 0; i < this->memories_size(); i++) {
+  if (_has_bits_[1 / 32] & (0xffu << (1 % 32))) {
+    // optional uint32 chunk_size = 2;
+    if (has_chunk_size()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->chunk_size());
+    }
+
+  }
+  // repeated .rpc.ReadMemoryRegionsRequest.Region regions = 1;
+  total_size += 1 * this->regions_size();
+  for (int i = 0; i < this->regions_size(); i++) {
     total_size +=
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->memories(i));
+        this->regions(i));
   }
 
   if (!unknown_fields().empty()) {
@@ -3929,10 +7133,10 @@ int GetMemoryMapResult::ByteSize() const {
   return total_size;
 }
 
-void GetMemoryMapResult::MergeFrom(const ::google::protobuf::Message& from) {
+void ReadMemoryRegionsRequest::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const GetMemoryMapResult* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const GetMemoryMapResult*>(
+  const ReadMemoryRegionsRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const ReadMemoryRegionsRequest*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -3941,44 +7145,50 @@ void GetMemoryMapResult::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void GetMemoryMapResult::MergeFrom(const GetMemoryMapResult& from) {
+void ReadMemoryRegionsRequest::MergeFrom(const ReadMemoryRegionsRequest& from) {
   GOOGLE_CHECK_NE(&from, this);
-  memories_.MergeFrom(from.memories_);
+  regions_.MergeFrom(from.regions_);
+  if (from._has_bits_[1 / 32] & (0xffu << (1 % 32))) {
+    if (from.has_chunk_size()) {
+      set_chunk_size(from.chunk_size());
+    }
+  }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void GetMemoryMapResult::CopyFrom(const ::google::protobuf::Message& from) {
+void ReadMemoryRegionsRequest::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetMemoryMapResult::CopyFrom(const GetMemoryMapResult& from) {
+void ReadMemoryRegionsRequest::CopyFrom(const ReadMemoryRegionsRequest& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetMemoryMapResult::IsInitialized() const {
+bool ReadMemoryRegionsRequest::IsInitialized() const {
 
-  if (!::google::protobuf::internal::AllAreInitialized(this->memories())) return false;
+  if (!::google::protobuf::internal::AllAreInitialized(this->regions())) return false;
   return true;
 }
 
-void GetMemoryMapResult::Swap(GetMemoryMapResult* other) {
+void ReadMemoryRegionsRequest::Swap(ReadMemoryRegionsRequest* other) {
   if (other != this) {
-    memories_.Swap(&other->memories_);
+    regions_.Swap(&other->regions_);
+    std::swap(chunk_size_, other->chunk_size_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata GetMemoryMapResult::GetMetadata() const {
+::google::protobuf::Metadata ReadMemoryRegionsRequest::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = GetMemoryMapResult_descriptor_;
-  metadata.reflection = GetMemoryMapResult_reflection_;
+  metadata.descriptor = ReadMemoryRegionsRequest_descriptor_;
+  metadata.reflection = ReadMemoryRegionsRequest_reflection_;
   return metadata;
 }
 
@@ -3986,67 +7196,77 @@ void GetMemoryMapResult::Swap(GetMemoryMapResult* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int ReadMemoryRegionsRequest_Region::kAddrFieldNumber;
-const int ReadMemoryRegionsRequest_Region::kSizeFieldNumber;
+const int ReadMemoryRegionsResult_Memory::kAddrFieldNumber;
+const int ReadMemoryRegionsResult_Memory::kSizeFieldNumber;
+const int ReadMemoryRegionsResult_Memory::kMemFieldNumber;
+const int ReadMemoryRegionsResult_Memory::kProtectFieldNumber;
+const int ReadMemoryRegionsResult_Memory::kUnchangedSizeFieldNumber;
 #endif  // !_MSC_VER
 
-ReadMemoryRegionsRequest_Region::ReadMemoryRegionsRequest_Region()
+ReadMemoryRegionsResult_Memory::ReadMemoryRegionsResult_Memory()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:rpc.ReadMemoryRegionsRequest.Region)
+  // @@protoc_insertion_point(constructor:rpc.ReadMemoryRegionsResult.Memory)
 }
 
-void ReadMemoryRegionsRequest_Region::InitAsDefaultInstance() {
+void ReadMemoryRegionsResult_Memory::InitAsDefaultInstance() {
 }
 
-ReadMemoryRegionsRequest_Region::ReadMemoryRegionsRequest_Region(const ReadMemoryRegionsRequest_Region& from)
+ReadMemoryRegionsResult_Memory::ReadMemoryRegionsResult_Memory(const ReadMemoryRegionsResult_Memory& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:rpc.ReadMemoryRegionsRequest.Region)
+  // @@protoc_insertion_point(copy_constructor:rpc.ReadMemoryRegionsResult.Memory)
 }
 
-void ReadMemoryRegionsRequest_Region::SharedCtor() {
+void ReadMemoryRegionsResult_Memory::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
   addr_ = 0u;
   size_ = 0u;
+  mem_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  protect_ = 0u;
+  unchanged_size_ = 0u;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-ReadMemoryRegionsRequest_Region::~ReadMemoryRegionsRequest_Region() {
-  // @@protoc_insertion_point(destructor:rpc.ReadMemoryRegionsRequest.Region)
+ReadMemoryRegionsResult_Memory::~ReadMemoryRegionsResult_Memory() {
+  // @@protoc_insertion_point(destructor:rpc.ReadMemoryRegionsResult.Memory)
   SharedDtor();
 }
 
-void ReadMemoryRegionsRequest_Region::SharedDtor() {
+void ReadMemoryRegionsResult_Memory::SharedDtor() {
+  if (mem_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete mem_;
+  }
   if (this != default_instance_) {
   }
 }
 
-void ReadMemoryRegionsRequest_Region::SetCachedSize(int size) const {
+void ReadMemoryRegionsResult_Memory::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ReadMemoryRegionsRequest_Region::descriptor() {
+const ::google::protobuf::Descriptor* ReadMemoryRegionsResult_Memory::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return ReadMemoryRegionsRequest_Region_descriptor_;
+  return ReadMemoryRegionsResult_Memory_descriptor_;
 }
 
-const ReadMemoryRegionsRequest_Region& ReadMemoryRegionsRequest_Region::default_instance() {
+const ReadMemoryRegionsResult_Memory& ReadMemoryRegionsResult_Memory::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
   return *default_instance_;
 }
 
-ReadMemoryRegionsRequest_Region* ReadMemoryRegionsRequest_Region::default_instance_ = NULL;
+ReadMemoryRegionsResult_Memory* ReadMemoryRegionsResult_Memory::default_instance_ = NULL;
 
-ReadMemoryRegionsRequest_Region* ReadMemoryRegionsRequest_Region::New() const {
-  return new ReadMemoryRegionsRequest_Region;
+ReadMemoryRegionsResult_Memory* ReadMemoryRegionsResult_Memory::New() const {
+  return new ReadMemoryRegionsResult_Memory;
 }
 
-void ReadMemoryRegionsRequest_Region::Clear() {
+void ReadMemoryRegionsResult_Memory::Clear() {
 #define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
-  &reinterpret_cast<ReadMemoryRegionsRequest_Region*>(16)->f) - \
+  &reinterpret_cast<ReadMemoryRegionsResult_Memory*>(16)->f) - \
    reinterpret_cast<char*>(16))
 
 #define ZR_(first, last) do {                              \
@@ -4055,7 +7275,15 @@ void ReadMemoryRegionsRequest_Region::Clear() {
     ::memset(&first, 0, n);                                \
   } while (0)
 
-  ZR_(addr_, size_);
+  if (_has_bits_[0 / 32] & 31) {
+    ZR_(addr_, size_);
+    ZR_(protect_, unchanged_size_);
+    if (has_mem()) {
+      if (mem_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        mem_->clear();
+      }
+    }
+  }
 
 #undef OFFSET_OF_FIELD_
 #undef ZR_
@@ -4064,11 +7292,11 @@ void ReadMemoryRegionsRequest_Region::Clear() {
   mutable_unknown_fields()->Clear();
 }
 
-bool ReadMemoryRegionsRequest_Region::MergePartialFromCodedStream(
+bool ReadMemoryRegionsResult_Memory::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:rpc.ReadMemoryRegionsRequest.Region)
+  // @@protoc_insertion_point(parse_start:rpc.ReadMemoryRegionsResult.Memory)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
@@ -4099,6 +7327,49 @@ bool ReadMemoryRegionsRequest_Region::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(26)) goto parse_mem;
+        break;
+      }
+
+      // required bytes mem = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_mem:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_mem()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(32)) goto parse_protect;
+        break;
+      }
+
+      // required uint32 protect = 4;
+      case 4: {
+        if (tag == 32) {
+         parse_protect:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &protect_)));
+          set_has_protect();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(40)) goto parse_unchanged_size;
+        break;
+      }
+
+      // optional uint32 unchanged_size = 5;
+      case 5: {
+        if (tag == 40) {
+         parse_unchanged_size:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &unchanged_size_)));
+          set_has_unchanged_size();
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -4117,17 +7388,17 @@ bool ReadMemoryRegionsRequest_Region::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:rpc.ReadMemoryRegionsRequest.Region)
+  // @@protoc_insertion_point(parse_success:rpc.ReadMemoryRegionsResult.Memory)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:rpc.ReadMemoryRegionsRequest.Region)
+  // @@protoc_insertion_point(parse_failure:rpc.ReadMemoryRegionsResult.Memory)
   return false;
 #undef DO_
 }
 
-void ReadMemoryRegionsRequest_Region::SerializeWithCachedSizes(
+void ReadMemoryRegionsResult_Memory::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:rpc.ReadMemoryRegionsRequest.Region)
+  // @@protoc_insertion_point(serialize_start:rpc.ReadMemoryRegionsResult.Memory)
   // required uint32 addr = 1;
   if (has_addr()) {
     ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->addr(), output);
@@ -4138,16 +7409,32 @@ void ReadMemoryRegionsRequest_Region::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->size(), output);
   }
 
+  // required bytes mem = 3;
+  if (has_mem()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      3, this->mem(), output);
+  }
+
+  // required uint32 protect = 4;
+  if (has_protect()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->protect(), output);
+  }
+
+  // optional uint32 unchanged_size = 5;
+  if (has_unchanged_size()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->unchanged_size(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:rpc.ReadMemoryRegionsRequest.Region)
+  // @@protoc_insertion_point(serialize_end:rpc.ReadMemoryRegionsResult.Memory)
 }
 
-::google::protobuf::uint8* ReadMemoryRegionsRequest_Region::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ReadMemoryRegionsResult_Memory::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rpc.ReadMemoryRegionsRequest.Region)
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.ReadMemoryRegionsResult.Memory)
   // required uint32 addr = 1;
   if (has_addr()) {
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->addr(), target);
@@ -4158,15 +7445,32 @@ void ReadMemoryRegionsRequest_Region::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->size(), target);
   }
 
+  // required bytes mem = 3;
+  if (has_mem()) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        3, this->mem(), target);
+  }
+
+  // required uint32 protect = 4;
+  if (has_protect()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->protect(), target);
+  }
+
+  // optional uint32 unchanged_size = 5;
+  if (has_unchanged_size()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(5, this->unchanged_size(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rpc.ReadMemoryRegionsRequest.Region)
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.ReadMemoryRegionsResult.Memory)
   return target;
 }
 
-int ReadMemoryRegionsRequest_Region::ByteSize() const {
+int ReadMemoryRegionsResult_Memory::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
@@ -4184,6 +7488,27 @@ int ReadMemoryRegionsRequest_Region::ByteSize() const {
           this->size());
     }
 
+    // required bytes mem = 3;
+    if (has_mem()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->mem());
+    }
+
+    // required uint32 protect = 4;
+    if (has_protect()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->protect());
+    }
+
+    // optional uint32 unchanged_size = 5;
+    if (has_unchanged_size()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->unchanged_size());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -4196,10 +7521,10 @@ int ReadMemoryRegionsRequest_Region::ByteSize() const {
   return total_size;
 }
 
-void ReadMemoryRegionsRequest_Region::MergeFrom(const ::google::protobuf::Message& from) {
+void ReadMemoryRegionsResult_Memory::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const ReadMemoryRegionsRequest_Region* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const ReadMemoryRegionsRequest_Region*>(
+  const ReadMemoryRegionsResult_Memory* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const ReadMemoryRegionsResult_Memory*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -4208,7 +7533,7 @@ void ReadMemoryRegionsRequest_Region::MergeFrom(const ::google::protobuf::Messag
   }
 }
 
-void ReadMemoryRegionsRequest_Region::MergeFrom(const ReadMemoryRegionsRequest_Region& from) {
+void ReadMemoryRegionsResult_Memory::MergeFrom(const ReadMemoryRegionsResult_Memory& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from.has_addr()) {
@@ -4217,43 +7542,55 @@ void ReadMemoryRegionsRequest_Region::MergeFrom(const ReadMemoryRegionsRequest_R
     if (from.has_size()) {
       set_size(from.size());
     }
+    if (from.has_mem()) {
+      set_mem(from.mem());
+    }
+    if (from.has_protect()) {
+      set_protect(from.protect());
+    }
+    if (from.has_unchanged_size()) {
+      set_unchanged_size(from.unchanged_size());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void ReadMemoryRegionsRequest_Region::CopyFrom(const ::google::protobuf::Message& from) {
+void ReadMemoryRegionsResult_Memory::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ReadMemoryRegionsRequest_Region::CopyFrom(const ReadMemoryRegionsRequest_Region& from) {
+void ReadMemoryRegionsResult_Memory::CopyFrom(const ReadMemoryRegionsResult_Memory& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReadMemoryRegionsRequest_Region::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+bool ReadMemoryRegionsResult_Memory::IsInitialized() const {
+  if ((_has_bits_[0] & 0x0000000f) != 0x0000000f) return false;
 
   return true;
 }
 
-void ReadMemoryRegionsRequest_Region::Swap(ReadMemoryRegionsRequest_Region* other) {
+void ReadMemoryRegionsResult_Memory::Swap(ReadMemoryRegionsResult_Memory* other) {
   if (other != this) {
     std::swap(addr_, other->addr_);
     std::swap(size_, other->size_);
+    std::swap(mem_, other->mem_);
+    std::swap(protect_, other->protect_);
+    std::swap(unchanged_size_, other->unchanged_size_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata ReadMemoryRegionsRequest_Region::GetMetadata() const {
+::google::protobuf::Metadata ReadMemoryRegionsResult_Memory::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ReadMemoryRegionsRequest_Region_descriptor_;
-  metadata.reflection = ReadMemoryRegionsRequest_Region_reflection_;
+  metadata.descriptor = ReadMemoryRegionsResult_Memory_descriptor_;
+  metadata.reflection = ReadMemoryRegionsResult_Memory_reflection_;
   return metadata;
 }
 
@@ -4261,87 +7598,87 @@ void ReadMemoryRegionsRequest_Region::Swap(ReadMemoryRegionsRequest_Region* othe
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int ReadMemoryRegionsRequest::kRegionsFieldNumber;
+const int ReadMemoryRegionsResult::kMemoriesFieldNumber;
 #endif  // !_MSC_VER
 
-ReadMemoryRegionsRequest::ReadMemoryRegionsRequest()
+ReadMemoryRegionsResult::ReadMemoryRegionsResult()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:rpc.ReadMemoryRegionsRequest)
+  // @@protoc_insertion_point(constructor:rpc.ReadMemoryRegionsResult)
 }
 
-void ReadMemoryRegionsRequest::InitAsDefaultInstance() {
+void ReadMemoryRegionsResult::InitAsDefaultInstance() {
 }
 
-ReadMemoryRegionsRequest::ReadMemoryRegionsRequest(const ReadMemoryRegionsRequest& from)
+ReadMemoryRegionsResult::ReadMemoryRegionsResult(const ReadMemoryRegionsResult& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:rpc.ReadMemoryRegionsRequest)
+  // @@protoc_insertion_point(copy_constructor:rpc.ReadMemoryRegionsResult)
 }
 
-void ReadMemoryRegionsRequest::SharedCtor() {
+void ReadMemoryRegionsResult::SharedCtor() {
   _cached_size_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-ReadMemoryRegionsRequest::~ReadMemoryRegionsRequest() {
-  // @@protoc_insertion_point(destructor:rpc.ReadMemoryRegionsRequest)
+ReadMemoryRegionsResult::~ReadMemoryRegionsResult() {
+  // @@protoc_insertion_point(destructor:rpc.ReadMemoryRegionsResult)
   SharedDtor();
 }
 
-void ReadMemoryRegionsRequest::SharedDtor() {
+void ReadMemoryRegionsResult::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void ReadMemoryRegionsRequest::SetCachedSize(int size) const {
+void ReadMemoryRegionsResult::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ReadMemoryRegionsRequest::descriptor() {
+const ::google::protobuf::Descriptor* ReadMemoryRegionsResult::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return ReadMemoryRegionsRequest_descriptor_;
+  return ReadMemoryRegionsResult_descriptor_;
 }
 
-const ReadMemoryRegionsRequest& ReadMemoryRegionsRequest::default_instance() {
+const ReadMemoryRegionsResult& ReadMemoryRegionsResult::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
   return *default_instance_;
 }
 
-ReadMemoryRegionsRequest* ReadMemoryRegionsRequest::default_instance_ = NULL;
+ReadMemoryRegionsResult* ReadMemoryRegionsResult::default_instance_ = NULL;
 
-ReadMemoryRegionsRequest* ReadMemoryRegionsRequest::New() const {
-  return new ReadMemoryRegionsRequest;
+ReadMemoryRegionsResult* ReadMemoryRegionsResult::New() const {
+  return new ReadMemoryRegionsResult;
 }
 
-void ReadMemoryRegionsRequest::Clear() {
-  regions_.Clear();
+void ReadMemoryRegionsResult::Clear() {
+  memories_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool ReadMemoryRegionsRequest::MergePartialFromCodedStream(
+bool ReadMemoryRegionsResult::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:rpc.ReadMemoryRegionsRequest)
+  // @@protoc_insertion_point(parse_start:rpc.ReadMemoryRegionsResult)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .rpc.ReadMemoryRegionsRequest.Region regions = 1;
+      // repeated .rpc.ReadMemoryRegionsResult.Memory memories = 1;
       case 1: {
         if (tag == 10) {
-         parse_regions:
+         parse_memories:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_regions()));
+                input, add_memories()));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(10)) goto parse_regions;
+        if (input->ExpectTag(10)) goto parse_memories;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -4360,57 +7697,57 @@ bool ReadMemoryRegionsRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:rpc.ReadMemoryRegionsRequest)
+  // @@protoc_insertion_point(parse_success:rpc.ReadMemoryRegionsResult)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:rpc.ReadMemoryRegionsRequest)
+  // @@protoc_insertion_point(parse_failure:rpc.ReadMemoryRegionsResult)
   return false;
 #undef DO_
 }
 
-void ReadMemoryRegionsRequest::SerializeWithCachedSizes(
+void ReadMemoryRegionsResult::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:rpc.ReadMemoryRegionsRequest)
-  // repeated .rpc.ReadMemoryRegionsRequest.Region regions = 1;
-  for (int i = 0; i < this->regions_size(); i++) {
+  // @@protoc_insertion_point(serialize_start:rpc.ReadMemoryRegionsResult)
+  // repeated .rpc.ReadMemoryRegionsResult.Memory memories = 1;
+  for (int i = 0; i < this->memories_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->regions(i), output);
+      1, this->memories(i), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:rpc.ReadMemoryRegionsRequest)
+  // @@protoc_insertion_point(serialize_end:rpc.ReadMemoryRegionsResult)
 }
 
-::google::protobuf::uint8* ReadMemoryRegionsRequest::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ReadMemoryRegionsResult::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rpc.ReadMemoryRegionsRequest)
-  // repeated .rpc.ReadMemoryRegionsRequest.Region regions = 1;
-  for (int i = 0; i < this->regions_size(); i++) {
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.ReadMemoryRegionsResult)
+  // repeated .rpc.ReadMemoryRegionsResult.Memory memories = 1;
+  for (int i = 0; i < this->memories_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        1, this->regions(i), target);
+        1, this->memories(i), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rpc.ReadMemoryRegionsRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.ReadMemoryRegionsResult)
   return target;
 }
 
-int ReadMemoryRegionsRequest::ByteSize() const {
+int ReadMemoryRegionsResult::ByteSize() const {
   int total_size = 0;
 
-  // repeated .rpc.ReadMemoryRegionsRequest.Region regions = 1;
-  total_size += 1 * this->regions_size();
-  for (int i = 0; i < this->regions_size(); i++) {
+  // repeated .rpc.ReadMemoryRegionsResult.Memory memories = 1;
+  total_size += 1 * this->memories_size();
+  for (int i = 0; i < this->memories_size(); i++) {
     total_size +=
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->regions(i));
+        this->memories(i));
   }
 
   if (!unknown_fields().empty()) {
@@ -4424,10 +7761,10 @@ int ReadMemoryRegionsRequest::ByteSize() const {
   return total_size;
 }
 
-void ReadMemoryRegionsRequest::MergeFrom(const ::google::protobuf::Message& from) {
+void ReadMemoryRegionsResult::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const ReadMemoryRegionsRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const ReadMemoryRegionsRequest*>(
+  const ReadMemoryRegionsResult* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const ReadMemoryRegionsResult*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -4436,44 +7773,44 @@ void ReadMemoryRegionsRequest::MergeFrom(const ::google::protobuf::Message& from
   }
 }
 
-void ReadMemoryRegionsRequest::MergeFrom(const ReadMemoryRegionsRequest& from) {
+void ReadMemoryRegionsResult::MergeFrom(const ReadMemoryRegionsResult& from) {
   GOOGLE_CHECK_NE(&from, this);
-  regions_.MergeFrom(from.regions_);
+  memories_.MergeFrom(from.memories_);
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void ReadMemoryRegionsRequest::CopyFrom(const ::google::protobuf::Message& from) {
+void ReadMemoryRegionsResult::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ReadMemoryRegionsRequest::CopyFrom(const ReadMemoryRegionsRequest& from) {
+void ReadMemoryRegionsResult::CopyFrom(const ReadMemoryRegionsResult& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReadMemoryRegionsRequest::IsInitialized() const {
+bool ReadMemoryRegionsResult::IsInitialized() const {
 
-  if (!::google::protobuf::internal::AllAreInitialized(this->regions())) return false;
+  if (!::google::protobuf::internal::AllAreInitialized(this->memories())) return false;
   return true;
 }
 
-void ReadMemoryRegionsRequest::Swap(ReadMemoryRegionsRequest* other) {
+void ReadMemoryRegionsResult::Swap(ReadMemoryRegionsResult* other) {
   if (other != this) {
-    regions_.Swap(&other->regions_);
+    memories_.Swap(&other->memories_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata ReadMemoryRegionsRequest::GetMetadata() const {
+::google::protobuf::Metadata ReadMemoryRegionsResult::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ReadMemoryRegionsRequest_descriptor_;
-  metadata.reflection = ReadMemoryRegionsRequest_reflection_;
+  metadata.descriptor = ReadMemoryRegionsResult_descriptor_;
+  metadata.reflection = ReadMemoryRegionsResult_reflection_;
   return metadata;
 }
 
@@ -4481,160 +7818,142 @@ void ReadMemoryRegionsRequest::Swap(ReadMemoryRegionsRequest* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int ReadMemoryRegionsResult_Memory::kAddrFieldNumber;
-const int ReadMemoryRegionsResult_Memory::kSizeFieldNumber;
-const int ReadMemoryRegionsResult_Memory::kMemFieldNumber;
-const int ReadMemoryRegionsResult_Memory::kProtectFieldNumber;
+const int OutputChunk::kRequestIdFieldNumber;
+const int OutputChunk::kStdOutFieldNumber;
+const int OutputChunk::kStdErrFieldNumber;
 #endif  // !_MSC_VER
 
-ReadMemoryRegionsResult_Memory::ReadMemoryRegionsResult_Memory()
+OutputChunk::OutputChunk()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:rpc.ReadMemoryRegionsResult.Memory)
+  // @@protoc_insertion_point(constructor:rpc.OutputChunk)
 }
 
-void ReadMemoryRegionsResult_Memory::InitAsDefaultInstance() {
+void OutputChunk::InitAsDefaultInstance() {
 }
 
-ReadMemoryRegionsResult_Memory::ReadMemoryRegionsResult_Memory(const ReadMemoryRegionsResult_Memory& from)
+OutputChunk::OutputChunk(const OutputChunk& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:rpc.ReadMemoryRegionsResult.Memory)
+  // @@protoc_insertion_point(copy_constructor:rpc.OutputChunk)
 }
 
-void ReadMemoryRegionsResult_Memory::SharedCtor() {
+void OutputChunk::SharedCtor() {
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
-  addr_ = 0u;
-  size_ = 0u;
-  mem_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  protect_ = 0u;
+  request_id_ = GOOGLE_ULONGLONG(0);
+  std_out_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  std_err_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-ReadMemoryRegionsResult_Memory::~ReadMemoryRegionsResult_Memory() {
-  // @@protoc_insertion_point(destructor:rpc.ReadMemoryRegionsResult.Memory)
+OutputChunk::~OutputChunk() {
+  // @@protoc_insertion_point(destructor:rpc.OutputChunk)
   SharedDtor();
 }
 
-void ReadMemoryRegionsResult_Memory::SharedDtor() {
-  if (mem_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete mem_;
+void OutputChunk::SharedDtor() {
+  if (std_out_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete std_out_;
+  }
+  if (std_err_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete std_err_;
   }
   if (this != default_instance_) {
   }
 }
 
-void ReadMemoryRegionsResult_Memory::SetCachedSize(int size) const {
+void OutputChunk::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ReadMemoryRegionsResult_Memory::descriptor() {
+const ::google::protobuf::Descriptor* OutputChunk::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return ReadMemoryRegionsResult_Memory_descriptor_;
+  return OutputChunk_descriptor_;
 }
 
-const ReadMemoryRegionsResult_Memory& ReadMemoryRegionsResult_Memory::default_instance() {
+const OutputChunk& OutputChunk::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
   return *default_instance_;
 }
 
-ReadMemoryRegionsResult_Memory* ReadMemoryRegionsResult_Memory::default_instance_ = NULL;
+OutputChunk* OutputChunk::default_instance_ = NULL;
 
-ReadMemoryRegionsResult_Memory* ReadMemoryRegionsResult_Memory::New() const {
-  return new ReadMemoryRegionsResult_Memory;
+OutputChunk* OutputChunk::New() const {
+  return new OutputChunk;
 }
 
-void ReadMemoryRegionsResult_Memory::Clear() {
-#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
-  &reinterpret_cast<ReadMemoryRegionsResult_Memory*>(16)->f) - \
-   reinterpret_cast<char*>(16))
-
-#define ZR_(first, last) do {                              \
-    size_t f = OFFSET_OF_FIELD_(first);                    \
-    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
-    ::memset(&first, 0, n);                                \
-  } while (0)
-
-  if (_has_bits_[0 / 32] & 15) {
-    ZR_(addr_, size_);
-    if (has_mem()) {
-      if (mem_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        mem_->clear();
+void OutputChunk::Clear() {
+  if (_has_bits_[0 / 32] & 7) {
+    request_id_ = GOOGLE_ULONGLONG(0);
+    if (has_std_out()) {
+      if (std_out_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        std_out_->clear();
+      }
+    }
+    if (has_std_err()) {
+      if (std_err_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        std_err_->clear();
       }
     }
-    protect_ = 0u;
   }
-
-#undef OFFSET_OF_FIELD_
-#undef ZR_
-
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool ReadMemoryRegionsResult_Memory::MergePartialFromCodedStream(
+bool OutputChunk::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:rpc.ReadMemoryRegionsResult.Memory)
+  // @@protoc_insertion_point(parse_start:rpc.OutputChunk)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required uint32 addr = 1;
+      // optional uint64 request_id = 1;
       case 1: {
         if (tag == 8) {
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &addr_)));
-          set_has_addr();
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &request_id_)));
+          set_has_request_id();
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(16)) goto parse_size;
+        if (input->ExpectTag(18)) goto parse_std_out;
         break;
       }
 
-      // required uint32 size = 2;
+      // optional string std_out = 2;
       case 2: {
-        if (tag == 16) {
-         parse_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &size_)));
-          set_has_size();
+        if (tag == 18) {
+         parse_std_out:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_std_out()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->std_out().data(), this->std_out().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "std_out");
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(26)) goto parse_mem;
+        if (input->ExpectTag(26)) goto parse_std_err;
         break;
       }
 
-      // required bytes mem = 3;
+      // optional string std_err = 3;
       case 3: {
         if (tag == 26) {
-         parse_mem:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_mem()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(32)) goto parse_protect;
-        break;
-      }
-
-      // required uint32 protect = 4;
-      case 4: {
-        if (tag == 32) {
-         parse_protect:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &protect_)));
-          set_has_protect();
+         parse_std_err:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_std_err()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->std_err().data(), this->std_err().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "std_err");
         } else {
           goto handle_unusual;
         }
@@ -4656,108 +7975,110 @@ bool ReadMemoryRegionsResult_Memory::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:rpc.ReadMemoryRegionsResult.Memory)
+  // @@protoc_insertion_point(parse_success:rpc.OutputChunk)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:rpc.ReadMemoryRegionsResult.Memory)
+  // @@protoc_insertion_point(parse_failure:rpc.OutputChunk)
   return false;
 #undef DO_
 }
 
-void ReadMemoryRegionsResult_Memory::SerializeWithCachedSizes(
+void OutputChunk::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:rpc.ReadMemoryRegionsResult.Memory)
-  // required uint32 addr = 1;
-  if (has_addr()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->addr(), output);
-  }
-
-  // required uint32 size = 2;
-  if (has_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->size(), output);
+  // @@protoc_insertion_point(serialize_start:rpc.OutputChunk)
+  // optional uint64 request_id = 1;
+  if (has_request_id()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->request_id(), output);
   }
 
-  // required bytes mem = 3;
-  if (has_mem()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      3, this->mem(), output);
+  // optional string std_out = 2;
+  if (has_std_out()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->std_out().data(), this->std_out().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "std_out");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->std_out(), output);
   }
 
-  // required uint32 protect = 4;
-  if (has_protect()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->protect(), output);
+  // optional string std_err = 3;
+  if (has_std_err()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->std_err().data(), this->std_err().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "std_err");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->std_err(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:rpc.ReadMemoryRegionsResult.Memory)
+  // @@protoc_insertion_point(serialize_end:rpc.OutputChunk)
 }
 
-::google::protobuf::uint8* ReadMemoryRegionsResult_Memory::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* OutputChunk::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rpc.ReadMemoryRegionsResult.Memory)
-  // required uint32 addr = 1;
-  if (has_addr()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->addr(), target);
-  }
-
-  // required uint32 size = 2;
-  if (has_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->size(), target);
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.OutputChunk)
+  // optional uint64 request_id = 1;
+  if (has_request_id()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->request_id(), target);
   }
 
-  // required bytes mem = 3;
-  if (has_mem()) {
+  // optional string std_out = 2;
+  if (has_std_out()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->std_out().data(), this->std_out().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "std_out");
     target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        3, this->mem(), target);
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->std_out(), target);
   }
 
-  // required uint32 protect = 4;
-  if (has_protect()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->protect(), target);
+  // optional string std_err = 3;
+  if (has_std_err()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->std_err().data(), this->std_err().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "std_err");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->std_err(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rpc.ReadMemoryRegionsResult.Memory)
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.OutputChunk)
   return target;
 }
 
-int ReadMemoryRegionsResult_Memory::ByteSize() const {
+int OutputChunk::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required uint32 addr = 1;
-    if (has_addr()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->addr());
-    }
-
-    // required uint32 size = 2;
-    if (has_size()) {
+    // optional uint64 request_id = 1;
+    if (has_request_id()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->size());
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->request_id());
     }
 
-    // required bytes mem = 3;
-    if (has_mem()) {
+    // optional string std_out = 2;
+    if (has_std_out()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->mem());
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->std_out());
     }
 
-    // required uint32 protect = 4;
-    if (has_protect()) {
+    // optional string std_err = 3;
+    if (has_std_err()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->protect());
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->std_err());
     }
 
   }
@@ -4772,10 +8093,10 @@ int ReadMemoryRegionsResult_Memory::ByteSize() const {
   return total_size;
 }
 
-void ReadMemoryRegionsResult_Memory::MergeFrom(const ::google::protobuf::Message& from) {
+void OutputChunk::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const ReadMemoryRegionsResult_Memory* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const ReadMemoryRegionsResult_Memory*>(
+  const OutputChunk* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const OutputChunk*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -4784,148 +8105,218 @@ void ReadMemoryRegionsResult_Memory::MergeFrom(const ::google::protobuf::Message
   }
 }
 
-void ReadMemoryRegionsResult_Memory::MergeFrom(const ReadMemoryRegionsResult_Memory& from) {
+void OutputChunk::MergeFrom(const OutputChunk& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_addr()) {
-      set_addr(from.addr());
-    }
-    if (from.has_size()) {
-      set_size(from.size());
+    if (from.has_request_id()) {
+      set_request_id(from.request_id());
     }
-    if (from.has_mem()) {
-      set_mem(from.mem());
+    if (from.has_std_out()) {
+      set_std_out(from.std_out());
     }
-    if (from.has_protect()) {
-      set_protect(from.protect());
+    if (from.has_std_err()) {
+      set_std_err(from.std_err());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void ReadMemoryRegionsResult_Memory::CopyFrom(const ::google::protobuf::Message& from) {
+void OutputChunk::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ReadMemoryRegionsResult_Memory::CopyFrom(const ReadMemoryRegionsResult_Memory& from) {
+void OutputChunk::CopyFrom(const OutputChunk& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReadMemoryRegionsResult_Memory::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000000f) != 0x0000000f) return false;
+bool OutputChunk::IsInitialized() const {
 
   return true;
 }
 
-void ReadMemoryRegionsResult_Memory::Swap(ReadMemoryRegionsResult_Memory* other) {
+void OutputChunk::Swap(OutputChunk* other) {
   if (other != this) {
-    std::swap(addr_, other->addr_);
-    std::swap(size_, other->size_);
-    std::swap(mem_, other->mem_);
-    std::swap(protect_, other->protect_);
+    std::swap(request_id_, other->request_id_);
+    std::swap(std_out_, other->std_out_);
+    std::swap(std_err_, other->std_err_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata ReadMemoryRegionsResult_Memory::GetMetadata() const {
+::google::protobuf::Metadata OutputChunk::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ReadMemoryRegionsResult_Memory_descriptor_;
-  metadata.reflection = ReadMemoryRegionsResult_Memory_reflection_;
+  metadata.descriptor = OutputChunk_descriptor_;
+  metadata.reflection = OutputChunk_reflection_;
   return metadata;
 }
 
 
-// -------------------------------------------------------------------
+// ===================================================================
 
 #ifndef _MSC_VER
-const int ReadMemoryRegionsResult::kMemoriesFieldNumber;
+const int MemoryChunk::kRequestIdFieldNumber;
+const int MemoryChunk::kRegionIndexFieldNumber;
+const int MemoryChunk::kOffsetFieldNumber;
+const int MemoryChunk::kDataFieldNumber;
 #endif  // !_MSC_VER
 
-ReadMemoryRegionsResult::ReadMemoryRegionsResult()
+MemoryChunk::MemoryChunk()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:rpc.ReadMemoryRegionsResult)
+  // @@protoc_insertion_point(constructor:rpc.MemoryChunk)
 }
 
-void ReadMemoryRegionsResult::InitAsDefaultInstance() {
+void MemoryChunk::InitAsDefaultInstance() {
 }
 
-ReadMemoryRegionsResult::ReadMemoryRegionsResult(const ReadMemoryRegionsResult& from)
+MemoryChunk::MemoryChunk(const MemoryChunk& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:rpc.ReadMemoryRegionsResult)
+  // @@protoc_insertion_point(copy_constructor:rpc.MemoryChunk)
 }
 
-void ReadMemoryRegionsResult::SharedCtor() {
+void MemoryChunk::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
+  request_id_ = GOOGLE_ULONGLONG(0);
+  region_index_ = 0u;
+  offset_ = 0u;
+  data_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-ReadMemoryRegionsResult::~ReadMemoryRegionsResult() {
-  // @@protoc_insertion_point(destructor:rpc.ReadMemoryRegionsResult)
+MemoryChunk::~MemoryChunk() {
+  // @@protoc_insertion_point(destructor:rpc.MemoryChunk)
   SharedDtor();
 }
 
-void ReadMemoryRegionsResult::SharedDtor() {
+void MemoryChunk::SharedDtor() {
+  if (data_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete data_;
+  }
   if (this != default_instance_) {
   }
 }
 
-void ReadMemoryRegionsResult::SetCachedSize(int size) const {
+void MemoryChunk::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ReadMemoryRegionsResult::descriptor() {
+const ::google::protobuf::Descriptor* MemoryChunk::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return ReadMemoryRegionsResult_descriptor_;
+  return MemoryChunk_descriptor_;
 }
 
-const ReadMemoryRegionsResult& ReadMemoryRegionsResult::default_instance() {
+const MemoryChunk& MemoryChunk::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_rpc_2eproto();
   return *default_instance_;
 }
 
-ReadMemoryRegionsResult* ReadMemoryRegionsResult::default_instance_ = NULL;
+MemoryChunk* MemoryChunk::default_instance_ = NULL;
 
-ReadMemoryRegionsResult* ReadMemoryRegionsResult::New() const {
-  return new ReadMemoryRegionsResult;
+MemoryChunk* MemoryChunk::New() const {
+  return new MemoryChunk;
 }
 
-void ReadMemoryRegionsResult::Clear() {
-  memories_.Clear();
+void MemoryChunk::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<MemoryChunk*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  if (_has_bits_[0 / 32] & 15) {
+    ZR_(request_id_, offset_);
+    if (has_data()) {
+      if (data_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        data_->clear();
+      }
+    }
+  }
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool ReadMemoryRegionsResult::MergePartialFromCodedStream(
+bool MemoryChunk::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:rpc.ReadMemoryRegionsResult)
+  // @@protoc_insertion_point(parse_start:rpc.MemoryChunk)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .rpc.ReadMemoryRegionsResult.Memory memories = 1;
+      // optional uint64 request_id = 1;
       case 1: {
-        if (tag == 10) {
-         parse_memories:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_memories()));
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &request_id_)));
+          set_has_request_id();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(16)) goto parse_region_index;
+        break;
+      }
+
+      // required uint32 region_index = 2;
+      case 2: {
+        if (tag == 16) {
+         parse_region_index:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &region_index_)));
+          set_has_region_index();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(24)) goto parse_offset;
+        break;
+      }
+
+      // required uint32 offset = 3;
+      case 3: {
+        if (tag == 24) {
+         parse_offset:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &offset_)));
+          set_has_offset();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_data;
+        break;
+      }
+
+      // required bytes data = 4;
+      case 4: {
+        if (tag == 34) {
+         parse_data:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_data()));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(10)) goto parse_memories;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -4944,59 +8335,111 @@ bool ReadMemoryRegionsResult::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:rpc.ReadMemoryRegionsResult)
+  // @@protoc_insertion_point(parse_success:rpc.MemoryChunk)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:rpc.ReadMemoryRegionsResult)
+  // @@protoc_insertion_point(parse_failure:rpc.MemoryChunk)
   return false;
 #undef DO_
 }
 
-void ReadMemoryRegionsResult::SerializeWithCachedSizes(
+void MemoryChunk::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:rpc.ReadMemoryRegionsResult)
-  // repeated .rpc.ReadMemoryRegionsResult.Memory memories = 1;
-  for (int i = 0; i < this->memories_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->memories(i), output);
+  // @@protoc_insertion_point(serialize_start:rpc.MemoryChunk)
+  // optional uint64 request_id = 1;
+  if (has_request_id()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->request_id(), output);
+  }
+
+  // required uint32 region_index = 2;
+  if (has_region_index()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->region_index(), output);
+  }
+
+  // required uint32 offset = 3;
+  if (has_offset()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->offset(), output);
+  }
+
+  // required bytes data = 4;
+  if (has_data()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      4, this->data(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:rpc.ReadMemoryRegionsResult)
+  // @@protoc_insertion_point(serialize_end:rpc.MemoryChunk)
 }
 
-::google::protobuf::uint8* ReadMemoryRegionsResult::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* MemoryChunk::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:rpc.ReadMemoryRegionsResult)
-  // repeated .rpc.ReadMemoryRegionsResult.Memory memories = 1;
-  for (int i = 0; i < this->memories_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->memories(i), target);
+  // @@protoc_insertion_point(serialize_to_array_start:rpc.MemoryChunk)
+  // optional uint64 request_id = 1;
+  if (has_request_id()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->request_id(), target);
+  }
+
+  // required uint32 region_index = 2;
+  if (has_region_index()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->region_index(), target);
+  }
+
+  // required uint32 offset = 3;
+  if (has_offset()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->offset(), target);
+  }
+
+  // required bytes data = 4;
+  if (has_data()) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        4, this->data(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:rpc.ReadMemoryRegionsResult)
+  // @@protoc_insertion_point(serialize_to_array_end:rpc.MemoryChunk)
   return target;
 }
 
-int ReadMemoryRegionsResult::ByteSize() const {
+int MemoryChunk::ByteSize() const {
   int total_size = 0;
 
-  // repeated .rpc.ReadMemoryRegionsResult.Memory memories = 1;
-  total_size += 1 * this->memories_size();
-  for (int i = 0; i < this->memories_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->memories(i));
-  }
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional uint64 request_id = 1;
+    if (has_request_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->request_id());
+    }
+
+    // required uint32 region_index = 2;
+    if (has_region_index()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->region_index());
+    }
+
+    // required uint32 offset = 3;
+    if (has_offset()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->offset());
+    }
+
+    // required bytes data = 4;
+    if (has_data()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->data());
+    }
 
+  }
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -5008,10 +8451,10 @@ int ReadMemoryRegionsResult::ByteSize() const {
   return total_size;
 }
 
-void ReadMemoryRegionsResult::MergeFrom(const ::google::protobuf::Message& from) {
+void MemoryChunk::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const ReadMemoryRegionsResult* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const ReadMemoryRegionsResult*>(
+  const MemoryChunk* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const MemoryChunk*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -5020,44 +8463,60 @@ void ReadMemoryRegionsResult::MergeFrom(const ::google::protobuf::Message& from)
   }
 }
 
-void ReadMemoryRegionsResult::MergeFrom(const ReadMemoryRegionsResult& from) {
+void MemoryChunk::MergeFrom(const MemoryChunk& from) {
   GOOGLE_CHECK_NE(&from, this);
-  memories_.MergeFrom(from.memories_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_request_id()) {
+      set_request_id(from.request_id());
+    }
+    if (from.has_region_index()) {
+      set_region_index(from.region_index());
+    }
+    if (from.has_offset()) {
+      set_offset(from.offset());
+    }
+    if (from.has_data()) {
+      set_data(from.data());
+    }
+  }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void ReadMemoryRegionsResult::CopyFrom(const ::google::protobuf::Message& from) {
+void MemoryChunk::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ReadMemoryRegionsResult::CopyFrom(const ReadMemoryRegionsResult& from) {
+void MemoryChunk::CopyFrom(const MemoryChunk& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReadMemoryRegionsResult::IsInitialized() const {
+bool MemoryChunk::IsInitialized() const {
+  if ((_has_bits_[0] & 0x0000000e) != 0x0000000e) return false;
 
-  if (!::google::protobuf::internal::AllAreInitialized(this->memories())) return false;
   return true;
 }
 
-void ReadMemoryRegionsResult::Swap(ReadMemoryRegionsResult* other) {
+void MemoryChunk::Swap(MemoryChunk* other) {
   if (other != this) {
-    memories_.Swap(&other->memories_);
+    std::swap(request_id_, other->request_id_);
+    std::swap(region_index_, other->region_index_);
+    std::swap(offset_, other->offset_);
+    std::swap(data_, other->data_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata ReadMemoryRegionsResult::GetMetadata() const {
+::google::protobuf::Metadata MemoryChunk::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ReadMemoryRegionsResult_descriptor_;
-  metadata.reflection = ReadMemoryRegionsResult_reflection_;
+  metadata.descriptor = MemoryChunk_descriptor_;
+  metadata.reflection = MemoryChunk_reflection_;
   return metadata;
 }
 
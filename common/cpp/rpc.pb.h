@@ -35,18 +35,26 @@ void protobuf_AssignDesc_rpc_2eproto();
 void protobuf_ShutdownFile_rpc_2eproto();
 
 class RpcRequest;
+class Relocation;
+class Hello;
 class Execute;
 class Response;
+class PackedNames;
 class MakeNamesRequest;
 class MakeNamesRequest_Name;
 class MakeCommentsRequest;
 class MakeCommentsRequest_Name;
+class GetNamesRequest;
+class GetNamesResult;
+class GetNamesResult_Name;
 class GetMemoryMapResult;
 class GetMemoryMapResult_Memory;
 class ReadMemoryRegionsRequest;
 class ReadMemoryRegionsRequest_Region;
 class ReadMemoryRegionsResult;
 class ReadMemoryRegionsResult_Memory;
+class OutputChunk;
+class MemoryChunk;
 class AnalyzeExternalRefsRequest;
 class AnalyzeExternalRefsResult;
 class AnalyzeExternalRefsResult_PointerData;
@@ -64,11 +72,12 @@ enum RpcRequest_RequestType {
   RpcRequest_RequestType_RPCT_GET_MEMORY_MAP = 3,
   RpcRequest_RequestType_RPCT_READ_MEMORY_REGIONS = 4,
   RpcRequest_RequestType_RPCT_ANALYZE_EXTERNAL_REFS = 5,
-  RpcRequest_RequestType_RPCT_CHECK_PE_HEADERS = 6
+  RpcRequest_RequestType_RPCT_CHECK_PE_HEADERS = 6,
+  RpcRequest_RequestType_RPCT_GET_NAMES = 7
 };
 bool RpcRequest_RequestType_IsValid(int value);
 const RpcRequest_RequestType RpcRequest_RequestType_RequestType_MIN = RpcRequest_RequestType_RPCT_UNKNOWN;
-const RpcRequest_RequestType RpcRequest_RequestType_RequestType_MAX = RpcRequest_RequestType_RPCT_CHECK_PE_HEADERS;
+const RpcRequest_RequestType RpcRequest_RequestType_RequestType_MAX = RpcRequest_RequestType_RPCT_GET_NAMES;
 const int RpcRequest_RequestType_RequestType_ARRAYSIZE = RpcRequest_RequestType_RequestType_MAX + 1;
 
 const ::google::protobuf::EnumDescriptor* RpcRequest_RequestType_descriptor();
@@ -181,6 +190,7 @@ class RpcRequest : public ::google::protobuf::Message {
   static const RequestType RPCT_READ_MEMORY_REGIONS = RpcRequest_RequestType_RPCT_READ_MEMORY_REGIONS;
   static const RequestType RPCT_ANALYZE_EXTERNAL_REFS = RpcRequest_RequestType_RPCT_ANALYZE_EXTERNAL_REFS;
   static const RequestType RPCT_CHECK_PE_HEADERS = RpcRequest_RequestType_RPCT_CHECK_PE_HEADERS;
+  static const RequestType RPCT_GET_NAMES = RpcRequest_RequestType_RPCT_GET_NAMES;
   static inline bool RequestType_IsValid(int value) {
     return RpcRequest_RequestType_IsValid(value);
   }
@@ -256,6 +266,15 @@ class RpcRequest : public ::google::protobuf::Message {
   inline ::rpc::CheckPEHeadersRequest* release_check_pe_headers_req();
   inline void set_allocated_check_pe_headers_req(::rpc::CheckPEHeadersRequest* check_pe_headers_req);
 
+  // optional .rpc.GetNamesRequest get_names_req = 7;
+  inline bool has_get_names_req() const;
+  inline void clear_get_names_req();
+  static const int kGetNamesReqFieldNumber = 7;
+  inline const ::rpc::GetNamesRequest& get_names_req() const;
+  inline ::rpc::GetNamesRequest* mutable_get_names_req();
+  inline ::rpc::GetNamesRequest* release_get_names_req();
+  inline void set_allocated_get_names_req(::rpc::GetNamesRequest* get_names_req);
+
   // @@protoc_insertion_point(class_scope:rpc.RpcRequest)
  private:
   inline void set_has_request_type();
@@ -270,6 +289,8 @@ class RpcRequest : public ::google::protobuf::Message {
   inline void clear_has_analyze_external_refs_req();
   inline void set_has_check_pe_headers_req();
   inline void clear_has_check_pe_headers_req();
+  inline void set_has_get_names_req();
+  inline void clear_has_get_names_req();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -280,6 +301,7 @@ class RpcRequest : public ::google::protobuf::Message {
   ::rpc::ReadMemoryRegionsRequest* read_memory_regions_req_;
   ::rpc::AnalyzeExternalRefsRequest* analyze_external_refs_req_;
   ::rpc::CheckPEHeadersRequest* check_pe_headers_req_;
+  ::rpc::GetNamesRequest* get_names_req_;
   int request_type_;
   friend void  protobuf_AddDesc_rpc_2eproto();
   friend void protobuf_AssignDesc_rpc_2eproto();
@@ -290,6 +312,222 @@ class RpcRequest : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
+class Relocation : public ::google::protobuf::Message {
+ public:
+  Relocation();
+  virtual ~Relocation();
+
+  Relocation(const Relocation& from);
+
+  inline Relocation& operator=(const Relocation& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const Relocation& default_instance();
+
+  void Swap(Relocation* other);
+
+  // implements Message ----------------------------------------------
+
+  Relocation* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const Relocation& from);
+  void MergeFrom(const Relocation& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required uint32 start = 1;
+  inline bool has_start() const;
+  inline void clear_start();
+  static const int kStartFieldNumber = 1;
+  inline ::google::protobuf::uint32 start() const;
+  inline void set_start(::google::protobuf::uint32 value);
+
+  // required uint32 end = 2;
+  inline bool has_end() const;
+  inline void clear_end();
+  static const int kEndFieldNumber = 2;
+  inline ::google::protobuf::uint32 end() const;
+  inline void set_end(::google::protobuf::uint32 value);
+
+  // required uint32 remote_start = 3;
+  inline bool has_remote_start() const;
+  inline void clear_remote_start();
+  static const int kRemoteStartFieldNumber = 3;
+  inline ::google::protobuf::uint32 remote_start() const;
+  inline void set_remote_start(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:rpc.Relocation)
+ private:
+  inline void set_has_start();
+  inline void clear_has_start();
+  inline void set_has_end();
+  inline void clear_has_end();
+  inline void set_has_remote_start();
+  inline void clear_has_remote_start();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 start_;
+  ::google::protobuf::uint32 end_;
+  ::google::protobuf::uint32 remote_start_;
+  friend void  protobuf_AddDesc_rpc_2eproto();
+  friend void protobuf_AssignDesc_rpc_2eproto();
+  friend void protobuf_ShutdownFile_rpc_2eproto();
+
+  void InitAsDefaultInstance();
+  static Relocation* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class Hello : public ::google::protobuf::Message {
+ public:
+  Hello();
+  virtual ~Hello();
+
+  Hello(const Hello& from);
+
+  inline Hello& operator=(const Hello& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const Hello& default_instance();
+
+  void Swap(Hello* other);
+
+  // implements Message ----------------------------------------------
+
+  Hello* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const Hello& from);
+  void MergeFrom(const Hello& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required uint32 protocol_version = 1;
+  inline bool has_protocol_version() const;
+  inline void clear_protocol_version();
+  static const int kProtocolVersionFieldNumber = 1;
+  inline ::google::protobuf::uint32 protocol_version() const;
+  inline void set_protocol_version(::google::protobuf::uint32 value);
+
+  // optional string labeless_version = 2;
+  inline bool has_labeless_version() const;
+  inline void clear_labeless_version();
+  static const int kLabelessVersionFieldNumber = 2;
+  inline const ::std::string& labeless_version() const;
+  inline void set_labeless_version(const ::std::string& value);
+  inline void set_labeless_version(const char* value);
+  inline void set_labeless_version(const char* value, size_t size);
+  inline ::std::string* mutable_labeless_version();
+  inline ::std::string* release_labeless_version();
+  inline void set_allocated_labeless_version(::std::string* labeless_version);
+
+  // optional uint32 codecs = 3;
+  inline bool has_codecs() const;
+  inline void clear_codecs();
+  static const int kCodecsFieldNumber = 3;
+  inline ::google::protobuf::uint32 codecs() const;
+  inline void set_codecs(::google::protobuf::uint32 value);
+
+  // repeated .rpc.Relocation relocations = 4;
+  inline int relocations_size() const;
+  inline void clear_relocations();
+  static const int kRelocationsFieldNumber = 4;
+  inline const ::rpc::Relocation& relocations(int index) const;
+  inline ::rpc::Relocation* mutable_relocations(int index);
+  inline ::rpc::Relocation* add_relocations();
+  inline const ::google::protobuf::RepeatedPtrField< ::rpc::Relocation >&
+      relocations() const;
+  inline ::google::protobuf::RepeatedPtrField< ::rpc::Relocation >*
+      mutable_relocations();
+
+  // @@protoc_insertion_point(class_scope:rpc.Hello)
+ private:
+  inline void set_has_protocol_version();
+  inline void clear_has_protocol_version();
+  inline void set_has_labeless_version();
+  inline void clear_has_labeless_version();
+  inline void set_has_codecs();
+  inline void clear_has_codecs();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::std::string* labeless_version_;
+  ::google::protobuf::uint32 protocol_version_;
+  ::google::protobuf::uint32 codecs_;
+  ::google::protobuf::RepeatedPtrField< ::rpc::Relocation > relocations_;
+  friend void  protobuf_AddDesc_rpc_2eproto();
+  friend void protobuf_AssignDesc_rpc_2eproto();
+  friend void protobuf_ShutdownFile_rpc_2eproto();
+
+  void InitAsDefaultInstance();
+  static Hello* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class Execute : public ::google::protobuf::Message {
  public:
   Execute();
@@ -393,6 +631,25 @@ class Execute : public ::google::protobuf::Message {
   inline ::google::protobuf::uint64 job_id() const;
   inline void set_job_id(::google::protobuf::uint64 value);
 
+  // optional uint64 request_id = 6;
+  inline bool has_request_id() const;
+  inline void clear_request_id();
+  static const int kRequestIdFieldNumber = 6;
+  inline ::google::protobuf::uint64 request_id() const;
+  inline void set_request_id(::google::protobuf::uint64 value);
+
+  // optional bytes script_extern_marshal = 7;
+  inline bool has_script_extern_marshal() const;
+  inline void clear_script_extern_marshal();
+  static const int kScriptExternMarshalFieldNumber = 7;
+  inline const ::std::string& script_extern_marshal() const;
+  inline void set_script_extern_marshal(const ::std::string& value);
+  inline void set_script_extern_marshal(const char* value);
+  inline void set_script_extern_marshal(const void* value, size_t size);
+  inline ::std::string* mutable_script_extern_marshal();
+  inline ::std::string* release_script_extern_marshal();
+  inline void set_allocated_script_extern_marshal(::std::string* script_extern_marshal);
+
   // @@protoc_insertion_point(class_scope:rpc.Execute)
  private:
   inline void set_has_script();
@@ -405,6 +662,10 @@ class Execute : public ::google::protobuf::Message {
   inline void clear_has_background();
   inline void set_has_job_id();
   inline void clear_has_job_id();
+  inline void set_has_request_id();
+  inline void clear_has_request_id();
+  inline void set_has_script_extern_marshal();
+  inline void clear_has_script_extern_marshal();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -414,6 +675,8 @@ class Execute : public ::google::protobuf::Message {
   ::std::string* script_extern_obj_;
   ::std::string* rpc_request_;
   ::google::protobuf::uint64 job_id_;
+  ::google::protobuf::uint64 request_id_;
+  ::std::string* script_extern_marshal_;
   bool background_;
   friend void  protobuf_AddDesc_rpc_2eproto();
   friend void protobuf_AssignDesc_rpc_2eproto();
@@ -563,6 +826,13 @@ class Response : public ::google::protobuf::Message {
   inline ::rpc::Response_JobStatus job_status() const;
   inline void set_job_status(::rpc::Response_JobStatus value);
 
+  // optional uint64 request_id = 7;
+  inline bool has_request_id() const;
+  inline void clear_request_id();
+  static const int kRequestIdFieldNumber = 7;
+  inline ::google::protobuf::uint64 request_id() const;
+  inline void set_request_id(::google::protobuf::uint64 value);
+
   // @@protoc_insertion_point(class_scope:rpc.Response)
  private:
   inline void set_has_job_id();
@@ -577,6 +847,8 @@ class Response : public ::google::protobuf::Message {
   inline void clear_has_rpc_result();
   inline void set_has_job_status();
   inline void clear_has_job_status();
+  inline void set_has_request_id();
+  inline void clear_has_request_id();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -587,6 +859,7 @@ class Response : public ::google::protobuf::Message {
   ::std::string* std_err_;
   ::std::string* error_;
   ::std::string* rpc_result_;
+  ::google::protobuf::uint64 request_id_;
   int job_status_;
   friend void  protobuf_AddDesc_rpc_2eproto();
   friend void protobuf_AssignDesc_rpc_2eproto();
@@ -597,6 +870,132 @@ class Response : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
+class PackedNames : public ::google::protobuf::Message {
+ public:
+  PackedNames();
+  virtual ~PackedNames();
+
+  PackedNames(const PackedNames& from);
+
+  inline PackedNames& operator=(const PackedNames& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const PackedNames& default_instance();
+
+  void Swap(PackedNames* other);
+
+  // implements Message ----------------------------------------------
+
+  PackedNames* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const PackedNames& from);
+  void MergeFrom(const PackedNames& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated uint32 ea_deltas = 1 [packed = true];
+  inline int ea_deltas_size() const;
+  inline void clear_ea_deltas();
+  static const int kEaDeltasFieldNumber = 1;
+  inline ::google::protobuf::uint32 ea_deltas(int index) const;
+  inline void set_ea_deltas(int index, ::google::protobuf::uint32 value);
+  inline void add_ea_deltas(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      ea_deltas() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_ea_deltas();
+
+  // repeated uint32 shared_sizes = 2 [packed = true];
+  inline int shared_sizes_size() const;
+  inline void clear_shared_sizes();
+  static const int kSharedSizesFieldNumber = 2;
+  inline ::google::protobuf::uint32 shared_sizes(int index) const;
+  inline void set_shared_sizes(int index, ::google::protobuf::uint32 value);
+  inline void add_shared_sizes(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      shared_sizes() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_shared_sizes();
+
+  // repeated uint32 suffix_sizes = 3 [packed = true];
+  inline int suffix_sizes_size() const;
+  inline void clear_suffix_sizes();
+  static const int kSuffixSizesFieldNumber = 3;
+  inline ::google::protobuf::uint32 suffix_sizes(int index) const;
+  inline void set_suffix_sizes(int index, ::google::protobuf::uint32 value);
+  inline void add_suffix_sizes(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      suffix_sizes() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_suffix_sizes();
+
+  // optional bytes suffixes = 4;
+  inline bool has_suffixes() const;
+  inline void clear_suffixes();
+  static const int kSuffixesFieldNumber = 4;
+  inline const ::std::string& suffixes() const;
+  inline void set_suffixes(const ::std::string& value);
+  inline void set_suffixes(const char* value);
+  inline void set_suffixes(const void* value, size_t size);
+  inline ::std::string* mutable_suffixes();
+  inline ::std::string* release_suffixes();
+  inline void set_allocated_suffixes(::std::string* suffixes);
+
+  // @@protoc_insertion_point(class_scope:rpc.PackedNames)
+ private:
+  inline void set_has_suffixes();
+  inline void clear_has_suffixes();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > ea_deltas_;
+  mutable int _ea_deltas_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > shared_sizes_;
+  mutable int _shared_sizes_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > suffix_sizes_;
+  mutable int _suffix_sizes_cached_byte_size_;
+  ::std::string* suffixes_;
+  friend void  protobuf_AddDesc_rpc_2eproto();
+  friend void protobuf_AssignDesc_rpc_2eproto();
+  friend void protobuf_ShutdownFile_rpc_2eproto();
+
+  void InitAsDefaultInstance();
+  static PackedNames* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class MakeNamesRequest_Name : public ::google::protobuf::Message {
  public:
   MakeNamesRequest_Name();
@@ -772,12 +1171,23 @@ class MakeNamesRequest : public ::google::protobuf::Message {
   inline ::google::protobuf::uint32 remote_base() const;
   inline void set_remote_base(::google::protobuf::uint32 value);
 
+  // optional .rpc.PackedNames packed_names = 4;
+  inline bool has_packed_names() const;
+  inline void clear_packed_names();
+  static const int kPackedNamesFieldNumber = 4;
+  inline const ::rpc::PackedNames& packed_names() const;
+  inline ::rpc::PackedNames* mutable_packed_names();
+  inline ::rpc::PackedNames* release_packed_names();
+  inline void set_allocated_packed_names(::rpc::PackedNames* packed_names);
+
   // @@protoc_insertion_point(class_scope:rpc.MakeNamesRequest)
  private:
   inline void set_has_base();
   inline void clear_has_base();
   inline void set_has_remote_base();
   inline void clear_has_remote_base();
+  inline void set_has_packed_names();
+  inline void clear_has_packed_names();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -786,6 +1196,7 @@ class MakeNamesRequest : public ::google::protobuf::Message {
   ::google::protobuf::RepeatedPtrField< ::rpc::MakeNamesRequest_Name > names_;
   ::google::protobuf::uint32 base_;
   ::google::protobuf::uint32 remote_base_;
+  ::rpc::PackedNames* packed_names_;
   friend void  protobuf_AddDesc_rpc_2eproto();
   friend void protobuf_AssignDesc_rpc_2eproto();
   friend void protobuf_ShutdownFile_rpc_2eproto();
@@ -970,12 +1381,23 @@ class MakeCommentsRequest : public ::google::protobuf::Message {
   inline ::google::protobuf::uint32 remote_base() const;
   inline void set_remote_base(::google::protobuf::uint32 value);
 
+  // optional .rpc.PackedNames packed_names = 4;
+  inline bool has_packed_names() const;
+  inline void clear_packed_names();
+  static const int kPackedNamesFieldNumber = 4;
+  inline const ::rpc::PackedNames& packed_names() const;
+  inline ::rpc::PackedNames* mutable_packed_names();
+  inline ::rpc::PackedNames* release_packed_names();
+  inline void set_allocated_packed_names(::rpc::PackedNames* packed_names);
+
   // @@protoc_insertion_point(class_scope:rpc.MakeCommentsRequest)
  private:
   inline void set_has_base();
   inline void clear_has_base();
   inline void set_has_remote_base();
   inline void clear_has_remote_base();
+  inline void set_has_packed_names();
+  inline void clear_has_packed_names();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -984,6 +1406,7 @@ class MakeCommentsRequest : public ::google::protobuf::Message {
   ::google::protobuf::RepeatedPtrField< ::rpc::MakeCommentsRequest_Name > names_;
   ::google::protobuf::uint32 base_;
   ::google::protobuf::uint32 remote_base_;
+  ::rpc::PackedNames* packed_names_;
   friend void  protobuf_AddDesc_rpc_2eproto();
   friend void protobuf_AssignDesc_rpc_2eproto();
   friend void protobuf_ShutdownFile_rpc_2eproto();
@@ -993,14 +1416,14 @@ class MakeCommentsRequest : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class GetMemoryMapResult_Memory : public ::google::protobuf::Message {
+class GetNamesRequest : public ::google::protobuf::Message {
  public:
-  GetMemoryMapResult_Memory();
-  virtual ~GetMemoryMapResult_Memory();
+  GetNamesRequest();
+  virtual ~GetNamesRequest();
 
-  GetMemoryMapResult_Memory(const GetMemoryMapResult_Memory& from);
+  GetNamesRequest(const GetNamesRequest& from);
 
-  inline GetMemoryMapResult_Memory& operator=(const GetMemoryMapResult_Memory& from) {
+  inline GetNamesRequest& operator=(const GetNamesRequest& from) {
     CopyFrom(from);
     return *this;
   }
@@ -1014,17 +1437,17 @@ class GetMemoryMapResult_Memory : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const GetMemoryMapResult_Memory& default_instance();
+  static const GetNamesRequest& default_instance();
 
-  void Swap(GetMemoryMapResult_Memory* other);
+  void Swap(GetNamesRequest* other);
 
   // implements Message ----------------------------------------------
 
-  GetMemoryMapResult_Memory* New() const;
+  GetNamesRequest* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const GetMemoryMapResult_Memory& from);
-  void MergeFrom(const GetMemoryMapResult_Memory& from);
+  void CopyFrom(const GetNamesRequest& from);
+  void MergeFrom(const GetNamesRequest& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -1053,68 +1476,83 @@ class GetMemoryMapResult_Memory : public ::google::protobuf::Message {
   inline ::google::protobuf::uint32 base() const;
   inline void set_base(::google::protobuf::uint32 value);
 
-  // required uint32 size = 2;
-  inline bool has_size() const;
-  inline void clear_size();
-  static const int kSizeFieldNumber = 2;
-  inline ::google::protobuf::uint32 size() const;
-  inline void set_size(::google::protobuf::uint32 value);
-
-  // required uint32 access = 3;
-  inline bool has_access() const;
-  inline void clear_access();
-  static const int kAccessFieldNumber = 3;
-  inline ::google::protobuf::uint32 access() const;
-  inline void set_access(::google::protobuf::uint32 value);
-
-  // required string name = 4;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 4;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
+  // required uint32 remote_base = 2;
+  inline bool has_remote_base() const;
+  inline void clear_remote_base();
+  static const int kRemoteBaseFieldNumber = 2;
+  inline ::google::protobuf::uint32 remote_base() const;
+  inline void set_remote_base(::google::protobuf::uint32 value);
 
-  // @@protoc_insertion_point(class_scope:rpc.GetMemoryMapResult.Memory)
+  // required uint32 start = 3;
+  inline bool has_start() const;
+  inline void clear_start();
+  static const int kStartFieldNumber = 3;
+  inline ::google::protobuf::uint32 start() const;
+  inline void set_start(::google::protobuf::uint32 value);
+
+  // required uint32 end = 4;
+  inline bool has_end() const;
+  inline void clear_end();
+  static const int kEndFieldNumber = 4;
+  inline ::google::protobuf::uint32 end() const;
+  inline void set_end(::google::protobuf::uint32 value);
+
+  // optional bool labels = 5 [default = true];
+  inline bool has_labels() const;
+  inline void clear_labels();
+  static const int kLabelsFieldNumber = 5;
+  inline bool labels() const;
+  inline void set_labels(bool value);
+
+  // optional bool comments = 6 [default = true];
+  inline bool has_comments() const;
+  inline void clear_comments();
+  static const int kCommentsFieldNumber = 6;
+  inline bool comments() const;
+  inline void set_comments(bool value);
+
+  // @@protoc_insertion_point(class_scope:rpc.GetNamesRequest)
  private:
   inline void set_has_base();
   inline void clear_has_base();
-  inline void set_has_size();
-  inline void clear_has_size();
-  inline void set_has_access();
-  inline void clear_has_access();
-  inline void set_has_name();
-  inline void clear_has_name();
+  inline void set_has_remote_base();
+  inline void clear_has_remote_base();
+  inline void set_has_start();
+  inline void clear_has_start();
+  inline void set_has_end();
+  inline void clear_has_end();
+  inline void set_has_labels();
+  inline void clear_has_labels();
+  inline void set_has_comments();
+  inline void clear_has_comments();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::uint32 _has_bits_[1];
   mutable int _cached_size_;
   ::google::protobuf::uint32 base_;
-  ::google::protobuf::uint32 size_;
-  ::std::string* name_;
-  ::google::protobuf::uint32 access_;
+  ::google::protobuf::uint32 remote_base_;
+  ::google::protobuf::uint32 start_;
+  ::google::protobuf::uint32 end_;
+  bool labels_;
+  bool comments_;
   friend void  protobuf_AddDesc_rpc_2eproto();
   friend void protobuf_AssignDesc_rpc_2eproto();
   friend void protobuf_ShutdownFile_rpc_2eproto();
 
   void InitAsDefaultInstance();
-  static GetMemoryMapResult_Memory* default_instance_;
+  static GetNamesRequest* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class GetMemoryMapResult : public ::google::protobuf::Message {
+class GetNamesResult_Name : public ::google::protobuf::Message {
  public:
-  GetMemoryMapResult();
-  virtual ~GetMemoryMapResult();
+  GetNamesResult_Name();
+  virtual ~GetNamesResult_Name();
 
-  GetMemoryMapResult(const GetMemoryMapResult& from);
+  GetNamesResult_Name(const GetNamesResult_Name& from);
 
-  inline GetMemoryMapResult& operator=(const GetMemoryMapResult& from) {
+  inline GetNamesResult_Name& operator=(const GetNamesResult_Name& from) {
     CopyFrom(from);
     return *this;
   }
@@ -1128,17 +1566,17 @@ class GetMemoryMapResult : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const GetMemoryMapResult& default_instance();
+  static const GetNamesResult_Name& default_instance();
 
-  void Swap(GetMemoryMapResult* other);
+  void Swap(GetNamesResult_Name* other);
 
   // implements Message ----------------------------------------------
 
-  GetMemoryMapResult* New() const;
+  GetNamesResult_Name* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const GetMemoryMapResult& from);
-  void MergeFrom(const GetMemoryMapResult& from);
+  void CopyFrom(const GetNamesResult_Name& from);
+  void MergeFrom(const GetNamesResult_Name& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -1158,36 +1596,343 @@ class GetMemoryMapResult : public ::google::protobuf::Message {
 
   // nested types ----------------------------------------------------
 
-  typedef GetMemoryMapResult_Memory Memory;
-
   // accessors -------------------------------------------------------
 
-  // repeated .rpc.GetMemoryMapResult.Memory memories = 1;
-  inline int memories_size() const;
-  inline void clear_memories();
-  static const int kMemoriesFieldNumber = 1;
-  inline const ::rpc::GetMemoryMapResult_Memory& memories(int index) const;
-  inline ::rpc::GetMemoryMapResult_Memory* mutable_memories(int index);
-  inline ::rpc::GetMemoryMapResult_Memory* add_memories();
-  inline const ::google::protobuf::RepeatedPtrField< ::rpc::GetMemoryMapResult_Memory >&
-      memories() const;
-  inline ::google::protobuf::RepeatedPtrField< ::rpc::GetMemoryMapResult_Memory >*
-      mutable_memories();
-
-  // @@protoc_insertion_point(class_scope:rpc.GetMemoryMapResult)
+  // required uint32 ea_delta = 1;
+  inline bool has_ea_delta() const;
+  inline void clear_ea_delta();
+  static const int kEaDeltaFieldNumber = 1;
+  inline ::google::protobuf::uint32 ea_delta() const;
+  inline void set_ea_delta(::google::protobuf::uint32 value);
+
+  // optional string label = 2;
+  inline bool has_label() const;
+  inline void clear_label();
+  static const int kLabelFieldNumber = 2;
+  inline const ::std::string& label() const;
+  inline void set_label(const ::std::string& value);
+  inline void set_label(const char* value);
+  inline void set_label(const char* value, size_t size);
+  inline ::std::string* mutable_label();
+  inline ::std::string* release_label();
+  inline void set_allocated_label(::std::string* label);
+
+  // optional string comment = 3;
+  inline bool has_comment() const;
+  inline void clear_comment();
+  static const int kCommentFieldNumber = 3;
+  inline const ::std::string& comment() const;
+  inline void set_comment(const ::std::string& value);
+  inline void set_comment(const char* value);
+  inline void set_comment(const char* value, size_t size);
+  inline ::std::string* mutable_comment();
+  inline ::std::string* release_comment();
+  inline void set_allocated_comment(::std::string* comment);
+
+  // @@protoc_insertion_point(class_scope:rpc.GetNamesResult.Name)
  private:
+  inline void set_has_ea_delta();
+  inline void clear_has_ea_delta();
+  inline void set_has_label();
+  inline void clear_has_label();
+  inline void set_has_comment();
+  inline void clear_has_comment();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::uint32 _has_bits_[1];
   mutable int _cached_size_;
-  ::google::protobuf::RepeatedPtrField< ::rpc::GetMemoryMapResult_Memory > memories_;
+  ::std::string* label_;
+  ::std::string* comment_;
+  ::google::protobuf::uint32 ea_delta_;
   friend void  protobuf_AddDesc_rpc_2eproto();
   friend void protobuf_AssignDesc_rpc_2eproto();
   friend void protobuf_ShutdownFile_rpc_2eproto();
 
   void InitAsDefaultInstance();
-  static GetMemoryMapResult* default_instance_;
+  static GetNamesResult_Name* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class GetNamesResult : public ::google::protobuf::Message {
+ public:
+  GetNamesResult();
+  virtual ~GetNamesResult();
+
+  GetNamesResult(const GetNamesResult& from);
+
+  inline GetNamesResult& operator=(const GetNamesResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const GetNamesResult& default_instance();
+
+  void Swap(GetNamesResult* other);
+
+  // implements Message ----------------------------------------------
+
+  GetNamesResult* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const GetNamesResult& from);
+  void MergeFrom(const GetNamesResult& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  typedef GetNamesResult_Name Name;
+
+  // accessors -------------------------------------------------------
+
+  // repeated .rpc.GetNamesResult.Name names = 1;
+  inline int names_size() const;
+  inline void clear_names();
+  static const int kNamesFieldNumber = 1;
+  inline const ::rpc::GetNamesResult_Name& names(int index) const;
+  inline ::rpc::GetNamesResult_Name* mutable_names(int index);
+  inline ::rpc::GetNamesResult_Name* add_names();
+  inline const ::google::protobuf::RepeatedPtrField< ::rpc::GetNamesResult_Name >&
+      names() const;
+  inline ::google::protobuf::RepeatedPtrField< ::rpc::GetNamesResult_Name >*
+      mutable_names();
+
+  // @@protoc_insertion_point(class_scope:rpc.GetNamesResult)
+ private:
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedPtrField< ::rpc::GetNamesResult_Name > names_;
+  friend void  protobuf_AddDesc_rpc_2eproto();
+  friend void protobuf_AssignDesc_rpc_2eproto();
+  friend void protobuf_ShutdownFile_rpc_2eproto();
+
+  void InitAsDefaultInstance();
+  static GetNamesResult* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class GetMemoryMapResult_Memory : public ::google::protobuf::Message {
+ public:
+  GetMemoryMapResult_Memory();
+  virtual ~GetMemoryMapResult_Memory();
+
+  GetMemoryMapResult_Memory(const GetMemoryMapResult_Memory& from);
+
+  inline GetMemoryMapResult_Memory& operator=(const GetMemoryMapResult_Memory& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const GetMemoryMapResult_Memory& default_instance();
+
+  void Swap(GetMemoryMapResult_Memory* other);
+
+  // implements Message ----------------------------------------------
+
+  GetMemoryMapResult_Memory* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const GetMemoryMapResult_Memory& from);
+  void MergeFrom(const GetMemoryMapResult_Memory& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required uint32 base = 1;
+  inline bool has_base() const;
+  inline void clear_base();
+  static const int kBaseFieldNumber = 1;
+  inline ::google::protobuf::uint32 base() const;
+  inline void set_base(::google::protobuf::uint32 value);
+
+  // required uint32 size = 2;
+  inline bool has_size() const;
+  inline void clear_size();
+  static const int kSizeFieldNumber = 2;
+  inline ::google::protobuf::uint32 size() const;
+  inline void set_size(::google::protobuf::uint32 value);
+
+  // required uint32 access = 3;
+  inline bool has_access() const;
+  inline void clear_access();
+  static const int kAccessFieldNumber = 3;
+  inline ::google::protobuf::uint32 access() const;
+  inline void set_access(::google::protobuf::uint32 value);
+
+  // required string name = 4;
+  inline bool has_name() const;
+  inline void clear_name();
+  static const int kNameFieldNumber = 4;
+  inline const ::std::string& name() const;
+  inline void set_name(const ::std::string& value);
+  inline void set_name(const char* value);
+  inline void set_name(const char* value, size_t size);
+  inline ::std::string* mutable_name();
+  inline ::std::string* release_name();
+  inline void set_allocated_name(::std::string* name);
+
+  // @@protoc_insertion_point(class_scope:rpc.GetMemoryMapResult.Memory)
+ private:
+  inline void set_has_base();
+  inline void clear_has_base();
+  inline void set_has_size();
+  inline void clear_has_size();
+  inline void set_has_access();
+  inline void clear_has_access();
+  inline void set_has_name();
+  inline void clear_has_name();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 base_;
+  ::google::protobuf::uint32 size_;
+  ::std::string* name_;
+  ::google::protobuf::uint32 access_;
+  friend void  protobuf_AddDesc_rpc_2eproto();
+  friend void protobuf_AssignDesc_rpc_2eproto();
+  friend void protobuf_ShutdownFile_rpc_2eproto();
+
+  void InitAsDefaultInstance();
+  static GetMemoryMapResult_Memory* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class GetMemoryMapResult : public ::google::protobuf::Message {
+ public:
+  GetMemoryMapResult();
+  virtual ~GetMemoryMapResult();
+
+  GetMemoryMapResult(const GetMemoryMapResult& from);
+
+  inline GetMemoryMapResult& operator=(const GetMemoryMapResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const GetMemoryMapResult& default_instance();
+
+  void Swap(GetMemoryMapResult* other);
+
+  // implements Message ----------------------------------------------
+
+  GetMemoryMapResult* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const GetMemoryMapResult& from);
+  void MergeFrom(const GetMemoryMapResult& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  typedef GetMemoryMapResult_Memory Memory;
+
+  // accessors -------------------------------------------------------
+
+  // repeated .rpc.GetMemoryMapResult.Memory memories = 1;
+  inline int memories_size() const;
+  inline void clear_memories();
+  static const int kMemoriesFieldNumber = 1;
+  inline const ::rpc::GetMemoryMapResult_Memory& memories(int index) const;
+  inline ::rpc::GetMemoryMapResult_Memory* mutable_memories(int index);
+  inline ::rpc::GetMemoryMapResult_Memory* add_memories();
+  inline const ::google::protobuf::RepeatedPtrField< ::rpc::GetMemoryMapResult_Memory >&
+      memories() const;
+  inline ::google::protobuf::RepeatedPtrField< ::rpc::GetMemoryMapResult_Memory >*
+      mutable_memories();
+
+  // @@protoc_insertion_point(class_scope:rpc.GetMemoryMapResult)
+ private:
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedPtrField< ::rpc::GetMemoryMapResult_Memory > memories_;
+  friend void  protobuf_AddDesc_rpc_2eproto();
+  friend void protobuf_AssignDesc_rpc_2eproto();
+  friend void protobuf_ShutdownFile_rpc_2eproto();
+
+  void InitAsDefaultInstance();
+  static GetMemoryMapResult* default_instance_;
 };
 // -------------------------------------------------------------------
 
@@ -1258,6 +2003,18 @@ class ReadMemoryRegionsRequest_Region : public ::google::protobuf::Message {
   inline ::google::protobuf::uint32 size() const;
   inline void set_size(::google::protobuf::uint32 value);
 
+  // repeated fixed64 page_hashes = 3 [packed = true];
+  inline int page_hashes_size() const;
+  inline void clear_page_hashes();
+  static const int kPageHashesFieldNumber = 3;
+  inline ::google::protobuf::uint64 page_hashes(int index) const;
+  inline void set_page_hashes(int index, ::google::protobuf::uint64 value);
+  inline void add_page_hashes(::google::protobuf::uint64 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      page_hashes() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_page_hashes();
+
   // @@protoc_insertion_point(class_scope:rpc.ReadMemoryRegionsRequest.Region)
  private:
   inline void set_has_addr();
@@ -1271,6 +2028,8 @@ class ReadMemoryRegionsRequest_Region : public ::google::protobuf::Message {
   mutable int _cached_size_;
   ::google::protobuf::uint32 addr_;
   ::google::protobuf::uint32 size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > page_hashes_;
+  mutable int _page_hashes_cached_byte_size_;
   friend void  protobuf_AddDesc_rpc_2eproto();
   friend void protobuf_AssignDesc_rpc_2eproto();
   friend void protobuf_ShutdownFile_rpc_2eproto();
@@ -1347,14 +2106,24 @@ class ReadMemoryRegionsRequest : public ::google::protobuf::Message {
   inline ::google::protobuf::RepeatedPtrField< ::rpc::ReadMemoryRegionsRequest_Region >*
       mutable_regions();
 
+  // optional uint32 chunk_size = 2;
+  inline bool has_chunk_size() const;
+  inline void clear_chunk_size();
+  static const int kChunkSizeFieldNumber = 2;
+  inline ::google::protobuf::uint32 chunk_size() const;
+  inline void set_chunk_size(::google::protobuf::uint32 value);
+
   // @@protoc_insertion_point(class_scope:rpc.ReadMemoryRegionsRequest)
  private:
+  inline void set_has_chunk_size();
+  inline void clear_has_chunk_size();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::uint32 _has_bits_[1];
   mutable int _cached_size_;
   ::google::protobuf::RepeatedPtrField< ::rpc::ReadMemoryRegionsRequest_Region > regions_;
+  ::google::protobuf::uint32 chunk_size_;
   friend void  protobuf_AddDesc_rpc_2eproto();
   friend void protobuf_AssignDesc_rpc_2eproto();
   friend void protobuf_ShutdownFile_rpc_2eproto();
@@ -1369,9 +2138,217 @@ class ReadMemoryRegionsResult_Memory : public ::google::protobuf::Message {
   ReadMemoryRegionsResult_Memory();
   virtual ~ReadMemoryRegionsResult_Memory();
 
-  ReadMemoryRegionsResult_Memory(const ReadMemoryRegionsResult_Memory& from);
+  ReadMemoryRegionsResult_Memory(const ReadMemoryRegionsResult_Memory& from);
+
+  inline ReadMemoryRegionsResult_Memory& operator=(const ReadMemoryRegionsResult_Memory& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const ReadMemoryRegionsResult_Memory& default_instance();
+
+  void Swap(ReadMemoryRegionsResult_Memory* other);
+
+  // implements Message ----------------------------------------------
+
+  ReadMemoryRegionsResult_Memory* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const ReadMemoryRegionsResult_Memory& from);
+  void MergeFrom(const ReadMemoryRegionsResult_Memory& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required uint32 addr = 1;
+  inline bool has_addr() const;
+  inline void clear_addr();
+  static const int kAddrFieldNumber = 1;
+  inline ::google::protobuf::uint32 addr() const;
+  inline void set_addr(::google::protobuf::uint32 value);
+
+  // required uint32 size = 2;
+  inline bool has_size() const;
+  inline void clear_size();
+  static const int kSizeFieldNumber = 2;
+  inline ::google::protobuf::uint32 size() const;
+  inline void set_size(::google::protobuf::uint32 value);
+
+  // required bytes mem = 3;
+  inline bool has_mem() const;
+  inline void clear_mem();
+  static const int kMemFieldNumber = 3;
+  inline const ::std::string& mem() const;
+  inline void set_mem(const ::std::string& value);
+  inline void set_mem(const char* value);
+  inline void set_mem(const void* value, size_t size);
+  inline ::std::string* mutable_mem();
+  inline ::std::string* release_mem();
+  inline void set_allocated_mem(::std::string* mem);
+
+  // required uint32 protect = 4;
+  inline bool has_protect() const;
+  inline void clear_protect();
+  static const int kProtectFieldNumber = 4;
+  inline ::google::protobuf::uint32 protect() const;
+  inline void set_protect(::google::protobuf::uint32 value);
+
+  // optional uint32 unchanged_size = 5;
+  inline bool has_unchanged_size() const;
+  inline void clear_unchanged_size();
+  static const int kUnchangedSizeFieldNumber = 5;
+  inline ::google::protobuf::uint32 unchanged_size() const;
+  inline void set_unchanged_size(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:rpc.ReadMemoryRegionsResult.Memory)
+ private:
+  inline void set_has_addr();
+  inline void clear_has_addr();
+  inline void set_has_size();
+  inline void clear_has_size();
+  inline void set_has_mem();
+  inline void clear_has_mem();
+  inline void set_has_protect();
+  inline void clear_has_protect();
+  inline void set_has_unchanged_size();
+  inline void clear_has_unchanged_size();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 addr_;
+  ::google::protobuf::uint32 size_;
+  ::std::string* mem_;
+  ::google::protobuf::uint32 protect_;
+  ::google::protobuf::uint32 unchanged_size_;
+  friend void  protobuf_AddDesc_rpc_2eproto();
+  friend void protobuf_AssignDesc_rpc_2eproto();
+  friend void protobuf_ShutdownFile_rpc_2eproto();
+
+  void InitAsDefaultInstance();
+  static ReadMemoryRegionsResult_Memory* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class ReadMemoryRegionsResult : public ::google::protobuf::Message {
+ public:
+  ReadMemoryRegionsResult();
+  virtual ~ReadMemoryRegionsResult();
+
+  ReadMemoryRegionsResult(const ReadMemoryRegionsResult& from);
+
+  inline ReadMemoryRegionsResult& operator=(const ReadMemoryRegionsResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const ReadMemoryRegionsResult& default_instance();
+
+  void Swap(ReadMemoryRegionsResult* other);
+
+  // implements Message ----------------------------------------------
+
+  ReadMemoryRegionsResult* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const ReadMemoryRegionsResult& from);
+  void MergeFrom(const ReadMemoryRegionsResult& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  typedef ReadMemoryRegionsResult_Memory Memory;
+
+  // accessors -------------------------------------------------------
+
+  // repeated .rpc.ReadMemoryRegionsResult.Memory memories = 1;
+  inline int memories_size() const;
+  inline void clear_memories();
+  static const int kMemoriesFieldNumber = 1;
+  inline const ::rpc::ReadMemoryRegionsResult_Memory& memories(int index) const;
+  inline ::rpc::ReadMemoryRegionsResult_Memory* mutable_memories(int index);
+  inline ::rpc::ReadMemoryRegionsResult_Memory* add_memories();
+  inline const ::google::protobuf::RepeatedPtrField< ::rpc::ReadMemoryRegionsResult_Memory >&
+      memories() const;
+  inline ::google::protobuf::RepeatedPtrField< ::rpc::ReadMemoryRegionsResult_Memory >*
+      mutable_memories();
+
+  // @@protoc_insertion_point(class_scope:rpc.ReadMemoryRegionsResult)
+ private:
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedPtrField< ::rpc::ReadMemoryRegionsResult_Memory > memories_;
+  friend void  protobuf_AddDesc_rpc_2eproto();
+  friend void protobuf_AssignDesc_rpc_2eproto();
+  friend void protobuf_ShutdownFile_rpc_2eproto();
+
+  void InitAsDefaultInstance();
+  static ReadMemoryRegionsResult* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class OutputChunk : public ::google::protobuf::Message {
+ public:
+  OutputChunk();
+  virtual ~OutputChunk();
+
+  OutputChunk(const OutputChunk& from);
 
-  inline ReadMemoryRegionsResult_Memory& operator=(const ReadMemoryRegionsResult_Memory& from) {
+  inline OutputChunk& operator=(const OutputChunk& from) {
     CopyFrom(from);
     return *this;
   }
@@ -1385,17 +2362,17 @@ class ReadMemoryRegionsResult_Memory : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const ReadMemoryRegionsResult_Memory& default_instance();
+  static const OutputChunk& default_instance();
 
-  void Swap(ReadMemoryRegionsResult_Memory* other);
+  void Swap(OutputChunk* other);
 
   // implements Message ----------------------------------------------
 
-  ReadMemoryRegionsResult_Memory* New() const;
+  OutputChunk* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ReadMemoryRegionsResult_Memory& from);
-  void MergeFrom(const ReadMemoryRegionsResult_Memory& from);
+  void CopyFrom(const OutputChunk& from);
+  void MergeFrom(const OutputChunk& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -1417,75 +2394,70 @@ class ReadMemoryRegionsResult_Memory : public ::google::protobuf::Message {
 
   // accessors -------------------------------------------------------
 
-  // required uint32 addr = 1;
-  inline bool has_addr() const;
-  inline void clear_addr();
-  static const int kAddrFieldNumber = 1;
-  inline ::google::protobuf::uint32 addr() const;
-  inline void set_addr(::google::protobuf::uint32 value);
-
-  // required uint32 size = 2;
-  inline bool has_size() const;
-  inline void clear_size();
-  static const int kSizeFieldNumber = 2;
-  inline ::google::protobuf::uint32 size() const;
-  inline void set_size(::google::protobuf::uint32 value);
+  // optional uint64 request_id = 1;
+  inline bool has_request_id() const;
+  inline void clear_request_id();
+  static const int kRequestIdFieldNumber = 1;
+  inline ::google::protobuf::uint64 request_id() const;
+  inline void set_request_id(::google::protobuf::uint64 value);
 
-  // required bytes mem = 3;
-  inline bool has_mem() const;
-  inline void clear_mem();
-  static const int kMemFieldNumber = 3;
-  inline const ::std::string& mem() const;
-  inline void set_mem(const ::std::string& value);
-  inline void set_mem(const char* value);
-  inline void set_mem(const void* value, size_t size);
-  inline ::std::string* mutable_mem();
-  inline ::std::string* release_mem();
-  inline void set_allocated_mem(::std::string* mem);
+  // optional string std_out = 2;
+  inline bool has_std_out() const;
+  inline void clear_std_out();
+  static const int kStdOutFieldNumber = 2;
+  inline const ::std::string& std_out() const;
+  inline void set_std_out(const ::std::string& value);
+  inline void set_std_out(const char* value);
+  inline void set_std_out(const char* value, size_t size);
+  inline ::std::string* mutable_std_out();
+  inline ::std::string* release_std_out();
+  inline void set_allocated_std_out(::std::string* std_out);
 
-  // required uint32 protect = 4;
-  inline bool has_protect() const;
-  inline void clear_protect();
-  static const int kProtectFieldNumber = 4;
-  inline ::google::protobuf::uint32 protect() const;
-  inline void set_protect(::google::protobuf::uint32 value);
+  // optional string std_err = 3;
+  inline bool has_std_err() const;
+  inline void clear_std_err();
+  static const int kStdErrFieldNumber = 3;
+  inline const ::std::string& std_err() const;
+  inline void set_std_err(const ::std::string& value);
+  inline void set_std_err(const char* value);
+  inline void set_std_err(const char* value, size_t size);
+  inline ::std::string* mutable_std_err();
+  inline ::std::string* release_std_err();
+  inline void set_allocated_std_err(::std::string* std_err);
 
-  // @@protoc_insertion_point(class_scope:rpc.ReadMemoryRegionsResult.Memory)
+  // @@protoc_insertion_point(class_scope:rpc.OutputChunk)
  private:
-  inline void set_has_addr();
-  inline void clear_has_addr();
-  inline void set_has_size();
-  inline void clear_has_size();
-  inline void set_has_mem();
-  inline void clear_has_mem();
-  inline void set_has_protect();
-  inline void clear_has_protect();
+  inline void set_has_request_id();
+  inline void clear_has_request_id();
+  inline void set_has_std_out();
+  inline void clear_has_std_out();
+  inline void set_has_std_err();
+  inline void clear_has_std_err();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::uint32 _has_bits_[1];
   mutable int _cached_size_;
-  ::google::protobuf::uint32 addr_;
-  ::google::protobuf::uint32 size_;
-  ::std::string* mem_;
-  ::google::protobuf::uint32 protect_;
+  ::google::protobuf::uint64 request_id_;
+  ::std::string* std_out_;
+  ::std::string* std_err_;
   friend void  protobuf_AddDesc_rpc_2eproto();
   friend void protobuf_AssignDesc_rpc_2eproto();
   friend void protobuf_ShutdownFile_rpc_2eproto();
 
   void InitAsDefaultInstance();
-  static ReadMemoryRegionsResult_Memory* default_instance_;
+  static OutputChunk* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class ReadMemoryRegionsResult : public ::google::protobuf::Message {
+class MemoryChunk : public ::google::protobuf::Message {
  public:
-  ReadMemoryRegionsResult();
-  virtual ~ReadMemoryRegionsResult();
+  MemoryChunk();
+  virtual ~MemoryChunk();
 
-  ReadMemoryRegionsResult(const ReadMemoryRegionsResult& from);
+  MemoryChunk(const MemoryChunk& from);
 
-  inline ReadMemoryRegionsResult& operator=(const ReadMemoryRegionsResult& from) {
+  inline MemoryChunk& operator=(const MemoryChunk& from) {
     CopyFrom(from);
     return *this;
   }
@@ -1499,17 +2471,17 @@ class ReadMemoryRegionsResult : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const ReadMemoryRegionsResult& default_instance();
+  static const MemoryChunk& default_instance();
 
-  void Swap(ReadMemoryRegionsResult* other);
+  void Swap(MemoryChunk* other);
 
   // implements Message ----------------------------------------------
 
-  ReadMemoryRegionsResult* New() const;
+  MemoryChunk* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ReadMemoryRegionsResult& from);
-  void MergeFrom(const ReadMemoryRegionsResult& from);
+  void CopyFrom(const MemoryChunk& from);
+  void MergeFrom(const MemoryChunk& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -1529,36 +2501,66 @@ class ReadMemoryRegionsResult : public ::google::protobuf::Message {
 
   // nested types ----------------------------------------------------
 
-  typedef ReadMemoryRegionsResult_Memory Memory;
-
   // accessors -------------------------------------------------------
 
-  // repeated .rpc.ReadMemoryRegionsResult.Memory memories = 1;
-  inline int memories_size() const;
-  inline void clear_memories();
-  static const int kMemoriesFieldNumber = 1;
-  inline const ::rpc::ReadMemoryRegionsResult_Memory& memories(int index) const;
-  inline ::rpc::ReadMemoryRegionsResult_Memory* mutable_memories(int index);
-  inline ::rpc::ReadMemoryRegionsResult_Memory* add_memories();
-  inline const ::google::protobuf::RepeatedPtrField< ::rpc::ReadMemoryRegionsResult_Memory >&
-      memories() const;
-  inline ::google::protobuf::RepeatedPtrField< ::rpc::ReadMemoryRegionsResult_Memory >*
-      mutable_memories();
-
-  // @@protoc_insertion_point(class_scope:rpc.ReadMemoryRegionsResult)
+  // optional uint64 request_id = 1;
+  inline bool has_request_id() const;
+  inline void clear_request_id();
+  static const int kRequestIdFieldNumber = 1;
+  inline ::google::protobuf::uint64 request_id() const;
+  inline void set_request_id(::google::protobuf::uint64 value);
+
+  // required uint32 region_index = 2;
+  inline bool has_region_index() const;
+  inline void clear_region_index();
+  static const int kRegionIndexFieldNumber = 2;
+  inline ::google::protobuf::uint32 region_index() const;
+  inline void set_region_index(::google::protobuf::uint32 value);
+
+  // required uint32 offset = 3;
+  inline bool has_offset() const;
+  inline void clear_offset();
+  static const int kOffsetFieldNumber = 3;
+  inline ::google::protobuf::uint32 offset() const;
+  inline void set_offset(::google::protobuf::uint32 value);
+
+  // required bytes data = 4;
+  inline bool has_data() const;
+  inline void clear_data();
+  static const int kDataFieldNumber = 4;
+  inline const ::std::string& data() const;
+  inline void set_data(const ::std::string& value);
+  inline void set_data(const char* value);
+  inline void set_data(const void* value, size_t size);
+  inline ::std::string* mutable_data();
+  inline ::std::string* release_data();
+  inline void set_allocated_data(::std::string* data);
+
+  // @@protoc_insertion_point(class_scope:rpc.MemoryChunk)
  private:
+  inline void set_has_request_id();
+  inline void clear_has_request_id();
+  inline void set_has_region_index();
+  inline void clear_has_region_index();
+  inline void set_has_offset();
+  inline void clear_has_offset();
+  inline void set_has_data();
+  inline void clear_has_data();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::uint32 _has_bits_[1];
   mutable int _cached_size_;
-  ::google::protobuf::RepeatedPtrField< ::rpc::ReadMemoryRegionsResult_Memory > memories_;
+  ::google::protobuf::uint64 request_id_;
+  ::google::protobuf::uint32 region_index_;
+  ::google::protobuf::uint32 offset_;
+  ::std::string* data_;
   friend void  protobuf_AddDesc_rpc_2eproto();
   friend void protobuf_AssignDesc_rpc_2eproto();
   friend void protobuf_ShutdownFile_rpc_2eproto();
 
   void InitAsDefaultInstance();
-  static ReadMemoryRegionsResult* default_instance_;
+  static MemoryChunk* default_instance_;
 };
 // -------------------------------------------------------------------
 
@@ -2846,97 +3848,372 @@ inline ::rpc::ReadMemoryRegionsRequest* RpcRequest::release_read_memory_regions_
   read_memory_regions_req_ = NULL;
   return temp;
 }
-inline void RpcRequest::set_allocated_read_memory_regions_req(::rpc::ReadMemoryRegionsRequest* read_memory_regions_req) {
-  delete read_memory_regions_req_;
-  read_memory_regions_req_ = read_memory_regions_req;
-  if (read_memory_regions_req) {
-    set_has_read_memory_regions_req();
-  } else {
-    clear_has_read_memory_regions_req();
-  }
-  // @@protoc_insertion_point(field_set_allocated:rpc.RpcRequest.read_memory_regions_req)
+inline void RpcRequest::set_allocated_read_memory_regions_req(::rpc::ReadMemoryRegionsRequest* read_memory_regions_req) {
+  delete read_memory_regions_req_;
+  read_memory_regions_req_ = read_memory_regions_req;
+  if (read_memory_regions_req) {
+    set_has_read_memory_regions_req();
+  } else {
+    clear_has_read_memory_regions_req();
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.RpcRequest.read_memory_regions_req)
+}
+
+// optional .rpc.AnalyzeExternalRefsRequest analyze_external_refs_req = 5;
+inline bool RpcRequest::has_analyze_external_refs_req() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void RpcRequest::set_has_analyze_external_refs_req() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void RpcRequest::clear_has_analyze_external_refs_req() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void RpcRequest::clear_analyze_external_refs_req() {
+  if (analyze_external_refs_req_ != NULL) analyze_external_refs_req_->::rpc::AnalyzeExternalRefsRequest::Clear();
+  clear_has_analyze_external_refs_req();
+}
+inline const ::rpc::AnalyzeExternalRefsRequest& RpcRequest::analyze_external_refs_req() const {
+  // @@protoc_insertion_point(field_get:rpc.RpcRequest.analyze_external_refs_req)
+  return analyze_external_refs_req_ != NULL ? *analyze_external_refs_req_ : *default_instance_->analyze_external_refs_req_;
+}
+inline ::rpc::AnalyzeExternalRefsRequest* RpcRequest::mutable_analyze_external_refs_req() {
+  set_has_analyze_external_refs_req();
+  if (analyze_external_refs_req_ == NULL) analyze_external_refs_req_ = new ::rpc::AnalyzeExternalRefsRequest;
+  // @@protoc_insertion_point(field_mutable:rpc.RpcRequest.analyze_external_refs_req)
+  return analyze_external_refs_req_;
+}
+inline ::rpc::AnalyzeExternalRefsRequest* RpcRequest::release_analyze_external_refs_req() {
+  clear_has_analyze_external_refs_req();
+  ::rpc::AnalyzeExternalRefsRequest* temp = analyze_external_refs_req_;
+  analyze_external_refs_req_ = NULL;
+  return temp;
+}
+inline void RpcRequest::set_allocated_analyze_external_refs_req(::rpc::AnalyzeExternalRefsRequest* analyze_external_refs_req) {
+  delete analyze_external_refs_req_;
+  analyze_external_refs_req_ = analyze_external_refs_req;
+  if (analyze_external_refs_req) {
+    set_has_analyze_external_refs_req();
+  } else {
+    clear_has_analyze_external_refs_req();
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.RpcRequest.analyze_external_refs_req)
+}
+
+// optional .rpc.CheckPEHeadersRequest check_pe_headers_req = 6;
+inline bool RpcRequest::has_check_pe_headers_req() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void RpcRequest::set_has_check_pe_headers_req() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void RpcRequest::clear_has_check_pe_headers_req() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void RpcRequest::clear_check_pe_headers_req() {
+  if (check_pe_headers_req_ != NULL) check_pe_headers_req_->::rpc::CheckPEHeadersRequest::Clear();
+  clear_has_check_pe_headers_req();
+}
+inline const ::rpc::CheckPEHeadersRequest& RpcRequest::check_pe_headers_req() const {
+  // @@protoc_insertion_point(field_get:rpc.RpcRequest.check_pe_headers_req)
+  return check_pe_headers_req_ != NULL ? *check_pe_headers_req_ : *default_instance_->check_pe_headers_req_;
+}
+inline ::rpc::CheckPEHeadersRequest* RpcRequest::mutable_check_pe_headers_req() {
+  set_has_check_pe_headers_req();
+  if (check_pe_headers_req_ == NULL) check_pe_headers_req_ = new ::rpc::CheckPEHeadersRequest;
+  // @@protoc_insertion_point(field_mutable:rpc.RpcRequest.check_pe_headers_req)
+  return check_pe_headers_req_;
+}
+inline ::rpc::CheckPEHeadersRequest* RpcRequest::release_check_pe_headers_req() {
+  clear_has_check_pe_headers_req();
+  ::rpc::CheckPEHeadersRequest* temp = check_pe_headers_req_;
+  check_pe_headers_req_ = NULL;
+  return temp;
+}
+inline void RpcRequest::set_allocated_check_pe_headers_req(::rpc::CheckPEHeadersRequest* check_pe_headers_req) {
+  delete check_pe_headers_req_;
+  check_pe_headers_req_ = check_pe_headers_req;
+  if (check_pe_headers_req) {
+    set_has_check_pe_headers_req();
+  } else {
+    clear_has_check_pe_headers_req();
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.RpcRequest.check_pe_headers_req)
+}
+
+// optional .rpc.GetNamesRequest get_names_req = 7;
+inline bool RpcRequest::has_get_names_req() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void RpcRequest::set_has_get_names_req() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void RpcRequest::clear_has_get_names_req() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void RpcRequest::clear_get_names_req() {
+  if (get_names_req_ != NULL) get_names_req_->::rpc::GetNamesRequest::Clear();
+  clear_has_get_names_req();
+}
+inline const ::rpc::GetNamesRequest& RpcRequest::get_names_req() const {
+  // @@protoc_insertion_point(field_get:rpc.RpcRequest.get_names_req)
+  return get_names_req_ != NULL ? *get_names_req_ : *default_instance_->get_names_req_;
+}
+inline ::rpc::GetNamesRequest* RpcRequest::mutable_get_names_req() {
+  set_has_get_names_req();
+  if (get_names_req_ == NULL) get_names_req_ = new ::rpc::GetNamesRequest;
+  // @@protoc_insertion_point(field_mutable:rpc.RpcRequest.get_names_req)
+  return get_names_req_;
+}
+inline ::rpc::GetNamesRequest* RpcRequest::release_get_names_req() {
+  clear_has_get_names_req();
+  ::rpc::GetNamesRequest* temp = get_names_req_;
+  get_names_req_ = NULL;
+  return temp;
+}
+inline void RpcRequest::set_allocated_get_names_req(::rpc::GetNamesRequest* get_names_req) {
+  delete get_names_req_;
+  get_names_req_ = get_names_req;
+  if (get_names_req) {
+    set_has_get_names_req();
+  } else {
+    clear_has_get_names_req();
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.RpcRequest.get_names_req)
+}
+
+// -------------------------------------------------------------------
+
+// Relocation
+
+// required uint32 start = 1;
+inline bool Relocation::has_start() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Relocation::set_has_start() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Relocation::clear_has_start() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Relocation::clear_start() {
+  start_ = 0u;
+  clear_has_start();
+}
+inline ::google::protobuf::uint32 Relocation::start() const {
+  // @@protoc_insertion_point(field_get:rpc.Relocation.start)
+  return start_;
+}
+inline void Relocation::set_start(::google::protobuf::uint32 value) {
+  set_has_start();
+  start_ = value;
+  // @@protoc_insertion_point(field_set:rpc.Relocation.start)
+}
+
+// required uint32 end = 2;
+inline bool Relocation::has_end() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Relocation::set_has_end() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void Relocation::clear_has_end() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void Relocation::clear_end() {
+  end_ = 0u;
+  clear_has_end();
+}
+inline ::google::protobuf::uint32 Relocation::end() const {
+  // @@protoc_insertion_point(field_get:rpc.Relocation.end)
+  return end_;
+}
+inline void Relocation::set_end(::google::protobuf::uint32 value) {
+  set_has_end();
+  end_ = value;
+  // @@protoc_insertion_point(field_set:rpc.Relocation.end)
+}
+
+// required uint32 remote_start = 3;
+inline bool Relocation::has_remote_start() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Relocation::set_has_remote_start() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void Relocation::clear_has_remote_start() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void Relocation::clear_remote_start() {
+  remote_start_ = 0u;
+  clear_has_remote_start();
+}
+inline ::google::protobuf::uint32 Relocation::remote_start() const {
+  // @@protoc_insertion_point(field_get:rpc.Relocation.remote_start)
+  return remote_start_;
+}
+inline void Relocation::set_remote_start(::google::protobuf::uint32 value) {
+  set_has_remote_start();
+  remote_start_ = value;
+  // @@protoc_insertion_point(field_set:rpc.Relocation.remote_start)
+}
+
+// -------------------------------------------------------------------
+
+// Hello
+
+// required uint32 protocol_version = 1;
+inline bool Hello::has_protocol_version() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Hello::set_has_protocol_version() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Hello::clear_has_protocol_version() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Hello::clear_protocol_version() {
+  protocol_version_ = 0u;
+  clear_has_protocol_version();
+}
+inline ::google::protobuf::uint32 Hello::protocol_version() const {
+  // @@protoc_insertion_point(field_get:rpc.Hello.protocol_version)
+  return protocol_version_;
+}
+inline void Hello::set_protocol_version(::google::protobuf::uint32 value) {
+  set_has_protocol_version();
+  protocol_version_ = value;
+  // @@protoc_insertion_point(field_set:rpc.Hello.protocol_version)
 }
 
-// optional .rpc.AnalyzeExternalRefsRequest analyze_external_refs_req = 5;
-inline bool RpcRequest::has_analyze_external_refs_req() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// optional string labeless_version = 2;
+inline bool Hello::has_labeless_version() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void RpcRequest::set_has_analyze_external_refs_req() {
-  _has_bits_[0] |= 0x00000010u;
+inline void Hello::set_has_labeless_version() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline void RpcRequest::clear_has_analyze_external_refs_req() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void Hello::clear_has_labeless_version() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline void RpcRequest::clear_analyze_external_refs_req() {
-  if (analyze_external_refs_req_ != NULL) analyze_external_refs_req_->::rpc::AnalyzeExternalRefsRequest::Clear();
-  clear_has_analyze_external_refs_req();
+inline void Hello::clear_labeless_version() {
+  if (labeless_version_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    labeless_version_->clear();
+  }
+  clear_has_labeless_version();
 }
-inline const ::rpc::AnalyzeExternalRefsRequest& RpcRequest::analyze_external_refs_req() const {
-  // @@protoc_insertion_point(field_get:rpc.RpcRequest.analyze_external_refs_req)
-  return analyze_external_refs_req_ != NULL ? *analyze_external_refs_req_ : *default_instance_->analyze_external_refs_req_;
+inline const ::std::string& Hello::labeless_version() const {
+  // @@protoc_insertion_point(field_get:rpc.Hello.labeless_version)
+  return *labeless_version_;
 }
-inline ::rpc::AnalyzeExternalRefsRequest* RpcRequest::mutable_analyze_external_refs_req() {
-  set_has_analyze_external_refs_req();
-  if (analyze_external_refs_req_ == NULL) analyze_external_refs_req_ = new ::rpc::AnalyzeExternalRefsRequest;
-  // @@protoc_insertion_point(field_mutable:rpc.RpcRequest.analyze_external_refs_req)
-  return analyze_external_refs_req_;
+inline void Hello::set_labeless_version(const ::std::string& value) {
+  set_has_labeless_version();
+  if (labeless_version_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    labeless_version_ = new ::std::string;
+  }
+  labeless_version_->assign(value);
+  // @@protoc_insertion_point(field_set:rpc.Hello.labeless_version)
 }
-inline ::rpc::AnalyzeExternalRefsRequest* RpcRequest::release_analyze_external_refs_req() {
-  clear_has_analyze_external_refs_req();
-  ::rpc::AnalyzeExternalRefsRequest* temp = analyze_external_refs_req_;
-  analyze_external_refs_req_ = NULL;
-  return temp;
+inline void Hello::set_labeless_version(const char* value) {
+  set_has_labeless_version();
+  if (labeless_version_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    labeless_version_ = new ::std::string;
+  }
+  labeless_version_->assign(value);
+  // @@protoc_insertion_point(field_set_char:rpc.Hello.labeless_version)
 }
-inline void RpcRequest::set_allocated_analyze_external_refs_req(::rpc::AnalyzeExternalRefsRequest* analyze_external_refs_req) {
-  delete analyze_external_refs_req_;
-  analyze_external_refs_req_ = analyze_external_refs_req;
-  if (analyze_external_refs_req) {
-    set_has_analyze_external_refs_req();
+inline void Hello::set_labeless_version(const char* value, size_t size) {
+  set_has_labeless_version();
+  if (labeless_version_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    labeless_version_ = new ::std::string;
+  }
+  labeless_version_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:rpc.Hello.labeless_version)
+}
+inline ::std::string* Hello::mutable_labeless_version() {
+  set_has_labeless_version();
+  if (labeless_version_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    labeless_version_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:rpc.Hello.labeless_version)
+  return labeless_version_;
+}
+inline ::std::string* Hello::release_labeless_version() {
+  clear_has_labeless_version();
+  if (labeless_version_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
   } else {
-    clear_has_analyze_external_refs_req();
+    ::std::string* temp = labeless_version_;
+    labeless_version_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
   }
-  // @@protoc_insertion_point(field_set_allocated:rpc.RpcRequest.analyze_external_refs_req)
+}
+inline void Hello::set_allocated_labeless_version(::std::string* labeless_version) {
+  if (labeless_version_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete labeless_version_;
+  }
+  if (labeless_version) {
+    set_has_labeless_version();
+    labeless_version_ = labeless_version;
+  } else {
+    clear_has_labeless_version();
+    labeless_version_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.Hello.labeless_version)
 }
 
-// optional .rpc.CheckPEHeadersRequest check_pe_headers_req = 6;
-inline bool RpcRequest::has_check_pe_headers_req() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+// optional uint32 codecs = 3;
+inline bool Hello::has_codecs() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void RpcRequest::set_has_check_pe_headers_req() {
-  _has_bits_[0] |= 0x00000020u;
+inline void Hello::set_has_codecs() {
+  _has_bits_[0] |= 0x00000004u;
 }
-inline void RpcRequest::clear_has_check_pe_headers_req() {
-  _has_bits_[0] &= ~0x00000020u;
+inline void Hello::clear_has_codecs() {
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline void RpcRequest::clear_check_pe_headers_req() {
-  if (check_pe_headers_req_ != NULL) check_pe_headers_req_->::rpc::CheckPEHeadersRequest::Clear();
-  clear_has_check_pe_headers_req();
+inline void Hello::clear_codecs() {
+  codecs_ = 0u;
+  clear_has_codecs();
 }
-inline const ::rpc::CheckPEHeadersRequest& RpcRequest::check_pe_headers_req() const {
-  // @@protoc_insertion_point(field_get:rpc.RpcRequest.check_pe_headers_req)
-  return check_pe_headers_req_ != NULL ? *check_pe_headers_req_ : *default_instance_->check_pe_headers_req_;
+inline ::google::protobuf::uint32 Hello::codecs() const {
+  // @@protoc_insertion_point(field_get:rpc.Hello.codecs)
+  return codecs_;
 }
-inline ::rpc::CheckPEHeadersRequest* RpcRequest::mutable_check_pe_headers_req() {
-  set_has_check_pe_headers_req();
-  if (check_pe_headers_req_ == NULL) check_pe_headers_req_ = new ::rpc::CheckPEHeadersRequest;
-  // @@protoc_insertion_point(field_mutable:rpc.RpcRequest.check_pe_headers_req)
-  return check_pe_headers_req_;
+inline void Hello::set_codecs(::google::protobuf::uint32 value) {
+  set_has_codecs();
+  codecs_ = value;
+  // @@protoc_insertion_point(field_set:rpc.Hello.codecs)
 }
-inline ::rpc::CheckPEHeadersRequest* RpcRequest::release_check_pe_headers_req() {
-  clear_has_check_pe_headers_req();
-  ::rpc::CheckPEHeadersRequest* temp = check_pe_headers_req_;
-  check_pe_headers_req_ = NULL;
-  return temp;
+
+// repeated .rpc.Relocation relocations = 4;
+inline int Hello::relocations_size() const {
+  return relocations_.size();
 }
-inline void RpcRequest::set_allocated_check_pe_headers_req(::rpc::CheckPEHeadersRequest* check_pe_headers_req) {
-  delete check_pe_headers_req_;
-  check_pe_headers_req_ = check_pe_headers_req;
-  if (check_pe_headers_req) {
-    set_has_check_pe_headers_req();
-  } else {
-    clear_has_check_pe_headers_req();
-  }
-  // @@protoc_insertion_point(field_set_allocated:rpc.RpcRequest.check_pe_headers_req)
+inline void Hello::clear_relocations() {
+  relocations_.Clear();
+}
+inline const ::rpc::Relocation& Hello::relocations(int index) const {
+  // @@protoc_insertion_point(field_get:rpc.Hello.relocations)
+  return relocations_.Get(index);
+}
+inline ::rpc::Relocation* Hello::mutable_relocations(int index) {
+  // @@protoc_insertion_point(field_mutable:rpc.Hello.relocations)
+  return relocations_.Mutable(index);
+}
+inline ::rpc::Relocation* Hello::add_relocations() {
+  // @@protoc_insertion_point(field_add:rpc.Hello.relocations)
+  return relocations_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::rpc::Relocation >&
+Hello::relocations() const {
+  // @@protoc_insertion_point(field_list:rpc.Hello.relocations)
+  return relocations_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::rpc::Relocation >*
+Hello::mutable_relocations() {
+  // @@protoc_insertion_point(field_mutable_list:rpc.Hello.relocations)
+  return &relocations_;
 }
 
 // -------------------------------------------------------------------
@@ -3219,6 +4496,106 @@ inline void Execute::set_job_id(::google::protobuf::uint64 value) {
   // @@protoc_insertion_point(field_set:rpc.Execute.job_id)
 }
 
+// optional uint64 request_id = 6;
+inline bool Execute::has_request_id() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void Execute::set_has_request_id() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void Execute::clear_has_request_id() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void Execute::clear_request_id() {
+  request_id_ = GOOGLE_ULONGLONG(0);
+  clear_has_request_id();
+}
+inline ::google::protobuf::uint64 Execute::request_id() const {
+  // @@protoc_insertion_point(field_get:rpc.Execute.request_id)
+  return request_id_;
+}
+inline void Execute::set_request_id(::google::protobuf::uint64 value) {
+  set_has_request_id();
+  request_id_ = value;
+  // @@protoc_insertion_point(field_set:rpc.Execute.request_id)
+}
+
+// optional bytes script_extern_marshal = 7;
+inline bool Execute::has_script_extern_marshal() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void Execute::set_has_script_extern_marshal() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void Execute::clear_has_script_extern_marshal() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void Execute::clear_script_extern_marshal() {
+  if (script_extern_marshal_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    script_extern_marshal_->clear();
+  }
+  clear_has_script_extern_marshal();
+}
+inline const ::std::string& Execute::script_extern_marshal() const {
+  // @@protoc_insertion_point(field_get:rpc.Execute.script_extern_marshal)
+  return *script_extern_marshal_;
+}
+inline void Execute::set_script_extern_marshal(const ::std::string& value) {
+  set_has_script_extern_marshal();
+  if (script_extern_marshal_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    script_extern_marshal_ = new ::std::string;
+  }
+  script_extern_marshal_->assign(value);
+  // @@protoc_insertion_point(field_set:rpc.Execute.script_extern_marshal)
+}
+inline void Execute::set_script_extern_marshal(const char* value) {
+  set_has_script_extern_marshal();
+  if (script_extern_marshal_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    script_extern_marshal_ = new ::std::string;
+  }
+  script_extern_marshal_->assign(value);
+  // @@protoc_insertion_point(field_set_char:rpc.Execute.script_extern_marshal)
+}
+inline void Execute::set_script_extern_marshal(const void* value, size_t size) {
+  set_has_script_extern_marshal();
+  if (script_extern_marshal_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    script_extern_marshal_ = new ::std::string;
+  }
+  script_extern_marshal_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:rpc.Execute.script_extern_marshal)
+}
+inline ::std::string* Execute::mutable_script_extern_marshal() {
+  set_has_script_extern_marshal();
+  if (script_extern_marshal_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    script_extern_marshal_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:rpc.Execute.script_extern_marshal)
+  return script_extern_marshal_;
+}
+inline ::std::string* Execute::release_script_extern_marshal() {
+  clear_has_script_extern_marshal();
+  if (script_extern_marshal_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = script_extern_marshal_;
+    script_extern_marshal_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void Execute::set_allocated_script_extern_marshal(::std::string* script_extern_marshal) {
+  if (script_extern_marshal_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete script_extern_marshal_;
+  }
+  if (script_extern_marshal) {
+    set_has_script_extern_marshal();
+    script_extern_marshal_ = script_extern_marshal;
+  } else {
+    clear_has_script_extern_marshal();
+    script_extern_marshal_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.Execute.script_extern_marshal)
+}
+
 // -------------------------------------------------------------------
 
 // Response
@@ -3500,80 +4877,274 @@ inline void Response::set_rpc_result(const ::std::string& value) {
   if (rpc_result_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
     rpc_result_ = new ::std::string;
   }
-  rpc_result_->assign(value);
-  // @@protoc_insertion_point(field_set:rpc.Response.rpc_result)
+  rpc_result_->assign(value);
+  // @@protoc_insertion_point(field_set:rpc.Response.rpc_result)
+}
+inline void Response::set_rpc_result(const char* value) {
+  set_has_rpc_result();
+  if (rpc_result_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    rpc_result_ = new ::std::string;
+  }
+  rpc_result_->assign(value);
+  // @@protoc_insertion_point(field_set_char:rpc.Response.rpc_result)
+}
+inline void Response::set_rpc_result(const void* value, size_t size) {
+  set_has_rpc_result();
+  if (rpc_result_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    rpc_result_ = new ::std::string;
+  }
+  rpc_result_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:rpc.Response.rpc_result)
+}
+inline ::std::string* Response::mutable_rpc_result() {
+  set_has_rpc_result();
+  if (rpc_result_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    rpc_result_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:rpc.Response.rpc_result)
+  return rpc_result_;
+}
+inline ::std::string* Response::release_rpc_result() {
+  clear_has_rpc_result();
+  if (rpc_result_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = rpc_result_;
+    rpc_result_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void Response::set_allocated_rpc_result(::std::string* rpc_result) {
+  if (rpc_result_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete rpc_result_;
+  }
+  if (rpc_result) {
+    set_has_rpc_result();
+    rpc_result_ = rpc_result;
+  } else {
+    clear_has_rpc_result();
+    rpc_result_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.Response.rpc_result)
+}
+
+// optional .rpc.Response.JobStatus job_status = 6;
+inline bool Response::has_job_status() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void Response::set_has_job_status() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void Response::clear_has_job_status() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void Response::clear_job_status() {
+  job_status_ = 1;
+  clear_has_job_status();
+}
+inline ::rpc::Response_JobStatus Response::job_status() const {
+  // @@protoc_insertion_point(field_get:rpc.Response.job_status)
+  return static_cast< ::rpc::Response_JobStatus >(job_status_);
+}
+inline void Response::set_job_status(::rpc::Response_JobStatus value) {
+  assert(::rpc::Response_JobStatus_IsValid(value));
+  set_has_job_status();
+  job_status_ = value;
+  // @@protoc_insertion_point(field_set:rpc.Response.job_status)
+}
+
+// optional uint64 request_id = 7;
+inline bool Response::has_request_id() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void Response::set_has_request_id() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void Response::clear_has_request_id() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void Response::clear_request_id() {
+  request_id_ = GOOGLE_ULONGLONG(0);
+  clear_has_request_id();
+}
+inline ::google::protobuf::uint64 Response::request_id() const {
+  // @@protoc_insertion_point(field_get:rpc.Response.request_id)
+  return request_id_;
+}
+inline void Response::set_request_id(::google::protobuf::uint64 value) {
+  set_has_request_id();
+  request_id_ = value;
+  // @@protoc_insertion_point(field_set:rpc.Response.request_id)
+}
+
+// -------------------------------------------------------------------
+
+// PackedNames
+
+// repeated uint32 ea_deltas = 1 [packed = true];
+inline int PackedNames::ea_deltas_size() const {
+  return ea_deltas_.size();
+}
+inline void PackedNames::clear_ea_deltas() {
+  ea_deltas_.Clear();
+}
+inline ::google::protobuf::uint32 PackedNames::ea_deltas(int index) const {
+  // @@protoc_insertion_point(field_get:rpc.PackedNames.ea_deltas)
+  return ea_deltas_.Get(index);
+}
+inline void PackedNames::set_ea_deltas(int index, ::google::protobuf::uint32 value) {
+  ea_deltas_.Set(index, value);
+  // @@protoc_insertion_point(field_set:rpc.PackedNames.ea_deltas)
+}
+inline void PackedNames::add_ea_deltas(::google::protobuf::uint32 value) {
+  ea_deltas_.Add(value);
+  // @@protoc_insertion_point(field_add:rpc.PackedNames.ea_deltas)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+PackedNames::ea_deltas() const {
+  // @@protoc_insertion_point(field_list:rpc.PackedNames.ea_deltas)
+  return ea_deltas_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+PackedNames::mutable_ea_deltas() {
+  // @@protoc_insertion_point(field_mutable_list:rpc.PackedNames.ea_deltas)
+  return &ea_deltas_;
+}
+
+// repeated uint32 shared_sizes = 2 [packed = true];
+inline int PackedNames::shared_sizes_size() const {
+  return shared_sizes_.size();
+}
+inline void PackedNames::clear_shared_sizes() {
+  shared_sizes_.Clear();
+}
+inline ::google::protobuf::uint32 PackedNames::shared_sizes(int index) const {
+  // @@protoc_insertion_point(field_get:rpc.PackedNames.shared_sizes)
+  return shared_sizes_.Get(index);
+}
+inline void PackedNames::set_shared_sizes(int index, ::google::protobuf::uint32 value) {
+  shared_sizes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:rpc.PackedNames.shared_sizes)
+}
+inline void PackedNames::add_shared_sizes(::google::protobuf::uint32 value) {
+  shared_sizes_.Add(value);
+  // @@protoc_insertion_point(field_add:rpc.PackedNames.shared_sizes)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+PackedNames::shared_sizes() const {
+  // @@protoc_insertion_point(field_list:rpc.PackedNames.shared_sizes)
+  return shared_sizes_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+PackedNames::mutable_shared_sizes() {
+  // @@protoc_insertion_point(field_mutable_list:rpc.PackedNames.shared_sizes)
+  return &shared_sizes_;
+}
+
+// repeated uint32 suffix_sizes = 3 [packed = true];
+inline int PackedNames::suffix_sizes_size() const {
+  return suffix_sizes_.size();
+}
+inline void PackedNames::clear_suffix_sizes() {
+  suffix_sizes_.Clear();
+}
+inline ::google::protobuf::uint32 PackedNames::suffix_sizes(int index) const {
+  // @@protoc_insertion_point(field_get:rpc.PackedNames.suffix_sizes)
+  return suffix_sizes_.Get(index);
+}
+inline void PackedNames::set_suffix_sizes(int index, ::google::protobuf::uint32 value) {
+  suffix_sizes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:rpc.PackedNames.suffix_sizes)
+}
+inline void PackedNames::add_suffix_sizes(::google::protobuf::uint32 value) {
+  suffix_sizes_.Add(value);
+  // @@protoc_insertion_point(field_add:rpc.PackedNames.suffix_sizes)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+PackedNames::suffix_sizes() const {
+  // @@protoc_insertion_point(field_list:rpc.PackedNames.suffix_sizes)
+  return suffix_sizes_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+PackedNames::mutable_suffix_sizes() {
+  // @@protoc_insertion_point(field_mutable_list:rpc.PackedNames.suffix_sizes)
+  return &suffix_sizes_;
+}
+
+// optional bytes suffixes = 4;
+inline bool PackedNames::has_suffixes() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void PackedNames::set_has_suffixes() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void PackedNames::clear_has_suffixes() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void PackedNames::clear_suffixes() {
+  if (suffixes_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    suffixes_->clear();
+  }
+  clear_has_suffixes();
 }
-inline void Response::set_rpc_result(const char* value) {
-  set_has_rpc_result();
-  if (rpc_result_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    rpc_result_ = new ::std::string;
+inline const ::std::string& PackedNames::suffixes() const {
+  // @@protoc_insertion_point(field_get:rpc.PackedNames.suffixes)
+  return *suffixes_;
+}
+inline void PackedNames::set_suffixes(const ::std::string& value) {
+  set_has_suffixes();
+  if (suffixes_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    suffixes_ = new ::std::string;
   }
-  rpc_result_->assign(value);
-  // @@protoc_insertion_point(field_set_char:rpc.Response.rpc_result)
+  suffixes_->assign(value);
+  // @@protoc_insertion_point(field_set:rpc.PackedNames.suffixes)
 }
-inline void Response::set_rpc_result(const void* value, size_t size) {
-  set_has_rpc_result();
-  if (rpc_result_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    rpc_result_ = new ::std::string;
+inline void PackedNames::set_suffixes(const char* value) {
+  set_has_suffixes();
+  if (suffixes_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    suffixes_ = new ::std::string;
   }
-  rpc_result_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:rpc.Response.rpc_result)
+  suffixes_->assign(value);
+  // @@protoc_insertion_point(field_set_char:rpc.PackedNames.suffixes)
 }
-inline ::std::string* Response::mutable_rpc_result() {
-  set_has_rpc_result();
-  if (rpc_result_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    rpc_result_ = new ::std::string;
+inline void PackedNames::set_suffixes(const void* value, size_t size) {
+  set_has_suffixes();
+  if (suffixes_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    suffixes_ = new ::std::string;
   }
-  // @@protoc_insertion_point(field_mutable:rpc.Response.rpc_result)
-  return rpc_result_;
+  suffixes_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:rpc.PackedNames.suffixes)
 }
-inline ::std::string* Response::release_rpc_result() {
-  clear_has_rpc_result();
-  if (rpc_result_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+inline ::std::string* PackedNames::mutable_suffixes() {
+  set_has_suffixes();
+  if (suffixes_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    suffixes_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:rpc.PackedNames.suffixes)
+  return suffixes_;
+}
+inline ::std::string* PackedNames::release_suffixes() {
+  clear_has_suffixes();
+  if (suffixes_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
     return NULL;
   } else {
-    ::std::string* temp = rpc_result_;
-    rpc_result_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    ::std::string* temp = suffixes_;
+    suffixes_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
     return temp;
   }
 }
-inline void Response::set_allocated_rpc_result(::std::string* rpc_result) {
-  if (rpc_result_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete rpc_result_;
+inline void PackedNames::set_allocated_suffixes(::std::string* suffixes) {
+  if (suffixes_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete suffixes_;
   }
-  if (rpc_result) {
-    set_has_rpc_result();
-    rpc_result_ = rpc_result;
+  if (suffixes) {
+    set_has_suffixes();
+    suffixes_ = suffixes;
   } else {
-    clear_has_rpc_result();
-    rpc_result_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    clear_has_suffixes();
+    suffixes_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   }
-  // @@protoc_insertion_point(field_set_allocated:rpc.Response.rpc_result)
-}
-
-// optional .rpc.Response.JobStatus job_status = 6;
-inline bool Response::has_job_status() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void Response::set_has_job_status() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void Response::clear_has_job_status() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void Response::clear_job_status() {
-  job_status_ = 1;
-  clear_has_job_status();
-}
-inline ::rpc::Response_JobStatus Response::job_status() const {
-  // @@protoc_insertion_point(field_get:rpc.Response.job_status)
-  return static_cast< ::rpc::Response_JobStatus >(job_status_);
-}
-inline void Response::set_job_status(::rpc::Response_JobStatus value) {
-  assert(::rpc::Response_JobStatus_IsValid(value));
-  set_has_job_status();
-  job_status_ = value;
-  // @@protoc_insertion_point(field_set:rpc.Response.job_status)
+  // @@protoc_insertion_point(field_set_allocated:rpc.PackedNames.suffixes)
 }
 
 // -------------------------------------------------------------------
@@ -3762,6 +5333,47 @@ inline void MakeNamesRequest::set_remote_base(::google::protobuf::uint32 value)
   // @@protoc_insertion_point(field_set:rpc.MakeNamesRequest.remote_base)
 }
 
+// optional .rpc.PackedNames packed_names = 4;
+inline bool MakeNamesRequest::has_packed_names() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void MakeNamesRequest::set_has_packed_names() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void MakeNamesRequest::clear_has_packed_names() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void MakeNamesRequest::clear_packed_names() {
+  if (packed_names_ != NULL) packed_names_->::rpc::PackedNames::Clear();
+  clear_has_packed_names();
+}
+inline const ::rpc::PackedNames& MakeNamesRequest::packed_names() const {
+  // @@protoc_insertion_point(field_get:rpc.MakeNamesRequest.packed_names)
+  return packed_names_ != NULL ? *packed_names_ : *default_instance_->packed_names_;
+}
+inline ::rpc::PackedNames* MakeNamesRequest::mutable_packed_names() {
+  set_has_packed_names();
+  if (packed_names_ == NULL) packed_names_ = new ::rpc::PackedNames;
+  // @@protoc_insertion_point(field_mutable:rpc.MakeNamesRequest.packed_names)
+  return packed_names_;
+}
+inline ::rpc::PackedNames* MakeNamesRequest::release_packed_names() {
+  clear_has_packed_names();
+  ::rpc::PackedNames* temp = packed_names_;
+  packed_names_ = NULL;
+  return temp;
+}
+inline void MakeNamesRequest::set_allocated_packed_names(::rpc::PackedNames* packed_names) {
+  delete packed_names_;
+  packed_names_ = packed_names;
+  if (packed_names) {
+    set_has_packed_names();
+  } else {
+    clear_has_packed_names();
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.MakeNamesRequest.packed_names)
+}
+
 // -------------------------------------------------------------------
 
 // MakeCommentsRequest_Name
@@ -3918,34 +5530,437 @@ inline ::google::protobuf::uint32 MakeCommentsRequest::base() const {
   // @@protoc_insertion_point(field_get:rpc.MakeCommentsRequest.base)
   return base_;
 }
-inline void MakeCommentsRequest::set_base(::google::protobuf::uint32 value) {
-  set_has_base();
-  base_ = value;
-  // @@protoc_insertion_point(field_set:rpc.MakeCommentsRequest.base)
+inline void MakeCommentsRequest::set_base(::google::protobuf::uint32 value) {
+  set_has_base();
+  base_ = value;
+  // @@protoc_insertion_point(field_set:rpc.MakeCommentsRequest.base)
+}
+
+// required uint32 remote_base = 3;
+inline bool MakeCommentsRequest::has_remote_base() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void MakeCommentsRequest::set_has_remote_base() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void MakeCommentsRequest::clear_has_remote_base() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void MakeCommentsRequest::clear_remote_base() {
+  remote_base_ = 0u;
+  clear_has_remote_base();
+}
+inline ::google::protobuf::uint32 MakeCommentsRequest::remote_base() const {
+  // @@protoc_insertion_point(field_get:rpc.MakeCommentsRequest.remote_base)
+  return remote_base_;
+}
+inline void MakeCommentsRequest::set_remote_base(::google::protobuf::uint32 value) {
+  set_has_remote_base();
+  remote_base_ = value;
+  // @@protoc_insertion_point(field_set:rpc.MakeCommentsRequest.remote_base)
+}
+
+// optional .rpc.PackedNames packed_names = 4;
+inline bool MakeCommentsRequest::has_packed_names() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void MakeCommentsRequest::set_has_packed_names() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void MakeCommentsRequest::clear_has_packed_names() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void MakeCommentsRequest::clear_packed_names() {
+  if (packed_names_ != NULL) packed_names_->::rpc::PackedNames::Clear();
+  clear_has_packed_names();
+}
+inline const ::rpc::PackedNames& MakeCommentsRequest::packed_names() const {
+  // @@protoc_insertion_point(field_get:rpc.MakeCommentsRequest.packed_names)
+  return packed_names_ != NULL ? *packed_names_ : *default_instance_->packed_names_;
+}
+inline ::rpc::PackedNames* MakeCommentsRequest::mutable_packed_names() {
+  set_has_packed_names();
+  if (packed_names_ == NULL) packed_names_ = new ::rpc::PackedNames;
+  // @@protoc_insertion_point(field_mutable:rpc.MakeCommentsRequest.packed_names)
+  return packed_names_;
+}
+inline ::rpc::PackedNames* MakeCommentsRequest::release_packed_names() {
+  clear_has_packed_names();
+  ::rpc::PackedNames* temp = packed_names_;
+  packed_names_ = NULL;
+  return temp;
+}
+inline void MakeCommentsRequest::set_allocated_packed_names(::rpc::PackedNames* packed_names) {
+  delete packed_names_;
+  packed_names_ = packed_names;
+  if (packed_names) {
+    set_has_packed_names();
+  } else {
+    clear_has_packed_names();
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.MakeCommentsRequest.packed_names)
+}
+
+// -------------------------------------------------------------------
+
+// GetNamesRequest
+
+// required uint32 base = 1;
+inline bool GetNamesRequest::has_base() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void GetNamesRequest::set_has_base() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void GetNamesRequest::clear_has_base() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void GetNamesRequest::clear_base() {
+  base_ = 0u;
+  clear_has_base();
+}
+inline ::google::protobuf::uint32 GetNamesRequest::base() const {
+  // @@protoc_insertion_point(field_get:rpc.GetNamesRequest.base)
+  return base_;
+}
+inline void GetNamesRequest::set_base(::google::protobuf::uint32 value) {
+  set_has_base();
+  base_ = value;
+  // @@protoc_insertion_point(field_set:rpc.GetNamesRequest.base)
+}
+
+// required uint32 remote_base = 2;
+inline bool GetNamesRequest::has_remote_base() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void GetNamesRequest::set_has_remote_base() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void GetNamesRequest::clear_has_remote_base() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void GetNamesRequest::clear_remote_base() {
+  remote_base_ = 0u;
+  clear_has_remote_base();
+}
+inline ::google::protobuf::uint32 GetNamesRequest::remote_base() const {
+  // @@protoc_insertion_point(field_get:rpc.GetNamesRequest.remote_base)
+  return remote_base_;
+}
+inline void GetNamesRequest::set_remote_base(::google::protobuf::uint32 value) {
+  set_has_remote_base();
+  remote_base_ = value;
+  // @@protoc_insertion_point(field_set:rpc.GetNamesRequest.remote_base)
+}
+
+// required uint32 start = 3;
+inline bool GetNamesRequest::has_start() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void GetNamesRequest::set_has_start() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void GetNamesRequest::clear_has_start() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void GetNamesRequest::clear_start() {
+  start_ = 0u;
+  clear_has_start();
+}
+inline ::google::protobuf::uint32 GetNamesRequest::start() const {
+  // @@protoc_insertion_point(field_get:rpc.GetNamesRequest.start)
+  return start_;
+}
+inline void GetNamesRequest::set_start(::google::protobuf::uint32 value) {
+  set_has_start();
+  start_ = value;
+  // @@protoc_insertion_point(field_set:rpc.GetNamesRequest.start)
+}
+
+// required uint32 end = 4;
+inline bool GetNamesRequest::has_end() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void GetNamesRequest::set_has_end() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void GetNamesRequest::clear_has_end() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void GetNamesRequest::clear_end() {
+  end_ = 0u;
+  clear_has_end();
+}
+inline ::google::protobuf::uint32 GetNamesRequest::end() const {
+  // @@protoc_insertion_point(field_get:rpc.GetNamesRequest.end)
+  return end_;
+}
+inline void GetNamesRequest::set_end(::google::protobuf::uint32 value) {
+  set_has_end();
+  end_ = value;
+  // @@protoc_insertion_point(field_set:rpc.GetNamesRequest.end)
+}
+
+// optional bool labels = 5 [default = true];
+inline bool GetNamesRequest::has_labels() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void GetNamesRequest::set_has_labels() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void GetNamesRequest::clear_has_labels() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void GetNamesRequest::clear_labels() {
+  labels_ = true;
+  clear_has_labels();
+}
+inline bool GetNamesRequest::labels() const {
+  // @@protoc_insertion_point(field_get:rpc.GetNamesRequest.labels)
+  return labels_;
+}
+inline void GetNamesRequest::set_labels(bool value) {
+  set_has_labels();
+  labels_ = value;
+  // @@protoc_insertion_point(field_set:rpc.GetNamesRequest.labels)
+}
+
+// optional bool comments = 6 [default = true];
+inline bool GetNamesRequest::has_comments() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void GetNamesRequest::set_has_comments() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void GetNamesRequest::clear_has_comments() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void GetNamesRequest::clear_comments() {
+  comments_ = true;
+  clear_has_comments();
+}
+inline bool GetNamesRequest::comments() const {
+  // @@protoc_insertion_point(field_get:rpc.GetNamesRequest.comments)
+  return comments_;
+}
+inline void GetNamesRequest::set_comments(bool value) {
+  set_has_comments();
+  comments_ = value;
+  // @@protoc_insertion_point(field_set:rpc.GetNamesRequest.comments)
+}
+
+// -------------------------------------------------------------------
+
+// GetNamesResult_Name
+
+// required uint32 ea_delta = 1;
+inline bool GetNamesResult_Name::has_ea_delta() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void GetNamesResult_Name::set_has_ea_delta() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void GetNamesResult_Name::clear_has_ea_delta() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void GetNamesResult_Name::clear_ea_delta() {
+  ea_delta_ = 0u;
+  clear_has_ea_delta();
+}
+inline ::google::protobuf::uint32 GetNamesResult_Name::ea_delta() const {
+  // @@protoc_insertion_point(field_get:rpc.GetNamesResult.Name.ea_delta)
+  return ea_delta_;
+}
+inline void GetNamesResult_Name::set_ea_delta(::google::protobuf::uint32 value) {
+  set_has_ea_delta();
+  ea_delta_ = value;
+  // @@protoc_insertion_point(field_set:rpc.GetNamesResult.Name.ea_delta)
+}
+
+// optional string label = 2;
+inline bool GetNamesResult_Name::has_label() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void GetNamesResult_Name::set_has_label() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void GetNamesResult_Name::clear_has_label() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void GetNamesResult_Name::clear_label() {
+  if (label_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    label_->clear();
+  }
+  clear_has_label();
+}
+inline const ::std::string& GetNamesResult_Name::label() const {
+  // @@protoc_insertion_point(field_get:rpc.GetNamesResult.Name.label)
+  return *label_;
+}
+inline void GetNamesResult_Name::set_label(const ::std::string& value) {
+  set_has_label();
+  if (label_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    label_ = new ::std::string;
+  }
+  label_->assign(value);
+  // @@protoc_insertion_point(field_set:rpc.GetNamesResult.Name.label)
+}
+inline void GetNamesResult_Name::set_label(const char* value) {
+  set_has_label();
+  if (label_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    label_ = new ::std::string;
+  }
+  label_->assign(value);
+  // @@protoc_insertion_point(field_set_char:rpc.GetNamesResult.Name.label)
+}
+inline void GetNamesResult_Name::set_label(const char* value, size_t size) {
+  set_has_label();
+  if (label_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    label_ = new ::std::string;
+  }
+  label_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:rpc.GetNamesResult.Name.label)
+}
+inline ::std::string* GetNamesResult_Name::mutable_label() {
+  set_has_label();
+  if (label_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    label_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:rpc.GetNamesResult.Name.label)
+  return label_;
+}
+inline ::std::string* GetNamesResult_Name::release_label() {
+  clear_has_label();
+  if (label_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = label_;
+    label_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void GetNamesResult_Name::set_allocated_label(::std::string* label) {
+  if (label_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete label_;
+  }
+  if (label) {
+    set_has_label();
+    label_ = label;
+  } else {
+    clear_has_label();
+    label_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.GetNamesResult.Name.label)
+}
+
+// optional string comment = 3;
+inline bool GetNamesResult_Name::has_comment() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void GetNamesResult_Name::set_has_comment() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void GetNamesResult_Name::clear_has_comment() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void GetNamesResult_Name::clear_comment() {
+  if (comment_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    comment_->clear();
+  }
+  clear_has_comment();
+}
+inline const ::std::string& GetNamesResult_Name::comment() const {
+  // @@protoc_insertion_point(field_get:rpc.GetNamesResult.Name.comment)
+  return *comment_;
+}
+inline void GetNamesResult_Name::set_comment(const ::std::string& value) {
+  set_has_comment();
+  if (comment_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    comment_ = new ::std::string;
+  }
+  comment_->assign(value);
+  // @@protoc_insertion_point(field_set:rpc.GetNamesResult.Name.comment)
+}
+inline void GetNamesResult_Name::set_comment(const char* value) {
+  set_has_comment();
+  if (comment_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    comment_ = new ::std::string;
+  }
+  comment_->assign(value);
+  // @@protoc_insertion_point(field_set_char:rpc.GetNamesResult.Name.comment)
+}
+inline void GetNamesResult_Name::set_comment(const char* value, size_t size) {
+  set_has_comment();
+  if (comment_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    comment_ = new ::std::string;
+  }
+  comment_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:rpc.GetNamesResult.Name.comment)
+}
+inline ::std::string* GetNamesResult_Name::mutable_comment() {
+  set_has_comment();
+  if (comment_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    comment_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:rpc.GetNamesResult.Name.comment)
+  return comment_;
+}
+inline ::std::string* GetNamesResult_Name::release_comment() {
+  clear_has_comment();
+  if (comment_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = comment_;
+    comment_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void GetNamesResult_Name::set_allocated_comment(::std::string* comment) {
+  if (comment_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete comment_;
+  }
+  if (comment) {
+    set_has_comment();
+    comment_ = comment;
+  } else {
+    clear_has_comment();
+    comment_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.GetNamesResult.Name.comment)
 }
 
-// required uint32 remote_base = 3;
-inline bool MakeCommentsRequest::has_remote_base() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// -------------------------------------------------------------------
+
+// GetNamesResult
+
+// repeated .rpc.GetNamesResult.Name names = 1;
+inline int GetNamesResult::names_size() const {
+  return names_.size();
 }
-inline void MakeCommentsRequest::set_has_remote_base() {
-  _has_bits_[0] |= 0x00000004u;
+inline void GetNamesResult::clear_names() {
+  names_.Clear();
 }
-inline void MakeCommentsRequest::clear_has_remote_base() {
-  _has_bits_[0] &= ~0x00000004u;
+inline const ::rpc::GetNamesResult_Name& GetNamesResult::names(int index) const {
+  // @@protoc_insertion_point(field_get:rpc.GetNamesResult.names)
+  return names_.Get(index);
 }
-inline void MakeCommentsRequest::clear_remote_base() {
-  remote_base_ = 0u;
-  clear_has_remote_base();
+inline ::rpc::GetNamesResult_Name* GetNamesResult::mutable_names(int index) {
+  // @@protoc_insertion_point(field_mutable:rpc.GetNamesResult.names)
+  return names_.Mutable(index);
 }
-inline ::google::protobuf::uint32 MakeCommentsRequest::remote_base() const {
-  // @@protoc_insertion_point(field_get:rpc.MakeCommentsRequest.remote_base)
-  return remote_base_;
+inline ::rpc::GetNamesResult_Name* GetNamesResult::add_names() {
+  // @@protoc_insertion_point(field_add:rpc.GetNamesResult.names)
+  return names_.Add();
 }
-inline void MakeCommentsRequest::set_remote_base(::google::protobuf::uint32 value) {
-  set_has_remote_base();
-  remote_base_ = value;
-  // @@protoc_insertion_point(field_set:rpc.MakeCommentsRequest.remote_base)
+inline const ::google::protobuf::RepeatedPtrField< ::rpc::GetNamesResult_Name >&
+GetNamesResult::names() const {
+  // @@protoc_insertion_point(field_list:rpc.GetNamesResult.names)
+  return names_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::rpc::GetNamesResult_Name >*
+GetNamesResult::mutable_names() {
+  // @@protoc_insertion_point(field_mutable_list:rpc.GetNamesResult.names)
+  return &names_;
 }
 
 // -------------------------------------------------------------------
@@ -4186,6 +6201,36 @@ inline void ReadMemoryRegionsRequest_Region::set_size(::google::protobuf::uint32
   // @@protoc_insertion_point(field_set:rpc.ReadMemoryRegionsRequest.Region.size)
 }
 
+// repeated fixed64 page_hashes = 3 [packed = true];
+inline int ReadMemoryRegionsRequest_Region::page_hashes_size() const {
+  return page_hashes_.size();
+}
+inline void ReadMemoryRegionsRequest_Region::clear_page_hashes() {
+  page_hashes_.Clear();
+}
+inline ::google::protobuf::uint64 ReadMemoryRegionsRequest_Region::page_hashes(int index) const {
+  // @@protoc_insertion_point(field_get:rpc.ReadMemoryRegionsRequest.Region.page_hashes)
+  return page_hashes_.Get(index);
+}
+inline void ReadMemoryRegionsRequest_Region::set_page_hashes(int index, ::google::protobuf::uint64 value) {
+  page_hashes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:rpc.ReadMemoryRegionsRequest.Region.page_hashes)
+}
+inline void ReadMemoryRegionsRequest_Region::add_page_hashes(::google::protobuf::uint64 value) {
+  page_hashes_.Add(value);
+  // @@protoc_insertion_point(field_add:rpc.ReadMemoryRegionsRequest.Region.page_hashes)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+ReadMemoryRegionsRequest_Region::page_hashes() const {
+  // @@protoc_insertion_point(field_list:rpc.ReadMemoryRegionsRequest.Region.page_hashes)
+  return page_hashes_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+ReadMemoryRegionsRequest_Region::mutable_page_hashes() {
+  // @@protoc_insertion_point(field_mutable_list:rpc.ReadMemoryRegionsRequest.Region.page_hashes)
+  return &page_hashes_;
+}
+
 // -------------------------------------------------------------------
 
 // ReadMemoryRegionsRequest
@@ -4220,6 +6265,30 @@ ReadMemoryRegionsRequest::mutable_regions() {
   return &regions_;
 }
 
+// optional uint32 chunk_size = 2;
+inline bool ReadMemoryRegionsRequest::has_chunk_size() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void ReadMemoryRegionsRequest::set_has_chunk_size() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void ReadMemoryRegionsRequest::clear_has_chunk_size() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void ReadMemoryRegionsRequest::clear_chunk_size() {
+  chunk_size_ = 0u;
+  clear_has_chunk_size();
+}
+inline ::google::protobuf::uint32 ReadMemoryRegionsRequest::chunk_size() const {
+  // @@protoc_insertion_point(field_get:rpc.ReadMemoryRegionsRequest.chunk_size)
+  return chunk_size_;
+}
+inline void ReadMemoryRegionsRequest::set_chunk_size(::google::protobuf::uint32 value) {
+  set_has_chunk_size();
+  chunk_size_ = value;
+  // @@protoc_insertion_point(field_set:rpc.ReadMemoryRegionsRequest.chunk_size)
+}
+
 // -------------------------------------------------------------------
 
 // ReadMemoryRegionsResult_Memory
@@ -4372,6 +6441,30 @@ inline void ReadMemoryRegionsResult_Memory::set_protect(::google::protobuf::uint
   // @@protoc_insertion_point(field_set:rpc.ReadMemoryRegionsResult.Memory.protect)
 }
 
+// optional uint32 unchanged_size = 5;
+inline bool ReadMemoryRegionsResult_Memory::has_unchanged_size() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void ReadMemoryRegionsResult_Memory::set_has_unchanged_size() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void ReadMemoryRegionsResult_Memory::clear_has_unchanged_size() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void ReadMemoryRegionsResult_Memory::clear_unchanged_size() {
+  unchanged_size_ = 0u;
+  clear_has_unchanged_size();
+}
+inline ::google::protobuf::uint32 ReadMemoryRegionsResult_Memory::unchanged_size() const {
+  // @@protoc_insertion_point(field_get:rpc.ReadMemoryRegionsResult.Memory.unchanged_size)
+  return unchanged_size_;
+}
+inline void ReadMemoryRegionsResult_Memory::set_unchanged_size(::google::protobuf::uint32 value) {
+  set_has_unchanged_size();
+  unchanged_size_ = value;
+  // @@protoc_insertion_point(field_set:rpc.ReadMemoryRegionsResult.Memory.unchanged_size)
+}
+
 // -------------------------------------------------------------------
 
 // ReadMemoryRegionsResult
@@ -4408,6 +6501,338 @@ ReadMemoryRegionsResult::mutable_memories() {
 
 // -------------------------------------------------------------------
 
+// OutputChunk
+
+// optional uint64 request_id = 1;
+inline bool OutputChunk::has_request_id() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void OutputChunk::set_has_request_id() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void OutputChunk::clear_has_request_id() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void OutputChunk::clear_request_id() {
+  request_id_ = GOOGLE_ULONGLONG(0);
+  clear_has_request_id();
+}
+inline ::google::protobuf::uint64 OutputChunk::request_id() const {
+  // @@protoc_insertion_point(field_get:rpc.OutputChunk.request_id)
+  return request_id_;
+}
+inline void OutputChunk::set_request_id(::google::protobuf::uint64 value) {
+  set_has_request_id();
+  request_id_ = value;
+  // @@protoc_insertion_point(field_set:rpc.OutputChunk.request_id)
+}
+
+// optional string std_out = 2;
+inline bool OutputChunk::has_std_out() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void OutputChunk::set_has_std_out() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void OutputChunk::clear_has_std_out() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void OutputChunk::clear_std_out() {
+  if (std_out_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    std_out_->clear();
+  }
+  clear_has_std_out();
+}
+inline const ::std::string& OutputChunk::std_out() const {
+  // @@protoc_insertion_point(field_get:rpc.OutputChunk.std_out)
+  return *std_out_;
+}
+inline void OutputChunk::set_std_out(const ::std::string& value) {
+  set_has_std_out();
+  if (std_out_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    std_out_ = new ::std::string;
+  }
+  std_out_->assign(value);
+  // @@protoc_insertion_point(field_set:rpc.OutputChunk.std_out)
+}
+inline void OutputChunk::set_std_out(const char* value) {
+  set_has_std_out();
+  if (std_out_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    std_out_ = new ::std::string;
+  }
+  std_out_->assign(value);
+  // @@protoc_insertion_point(field_set_char:rpc.OutputChunk.std_out)
+}
+inline void OutputChunk::set_std_out(const char* value, size_t size) {
+  set_has_std_out();
+  if (std_out_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    std_out_ = new ::std::string;
+  }
+  std_out_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:rpc.OutputChunk.std_out)
+}
+inline ::std::string* OutputChunk::mutable_std_out() {
+  set_has_std_out();
+  if (std_out_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    std_out_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:rpc.OutputChunk.std_out)
+  return std_out_;
+}
+inline ::std::string* OutputChunk::release_std_out() {
+  clear_has_std_out();
+  if (std_out_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = std_out_;
+    std_out_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void OutputChunk::set_allocated_std_out(::std::string* std_out) {
+  if (std_out_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete std_out_;
+  }
+  if (std_out) {
+    set_has_std_out();
+    std_out_ = std_out;
+  } else {
+    clear_has_std_out();
+    std_out_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.OutputChunk.std_out)
+}
+
+// optional string std_err = 3;
+inline bool OutputChunk::has_std_err() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void OutputChunk::set_has_std_err() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void OutputChunk::clear_has_std_err() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void OutputChunk::clear_std_err() {
+  if (std_err_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    std_err_->clear();
+  }
+  clear_has_std_err();
+}
+inline const ::std::string& OutputChunk::std_err() const {
+  // @@protoc_insertion_point(field_get:rpc.OutputChunk.std_err)
+  return *std_err_;
+}
+inline void OutputChunk::set_std_err(const ::std::string& value) {
+  set_has_std_err();
+  if (std_err_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    std_err_ = new ::std::string;
+  }
+  std_err_->assign(value);
+  // @@protoc_insertion_point(field_set:rpc.OutputChunk.std_err)
+}
+inline void OutputChunk::set_std_err(const char* value) {
+  set_has_std_err();
+  if (std_err_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    std_err_ = new ::std::string;
+  }
+  std_err_->assign(value);
+  // @@protoc_insertion_point(field_set_char:rpc.OutputChunk.std_err)
+}
+inline void OutputChunk::set_std_err(const char* value, size_t size) {
+  set_has_std_err();
+  if (std_err_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    std_err_ = new ::std::string;
+  }
+  std_err_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:rpc.OutputChunk.std_err)
+}
+inline ::std::string* OutputChunk::mutable_std_err() {
+  set_has_std_err();
+  if (std_err_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    std_err_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:rpc.OutputChunk.std_err)
+  return std_err_;
+}
+inline ::std::string* OutputChunk::release_std_err() {
+  clear_has_std_err();
+  if (std_err_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = std_err_;
+    std_err_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void OutputChunk::set_allocated_std_err(::std::string* std_err) {
+  if (std_err_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete std_err_;
+  }
+  if (std_err) {
+    set_has_std_err();
+    std_err_ = std_err;
+  } else {
+    clear_has_std_err();
+    std_err_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.OutputChunk.std_err)
+}
+
+// -------------------------------------------------------------------
+
+// MemoryChunk
+
+// optional uint64 request_id = 1;
+inline bool MemoryChunk::has_request_id() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void MemoryChunk::set_has_request_id() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void MemoryChunk::clear_has_request_id() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void MemoryChunk::clear_request_id() {
+  request_id_ = GOOGLE_ULONGLONG(0);
+  clear_has_request_id();
+}
+inline ::google::protobuf::uint64 MemoryChunk::request_id() const {
+  // @@protoc_insertion_point(field_get:rpc.MemoryChunk.request_id)
+  return request_id_;
+}
+inline void MemoryChunk::set_request_id(::google::protobuf::uint64 value) {
+  set_has_request_id();
+  request_id_ = value;
+  // @@protoc_insertion_point(field_set:rpc.MemoryChunk.request_id)
+}
+
+// required uint32 region_index = 2;
+inline bool MemoryChunk::has_region_index() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void MemoryChunk::set_has_region_index() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void MemoryChunk::clear_has_region_index() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void MemoryChunk::clear_region_index() {
+  region_index_ = 0u;
+  clear_has_region_index();
+}
+inline ::google::protobuf::uint32 MemoryChunk::region_index() const {
+  // @@protoc_insertion_point(field_get:rpc.MemoryChunk.region_index)
+  return region_index_;
+}
+inline void MemoryChunk::set_region_index(::google::protobuf::uint32 value) {
+  set_has_region_index();
+  region_index_ = value;
+  // @@protoc_insertion_point(field_set:rpc.MemoryChunk.region_index)
+}
+
+// required uint32 offset = 3;
+inline bool MemoryChunk::has_offset() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void MemoryChunk::set_has_offset() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void MemoryChunk::clear_has_offset() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void MemoryChunk::clear_offset() {
+  offset_ = 0u;
+  clear_has_offset();
+}
+inline ::google::protobuf::uint32 MemoryChunk::offset() const {
+  // @@protoc_insertion_point(field_get:rpc.MemoryChunk.offset)
+  return offset_;
+}
+inline void MemoryChunk::set_offset(::google::protobuf::uint32 value) {
+  set_has_offset();
+  offset_ = value;
+  // @@protoc_insertion_point(field_set:rpc.MemoryChunk.offset)
+}
+
+// required bytes data = 4;
+inline bool MemoryChunk::has_data() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void MemoryChunk::set_has_data() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void MemoryChunk::clear_has_data() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void MemoryChunk::clear_data() {
+  if (data_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    data_->clear();
+  }
+  clear_has_data();
+}
+inline const ::std::string& MemoryChunk::data() const {
+  // @@protoc_insertion_point(field_get:rpc.MemoryChunk.data)
+  return *data_;
+}
+inline void MemoryChunk::set_data(const ::std::string& value) {
+  set_has_data();
+  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    data_ = new ::std::string;
+  }
+  data_->assign(value);
+  // @@protoc_insertion_point(field_set:rpc.MemoryChunk.data)
+}
+inline void MemoryChunk::set_data(const char* value) {
+  set_has_data();
+  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    data_ = new ::std::string;
+  }
+  data_->assign(value);
+  // @@protoc_insertion_point(field_set_char:rpc.MemoryChunk.data)
+}
+inline void MemoryChunk::set_data(const void* value, size_t size) {
+  set_has_data();
+  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    data_ = new ::std::string;
+  }
+  data_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:rpc.MemoryChunk.data)
+}
+inline ::std::string* MemoryChunk::mutable_data() {
+  set_has_data();
+  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    data_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:rpc.MemoryChunk.data)
+  return data_;
+}
+inline ::std::string* MemoryChunk::release_data() {
+  clear_has_data();
+  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = data_;
+    data_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void MemoryChunk::set_allocated_data(::std::string* data) {
+  if (data_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete data_;
+  }
+  if (data) {
+    set_has_data();
+    data_ = data;
+  } else {
+    clear_has_data();
+    data_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:rpc.MemoryChunk.data)
+}
+
+// -------------------------------------------------------------------
+
 // AnalyzeExternalRefsRequest
 
 // required uint32 ea_from = 1;
@@ -0,0 +1,80 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/* Wire format shared by labeless_ida and labeless_olly.
+ *
+ * Every message is prefixed with a fixed-size Header followed by exactly
+ * Header::size bytes of payload (a serialized rpc::* message).
+ * The first frame on a connection must be FT_Hello in both directions,
+ * the peers agree on min(client version, server version).
+ *
+ * Peers that don't start the stream with kMagic are served in the legacy
+ * mode (raw rpc::Execute, end of message detected by an empty input queue).
+ *
+ * Protocol versions:
+ *  1 - framing, Hello handshake, pipelined requests (request_id)
+ *  2 - FT_MemoryChunk frames may precede the FT_Response of a streamed request
+ *  3 - rpc::MakeNamesRequest and rpc::MakeCommentsRequest may carry rpc::PackedNames
+ *  4 - rpc::Hello::relocations are applied to rpc::MakeNamesRequest and rpc::MakeCommentsRequest
+ *  5 - FT_OutputChunk frames may precede the FT_Response of a streamed request
+ *  6 - rpc::Execute::script_extern_marshal
+ */
+
+namespace netframe {
+
+static const uint32_t kMagic			= 0x52464C4C; // "LLFR"
+static const uint8_t kProtocolVersion	= 6;
+static const uint8_t kStreamingProtocolVersion = 2;
+static const uint8_t kPackedNamesProtocolVersion = 3;
+static const uint8_t kRelocationsProtocolVersion = 4;
+static const uint8_t kOutputStreamingProtocolVersion = 5;
+static const uint8_t kBinaryExternProtocolVersion = 6;
+static const uint32_t kMaxPayloadSize	= 0x40000000;
+
+enum FrameType
+{
+	FT_Unknown	= 0,
+	FT_Hello	= 1, // rpc::Hello
+	FT_Execute	= 2, // rpc::Execute
+	FT_Response	= 3, // rpc::Response
+	FT_MemoryChunk	= 4, // rpc::MemoryChunk, protocol version >= 2
+	FT_OutputChunk	= 5  // rpc::OutputChunk, protocol version >= 5
+};
+
+#pragma pack(push, 1)
+struct Header
+{
+	uint32_t	magic;
+	uint8_t		version;
+	uint8_t		type;
+	uint8_t		codec;		// compression::Codec of the payload, see compression.h
+	uint8_t		reserved;
+	uint32_t	size;		// of the payload on the wire
+};
+#pragma pack(pop)
+
+inline Header makeHeader(FrameType type, uint32_t size, uint8_t version = kProtocolVersion)
+{
+	Header rv = {};
+	rv.magic = kMagic;
+	rv.version = version;
+	rv.type = static_cast<uint8_t>(type);
+	rv.size = size;
+	return rv;
+}
+
+inline bool isValid(const Header& h)
+{
+	return h.magic == kMagic && h.size <= kMaxPayloadSize;
+}
+
+} // netframe
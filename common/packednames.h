@@ -0,0 +1,80 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+/* rpc::PackedNames coding shared by labeless_ida (writer) and labeless_olly (reader).
+ *
+ * The names go by ascending address, each one is stored as the address delta from the previous one,
+ * the count of leading bytes shared with the previous name and the rest of its bytes appended to suffixes.
+ * The message type is a template parameter, so the coding is tested without protobuf.
+ */
+
+namespace packednames {
+
+template <typename Packed>
+class Writer
+{
+public:
+	explicit Writer(Packed* packed)
+		: m_Packed(packed)
+		, m_PrevEA(0)
+	{}
+
+	// the names have to be added sorted by ea
+	void add(uint32_t ea, const std::string& name)
+	{
+		size_t shared = 0;
+		while (shared < m_Prev.size() && shared < name.size() && m_Prev[shared] == name[shared])
+			++shared;
+
+		m_Packed->add_ea_deltas(ea - m_PrevEA);
+		m_Packed->add_shared_sizes(static_cast<uint32_t>(shared));
+		m_Packed->add_suffix_sizes(static_cast<uint32_t>(name.size() - shared));
+		m_Packed->mutable_suffixes()->append(name, shared, std::string::npos);
+		m_PrevEA = ea;
+		m_Prev = name;
+	}
+
+private:
+	Packed*		m_Packed;
+	uint32_t	m_PrevEA;
+	std::string	m_Prev;
+};
+
+// calls f(ea, name) for each name, false if the columns don't match each other
+template <typename Packed, typename F>
+bool forEach(const Packed& packed, F f)
+{
+	const int count = packed.ea_deltas_size();
+	if (packed.shared_sizes_size() != count || packed.suffix_sizes_size() != count)
+		return false;
+
+	const std::string& suffixes = packed.suffixes();
+	size_t pos = 0;
+	uint32_t ea = 0;
+	std::string name;
+	for (int i = 0; i < count; ++i)
+	{
+		const size_t shared = packed.shared_sizes(i);
+		const size_t suffixSize = packed.suffix_sizes(i);
+		if (shared > name.size() || suffixSize > suffixes.size() - pos)
+			return false;
+		name.resize(shared);
+		name.append(suffixes, pos, suffixSize);
+		pos += suffixSize;
+		ea += packed.ea_deltas(i);
+		f(ea, name);
+	}
+	return pos == suffixes.size();
+}
+
+} // packednames
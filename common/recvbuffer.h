@@ -0,0 +1,68 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#pragma once
+
+#include <new>
+#include <string>
+
+/* Receive buffers reused by the next frames of a connection, shared by labeless_ida and labeless_olly.
+ *
+ * A buffer keeps the capacity of the largest frame received, unless it is over kKeptCapacity:
+ * the memory of a huge dump isn't held until the next one.
+ */
+
+namespace recvbuffer {
+
+static const size_t kKeptCapacity = 16 * 1024 * 1024;
+
+// reallocations of a buffer, reported when the connection is closed
+struct Stats
+{
+	unsigned	growths;
+	size_t		peak; // capacity
+
+	Stats()
+		: growths(0)
+		, peak(0)
+	{}
+
+	void update(size_t oldCapacity, size_t newCapacity)
+	{
+		if (newCapacity <= oldCapacity)
+			return;
+		++growths;
+		if (newCapacity > peak)
+			peak = newCapacity;
+	}
+};
+
+// false if there is not enough memory
+inline bool resize(std::string& buff, size_t size, Stats& stats)
+{
+	const size_t capacity = buff.capacity();
+	try
+	{
+		buff.resize(size);
+	}
+	catch (const std::bad_alloc&)
+	{
+		return false;
+	}
+	stats.update(capacity, buff.capacity());
+	return true;
+}
+
+// called once the frame is handled
+inline void release(std::string& buff)
+{
+	if (buff.capacity() > kKeptCapacity)
+		std::string().swap(buff);
+}
+
+} // recvbuffer
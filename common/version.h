@@ -18,7 +18,7 @@
 #define VERSION_MAJOR               1
 #define VERSION_MINOR               0
 #define VERSION_REVISION            0
-#define VERSION_BUILD               7
+#define VERSION_BUILD               8
 
 
 #define VER_FILE_VERSION            VERSION_MAJOR, VERSION_MINOR, VERSION_REVISION, VERSION_BUILD
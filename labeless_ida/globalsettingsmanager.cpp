@@ -110,6 +110,11 @@ QString GlobalSettingsManger::keyToString(GlobalSettingsKey key)
 			{ GSK_LightPalette, "light_palette" },
 			{ GSK_DarkPalette, "dark_palette" },
 			{ GSK_OverwriteWarning, "overwrite_warning" },
+			{ GSK_MaxRequestsInFlight, "max_requests_in_flight" },
+			{ GSK_Compression, "compression" },
+			{ GSK_SyncBatchNames, "sync_batch_names" },
+			{ GSK_SyncBatchBytes, "sync_batch_bytes" },
+			{ GSK_PullOverwrite, "pull_overwrite" },
 		};
 		for (unsigned i = 0; i < _countof(kNames); ++i)
 			names[kNames[i].k] = kNames[i].name;
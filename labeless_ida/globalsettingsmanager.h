@@ -26,6 +26,11 @@ enum GlobalSettingsKey
 	GSK_LightPalette = 8,
 	GSK_DarkPalette = 9,
 	GSK_OverwriteWarning = 10,
+	GSK_MaxRequestsInFlight = 11,
+	GSK_Compression = 12,
+	GSK_SyncBatchNames = 13,
+	GSK_SyncBatchBytes = 14,
+	GSK_PullOverwrite = 15,
 };
 
 typedef std::shared_ptr<QSettings> QSettingsPtr;
@@ -9,15 +9,23 @@
 #include "hlp.h"
 #include "labeless_ida.h"
 #include <WinSock2.h>
+#include <segment.hpp>
 
+#include <algorithm>
 #include <sstream>
 #include <QString>
 
+#include <QCryptographicHash>
 #include <QMetaObject>
+#include <QRegExp>
+#include <QStringList>
 
 #include <google/protobuf/message.h>
 #include <google/protobuf/io/coded_stream.h>
 
+#include "../common/cpp/rpc.pb.h"
+#include "../common/version.h"
+
 
 namespace hlp
 {
@@ -213,20 +221,153 @@ qlist<ea_t> dataRefsToCode(ea_t ea)
 	return refs;
 }
 
+bool isCodeOrDataEA(ea_t ea, bool nonCodeNames)
+{
+	auto flags = get_aflags(ea);
+	if ((flags & (1 << 0xE)))
+		return true;
+	flags = get_flags_ex(ea, 1);
+	return ::isEnabled(ea) && (isCode(flags) || (nonCodeNames && isData(flags)));
+}
+
 ea_t getNextCodeOrDataEA(ea_t ea, bool nonCodeNames)
 {
 	while (BADADDR != (ea = next_not_tail(ea)))
 	{
-		auto flags = get_aflags(ea);
-		if ((flags & (1 << 0xE)))
+		if (isCodeOrDataEA(ea, nonCodeNames))
 			return ea;
-		flags = get_flags_ex(ea, 1);
-		if (::isEnabled(ea) && (isCode(flags) || (nonCodeNames && isData(flags))))
+	}
+	return BADADDR;
+}
+
+ea_t getNextNamedCodeOrDataEA(ea_t ea, ea_t maxEA, bool nonCodeNames)
+{
+	// the kernel skips the unnamed items by their flags, much faster than asking each item for its name.
+	// f_hasName() is the SDK helper with the testf_t signature, hasName() takes the flags only
+	while (BADADDR != (ea = nextthat(ea, maxEA, f_hasName, nullptr)))
+	{
+		if (isCodeOrDataEA(ea, nonCodeNames))
 			return ea;
 	}
 	return BADADDR;
 }
 
+bool memoryPageHashes(ea_t ea, uint32 size, uint32 pageSize, std::vector<uint64_t>& hashes)
+{
+	hashes.clear();
+	if (!pageSize)
+		return false;
+	// nothing to compare with on the first dump of the region
+	const segment_t* seg = getseg(ea);
+	if (!seg || seg->endEA < ea + size)
+		return false;
+	hashes.reserve((size + pageSize - 1) / pageSize);
+	QByteArray page(pageSize, '\0');
+	for (uint32 offset = 0; offset < size; offset += pageSize)
+	{
+		const uint32 len = qMin(pageSize, size - offset);
+		page.resize(len);
+		if (!get_many_bytes(ea + offset, page.data(), len))
+		{
+			hashes.clear();
+			return false;
+		}
+		const QByteArray digest = QCryptographicHash::hash(page, QCryptographicHash::Md5);
+		uint64_t h = 0;
+		memcpy(&h, digest.constData(), sizeof(h));
+		hashes.push_back(h);
+	}
+	return true;
+}
+
+bool parseRelocations(const QString& text, RelocationList& relocations, QString& error)
+{
+	static const QRegExp kRxRelocation("^(?:0x)?([0-9a-f]{1,8})\\s*-\\s*(?:0x)?([0-9a-f]{1,8})\\s*=\\s*(?:0x)?([0-9a-f]{1,8})$",
+		Qt::CaseInsensitive);
+
+	relocations.clear();
+	const QStringList items = text.split(QRegExp("[;\\n]"), QString::SkipEmptyParts);
+	foreach (const QString& item, items)
+	{
+		const QString v = item.trimmed();
+		if (v.isEmpty())
+			continue;
+		QRegExp rx(kRxRelocation);
+		if (!rx.exactMatch(v))
+		{
+			error = QString("Invalid relocation \"%1\", should be \"start-end=remote_start\"").arg(v);
+			return false;
+		}
+		const Relocation r(rx.cap(1).toUInt(nullptr, 16), rx.cap(2).toUInt(nullptr, 16), rx.cap(3).toUInt(nullptr, 16));
+		if (r.start >= r.end)
+		{
+			error = QString("Empty relocation range \"%1\"").arg(v);
+			return false;
+		}
+		relocations.push_back(r);
+	}
+	std::stable_sort(relocations.begin(), relocations.end(), [](const Relocation& l, const Relocation& r) {
+		return l.start < r.start;
+	});
+	for (int i = 1; i < relocations.size(); ++i)
+	{
+		if (relocations.at(i).start < relocations.at(i - 1).end)
+		{
+			error = QString("Relocation ranges %1 and %2 are overlapped")
+				.arg(relocations.at(i - 1).start, 8, 16, QChar('0'))
+				.arg(relocations.at(i).start, 8, 16, QChar('0'));
+			return false;
+		}
+	}
+	return true;
+}
+
+QString relocationsToString(const RelocationList& relocations)
+{
+	QStringList rv;
+	foreach (const Relocation& r, relocations)
+	{
+		rv.append(QString("0x%1-0x%2=0x%3")
+			.arg(r.start, 8, 16, QChar('0'))
+			.arg(r.end, 8, 16, QChar('0'))
+			.arg(r.remoteStart, 8, 16, QChar('0')));
+	}
+	return rv.join("; ");
+}
+
+bool parseOllyAddresses(const QString& text, OllyAddressList& addresses, QString& error)
+{
+	static const QRegExp kRxAddress("^([a-zA-Z0-9\\-\\.]+):(\\d{1,5})$");
+
+	addresses.clear();
+	const QStringList items = text.split(QRegExp("[;\\n]"), QString::SkipEmptyParts);
+	foreach (const QString& item, items)
+	{
+		const QString v = item.trimmed();
+		if (v.isEmpty())
+			continue;
+		QRegExp rx(kRxAddress);
+		const uint port = rx.exactMatch(v) ? rx.cap(2).toUInt() : 0;
+		if (!port || port > UINT16_MAX)
+		{
+			error = QString("Invalid Olly address \"%1\", should be \"host:port\"").arg(v);
+			return false;
+		}
+		const OllyAddress addr(rx.cap(1).toStdString(), static_cast<uint16_t>(port));
+		if (!addresses.contains(addr))
+			addresses.push_back(addr);
+	}
+	return true;
+}
+
+QString ollyAddressesToString(const OllyAddressList& addresses)
+{
+	QStringList rv;
+	foreach (const OllyAddress& addr, addresses)
+		rv.append(QString("%1:%2").arg(QString::fromStdString(addr.host)).arg(addr.port));
+	return rv.join("; ");
+}
+
 namespace protobuf {
 
 bool parseBigMessage(::google::protobuf::Message& msg, const std::string& data)
@@ -258,56 +399,159 @@ qstring wsaErrorToString()
 	return rv;
 }
 
-bool sockSendString(SOCKET s, const std::string& str)
+bool sendAll(SOCKET s, const std::string& buff, std::string& error)
 {
-	if (INVALID_SOCKET == s || str.empty())
-		return false;
-
-	const char* ptrBuffer = str.c_str();
-	int bytesToSend = int(str.length());
-
-	while (bytesToSend > 0)
+	unsigned total_sent = 0;
+	int sent;
+	while (total_sent < buff.length())
 	{
-		const int retVal = send(s, ptrBuffer, bytesToSend, 0);
-		if (SOCKET_ERROR == retVal)
+		if (SOCKET_ERROR == (sent = send(s, buff.c_str() + total_sent, buff.length() - total_sent, 0)))
 		{
-			addLogMsg(QString("send() failed. Error: %1\n").arg(wsaErrorToString().c_str()).toStdString().c_str());
+			error = wsaErrorToString().c_str();
 			return false;
 		}
-		bytesToSend -= retVal;
-		ptrBuffer += retVal;
+		total_sent += static_cast<unsigned>(sent);
 	}
-	return true;
+	return total_sent == buff.size();
 }
 
-bool sockRecvAll(SOCKET s, std::string& result)
+bool recvAll(SOCKET s, char* buff, size_t len)
 {
-	result.clear();
-
-	static const uint kBuffSize = 0x5000;
-	char buff[kBuffSize];
-	int rv = 0;
-	std::stringstream response;
-	while ((rv = recv(s, buff, kBuffSize, 0)) > 0)
-		response << std::string(buff, buff + rv);
-	result = response.str();
+	while (len)
+	{
+		const int rv = recv(s, buff, static_cast<int>(len), 0);
+		if (rv <= 0)
+			return false;
+		buff += rv;
+		len -= rv;
+	}
 	return true;
 }
 
-bool sendAll(SOCKET s, const std::string& buff, std::string& error)
+bool sendFrame(SOCKET s, netframe::FrameType type, const std::string& payload, std::string& error, uint8_t version, uint8_t codec)
 {
-	unsigned total_sent = 0;
-	int sent;
-	while (total_sent < buff.length())
+	if (INVALID_SOCKET == s)
+		return false;
+
+	std::string packed;
+	const bool isPacked = compression::pack(compression::Codec(codec), payload, packed);
+	const std::string& wire = isPacked ? packed : payload;
+
+	netframe::Header h = netframe::makeHeader(type, static_cast<uint32_t>(wire.length()), version);
+	h.codec = isPacked ? codec : compression::CODEC_None;
+	WSABUF wb[2] = {
+		{ sizeof(h), reinterpret_cast<char*>(&h) },
+		{ static_cast<ULONG>(wire.length()), const_cast<char*>(wire.c_str()) }
+	};
+	WSABUF* bufs = wb;
+	DWORD count = _countof(wb);
+	while (count)
 	{
-		if (SOCKET_ERROR == (sent = send(s, buff.c_str() + total_sent, buff.length() - total_sent, 0)))
+		DWORD sent = 0;
+		if (SOCKET_ERROR == WSASend(s, bufs, count, &sent, 0, nullptr, nullptr))
 		{
 			error = wsaErrorToString().c_str();
 			return false;
 		}
-		total_sent += static_cast<unsigned>(sent);
+		while (count && sent >= bufs->len)
+		{
+			sent -= bufs->len;
+			++bufs;
+			--count;
+		}
+		if (count)
+		{
+			bufs->buf += sent;
+			bufs->len -= sent;
+		}
 	}
-	return total_sent == buff.size();
+	return true;
+}
+
+bool recvFrame(SOCKET s, netframe::Header& header, std::string& payload, std::string* packedBuff)
+{
+	payload.clear();
+	if (!recvAll(s, reinterpret_cast<char*>(&header), sizeof(header)))
+		return false;
+	if (!netframe::isValid(header))
+	{
+		addLogMsg("%s: invalid frame header received\n", __FUNCTION__);
+		return false;
+	}
+
+	// receive right into the caller's buffer, the packed one is only needed for compressed frames
+	std::string localPacked;
+	std::string& wire = header.codec == compression::CODEC_None
+		? payload
+		: packedBuff ? *packedBuff : localPacked;
+	try
+	{
+		wire.resize(header.size);
+	}
+	catch (const std::bad_alloc&)
+	{
+		addLogMsg("%s: unable to allocate 0x%08X bytes\n", __FUNCTION__, header.size);
+		return false;
+	}
+	if (!wire.empty() && !recvAll(s, &wire[0], wire.size()))
+		return false;
+	if (header.codec == compression::CODEC_None)
+		return true;
+
+	if (!compression::unpack(compression::Codec(header.codec), wire.data(), wire.size(), payload))
+	{
+		addLogMsg("%s: unable to unpack frame, codec: %u\n", __FUNCTION__, unsigned(header.codec));
+		return false;
+	}
+	return true;
+}
+
+bool handshake(SOCKET s, uint32_t offeredCodecs, const RelocationList& relocations, uint8_t& protocolVersion,
+	uint8_t& codec, std::string& error)
+{
+	protocolVersion = 0;
+	codec = compression::CODEC_None;
+
+	rpc::Hello hello;
+	hello.set_protocol_version(netframe::kProtocolVersion);
+	hello.set_labeless_version(LABELESS_VER_STR);
+	hello.set_codecs(offeredCodecs);
+	for (auto it = relocations.constBegin(); it != relocations.constEnd(); ++it)
+	{
+		rpc::Relocation* const r = hello.add_relocations();
+		r->set_start(it->start);
+		r->set_end(it->end);
+		r->set_remote_start(it->remoteStart);
+	}
+	if (!sendFrame(s, netframe::FT_Hello, hello.SerializeAsString(), error))
+		return false;
+
+	netframe::Header header;
+	std::string payload;
+	if (!recvFrame(s, header, payload))
+	{
+		error = "No handshake response, Labeless Olly is probably too old. Error: ";
+		error += wsaErrorToString().c_str();
+		return false;
+	}
+	rpc::Hello reply;
+	if (header.type != netframe::FT_Hello || !reply.ParseFromString(payload))
+	{
+		error = "Invalid handshake response";
+		return false;
+	}
+	if (!reply.protocol_version() || reply.protocol_version() > netframe::kProtocolVersion)
+	{
+		error = "Unsupported protocol version, Labeless Olly: " + reply.labeless_version();
+		return false;
+	}
+	protocolVersion = static_cast<uint8_t>(reply.protocol_version());
+	if (!relocations.isEmpty() && protocolVersion < netframe::kRelocationsProtocolVersion)
+		addLogMsg("%s: Labeless Olly %s ignores the relocation map, remote module base is used for all the names\n",
+			__FUNCTION__, reply.labeless_version().c_str());
+	// old servers don't know about codecs and never pack
+	codec = static_cast<uint8_t>(compression::choose(reply.codecs() & offeredCodecs));
+	return true;
 }
 
 } // net
@@ -9,7 +9,11 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <QString>
 #include "types.h"
+#include "../common/compression.h"
+#include "../common/netframe.h"
 
 namespace google	{
 namespace protobuf	{
@@ -30,7 +34,18 @@ void addLogMsg(const char* fmt, ...);
 std::string memoryProtectToStr(DWORD p);
 qlist<ea_t> codeRefsToCode(ea_t ea);
 qlist<ea_t> dataRefsToCode(ea_t ea);
+bool isCodeOrDataEA(ea_t ea, bool nonCodeNames);
 ea_t getNextCodeOrDataEA(ea_t ea, bool nonCodeNames);
+// like getNextCodeOrDataEA(), but only the items having a name below maxEA
+ea_t getNextNamedCodeOrDataEA(ea_t ea, ea_t maxEA, bool nonCodeNames);
+// MD5 of every pageSize bytes (first 8 bytes as little endian), false if no segment of the database holds the range
+bool memoryPageHashes(ea_t ea, uint32 size, uint32 pageSize, std::vector<uint64_t>& hashes);
+// "start-end=remote_start" items separated by ';' or new lines, hex. Sorted by start, false if overlapped
+bool parseRelocations(const QString& text, RelocationList& relocations, QString& error);
+QString relocationsToString(const RelocationList& relocations);
+// "host:port" items separated by ';' or new lines
+bool parseOllyAddresses(const QString& text, OllyAddressList& addresses, QString& error);
+QString ollyAddressesToString(const OllyAddressList& addresses);
 
 namespace protobuf {
 
@@ -41,9 +56,16 @@ bool parseBigMessage(::google::protobuf::Message& msg, const std::string& data);
 namespace net {
 
 qstring wsaErrorToString();
-bool sockSendString(SOCKET s, const std::string& str);
-bool sockRecvAll(SOCKET s, std::string& result);
 bool sendAll(SOCKET s, const std::string& buff, std::string& error);
+bool recvAll(SOCKET s, char* buff, size_t len);
+// packs the payload if it's worth it and codec isn't compression::CODEC_None
+bool sendFrame(SOCKET s, netframe::FrameType type, const std::string& payload, std::string& error,
+	uint8_t version = netframe::kProtocolVersion, uint8_t codec = compression::CODEC_None);
+// header.size is the size on the wire, payload is unpacked.
+// payload (and packedBuff, used for compressed frames if set) keep their capacity, so pass the same buffers to reuse them
+bool recvFrame(SOCKET s, netframe::Header& header, std::string& payload, std::string* packedBuff = nullptr);
+bool handshake(SOCKET s, uint32_t offeredCodecs, const RelocationList& relocations, uint8_t& protocolVersion,
+	uint8_t& codec, std::string& error);
 
 } // net
 } // hlp
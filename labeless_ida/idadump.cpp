@@ -17,6 +17,8 @@ IDADump::IDADump()
 	: state(ST_None)
 	, wipe(false)
 	, analyzePEHeader(true)
+	, memoryImportStarted(false)
+	, memoryImportReady(false)
 {
 }
 
@@ -38,6 +38,8 @@ struct IDADump
 public:
 	bool wipe;
 	bool analyzePEHeader;
+	bool memoryImportStarted; // the database is prepared for the regions
+	bool memoryImportReady;
 	State state;
 
 	ExportItemList exports;
@@ -68,6 +68,7 @@
 #include "pyollyview.h"
 #include "pythonpalettemanager.h"
 #include "settingsdialog.h"
+#include "sync/syncbatch.h"
 
 namespace {
 
@@ -99,6 +100,12 @@ enum SettingsCtrl
 
 
 static const uint32_t kDefaultExternSegLen = 0xF000;
+static const unsigned kMaxRenameBatch = 4096;
+static const unsigned kDefaultSyncBatchNames = 1000;
+static const unsigned kDefaultSyncBatchBytes = 64 * 1024;
+static const unsigned kMaxReportedConflicts = 20;
+static const int kRenameDebounceMs = 100;
+static const qint64 kRenameMaxDelayMs = 1000;
 static const Settings kDefaultSettings(
 	"127.0.0.1",
 	3852,
@@ -118,7 +125,8 @@ enum LabelessNodeAltType
 	LNAT_Port = 0,
 	LNAT_RmoteModBase,
 	LNAT_Demangle,
-	LNAT_LocalLabels
+	LNAT_LocalLabels,
+	LNAT_RelocationsCount
 };
 
 void protobufLogHandler(::google::protobuf::LogLevel level, const char* filename, int line,	const std::string& message)
@@ -159,10 +167,80 @@ void protobufLogHandler(::google::protobuf::LogLevel level, const char* filename
 static const std::string kNetNodeLabeless = "$ labeless";
 static const std::string kNetNodeExternSegData = "$ externsegdata";
 static const std::string kNetNodeExternSegImps = "$ externsegimps";
+static const std::string kNetNodeSyncJournal = "$ labeless syncjournal";
+static const char kSyncJournalNameTag = 'N';
+static const char kSyncJournalCommentTag = 'C';
+static const char kRelocationsTag = 'R'; // of kNetNodeLabeless supvals, Relocation each
+static const char kMirrorsTag = 'M'; // of kNetNodeLabeless supstr, hlp::ollyAddressesToString()
 static const std::string kAPIEnumName = "OLD_API_EXTERN_CONSTS";
 static const QString kLabelessMenuObjectName = "labeless_menu";
 static const QString kLabelessMenuLoadStubItemName = "act-load-stub";
 
+unsigned syncBatchNamesLimit()
+{
+	return qMax(1u, GlobalSettingsManger::instance().value(GSK_SyncBatchNames, kDefaultSyncBatchNames).toUInt());
+}
+
+// small batches are applied by Labeless Olly one by one, so its GUI isn't frozen by a long sync
+template <typename DataList>
+QList<DataList> splitSyncData(const DataList& dl)
+{
+	const size_t maxBytes = qMax(1u, GlobalSettingsManger::instance().value(GSK_SyncBatchBytes, kDefaultSyncBatchBytes).toUInt());
+	QList<DataList> rv;
+	syncbatch::split(dl, syncBatchNamesLimit(), maxBytes, rv);
+	return rv;
+}
+
+// FNV-1a of the text synchronized to an address, the bases are mixed in so a rebase invalidates the journal
+uint64_t syncJournalHash(const std::string& text, ea_t base, ea_t remoteBase)
+{
+	uint64_t h = 14695981039346656037ULL;
+	const auto mix = [&h](const void* data, size_t size) {
+		const uint8_t* p = static_cast<const uint8_t*>(data);
+		for (size_t i = 0; i < size; ++i)
+			h = (h ^ p[i]) * 1099511628211ULL;
+	};
+	mix(text.data(), text.size());
+	mix(&base, sizeof(base));
+	mix(&remoteBase, sizeof(remoteBase));
+	return h;
+}
+
+// drops the items whose text Labeless Olly already has, according to the session cache.
+// The items kept are going to be sent: their acknowledged hashes are forgotten and the queued ones replaced,
+// otherwise A (acknowledged), B (in flight), A would drop the second A and leave B in Olly
+template <typename DataList>
+DataList dropUnchanged(const DataList& dl, QHash<uint32_t, uint64_t>& sent, QHash<uint32_t, uint64_t>& queued,
+	ea_t base, ea_t remoteBase)
+{
+	DataList rv;
+	for (auto it = dl.constBegin(); it != dl.constEnd(); ++it)
+	{
+		const uint64_t h = syncJournalHash(it->label, base, remoteBase);
+		const auto sentIt = sent.find(it->ea);
+		if (sentIt != sent.end())
+		{
+			if (sentIt.value() == h)
+				continue;
+			sent.erase(sentIt);
+		}
+		queued[it->ea] = h;
+		rv.push_back(*it);
+	}
+	return rv;
+}
+
+// true if the text acknowledged is the last one queued for the address, so Olly has it now
+bool takeQueuedHash(QHash<uint32_t, uint64_t>& queued, uint32_t ea, uint64_t h)
+{
+	const auto it = queued.find(ea);
+	if (it == queued.end())
+		return true;
+	if (it.value() != h)
+		return false; // an other text of it is still in flight
+	queued.erase(it);
+	return true;
+}
 
 
 } // anonymous
@@ -175,6 +253,7 @@ Labeless::Labeless()
 	, m_ThreadLock(QMutex::Recursive)
 	, m_SynchronizeAllNow(false)
 	, m_LabelSyncOnRenameIfZero(0)
+	, m_PendingRenamesReceived(0)
 	, m_ShowAllResponsesInLog(true)
 {
 	msg("%s\n", __FUNCTION__);
@@ -183,6 +262,9 @@ Labeless::Labeless()
 
 	m_Settings = kDefaultSettings;
 
+	m_RenameFlushTimer.setSingleShot(true);
+	CHECKED_CONNECT(connect(&m_RenameFlushTimer, SIGNAL(timeout()), this, SLOT(flushPendingRenames())));
+
 	::google::protobuf::SetLogHandler(protobufLogHandler);
 }
 
@@ -216,6 +298,16 @@ Settings Labeless::loadSettings()
 			m_Settings.remoteModBase = n.altval(LNAT_RmoteModBase);
 			m_Settings.demangle = n.altval(LNAT_Demangle) != 0;
 			m_Settings.localLabels = n.altval(LNAT_LocalLabels) != 0;
+			m_Settings.relocations.clear();
+			for (nodeidx_t i = 0, e = n.altval(LNAT_RelocationsCount); i < e; ++i)
+			{
+				Relocation r;
+				if (n.supval(i, &r, sizeof(r), kRelocationsTag) == sizeof(r))
+					m_Settings.relocations.push_back(r);
+			}
+			QString error;
+			if (n.supstr(0, buff, MAXSTR, kMirrorsTag) <= 0 || !hlp::parseOllyAddresses(buff, m_Settings.mirrors, error))
+				m_Settings.mirrors.clear();
 		}
 		else
 		{
@@ -245,6 +337,11 @@ void Labeless::storeSettings()
 	n.altset(LNAT_RmoteModBase, m_Settings.remoteModBase);
 	n.altset(LNAT_Demangle, m_Settings.demangle ? 1 : 0);
 	n.altset(LNAT_LocalLabels, m_Settings.localLabels ? 1 : 0);
+	n.supdel_all(kRelocationsTag);
+	for (int i = 0; i < m_Settings.relocations.size(); ++i)
+		n.supset(i, &m_Settings.relocations.at(i), sizeof(Relocation), kRelocationsTag);
+	n.altset(LNAT_RelocationsCount, m_Settings.relocations.size());
+	n.supset(0, hlp::ollyAddressesToString(m_Settings.mirrors).toStdString().c_str(), 0, kMirrorsTag);
 
 	// global settings
 	do {
@@ -268,6 +365,16 @@ void Labeless::setTargetHostAddr(const std::string& ip, WORD port)
 }
 
 void Labeless::onSyncronizeAllRequested()
+{
+	syncronizeAll(false);
+}
+
+void Labeless::onForceSyncronizeAllRequested()
+{
+	syncronizeAll(true);
+}
+
+void Labeless::syncronizeAll(bool force)
 {
 #define OLLY_TEXTLEN 256 // TEXTLEN from Olly's SDK
 
@@ -277,10 +384,31 @@ void Labeless::onSyncronizeAllRequested()
 		return;
 
 	m_SynchronizeAllNow = true;
-	msg("Labeless: do sync all now...\n");
+	msg("Labeless: do %s sync now...\n", force ? "full" : "incremental");
+	if (force)
+	{
+		m_SentNameHashes.clear();
+		m_SentCommentHashes.clear();
+	}
 
+	// the names acknowledged by Labeless Olly before are skipped unless the full sync is forced
+	const netnode journal(kNetNodeSyncJournal.c_str());
+	const bool useJournal = !force && journal != BADNODE;
+	const ea_t base = get_imagebase();
+	const ea_t remoteBase = m_Settings.remoteModBase;
+	unsigned unchanged = 0;
+	const unsigned batchNames = syncBatchNamesLimit();
+	const SyncProgressPtr progress = std::make_shared<SyncProgress>();
+
+	// the IDA kernel isn't thread safe, so the names are collected here, but every full batch is
+	// queued at once and the RPC thread sends it while the rest is being collected
 	FuncNameSync::DataList labelPoints;
-	LocalLabelsSync::DataList commentPoints;
+	const auto flushBatch = [&]() {
+		if (labelPoints.isEmpty())
+			return;
+		addFuncNameSyncData(labelPoints, RpcData::PR_BulkSync, progress);
+		labelPoints.clear();
+	};
 
 	qstring name;
 	int flags = 0;
@@ -294,31 +422,176 @@ void Labeless::onSyncronizeAllRequested()
 	{
 		if (is_spec_segm(s->type))
 			continue;
-		ea_t ea = s->startEA;
 
-		while (true)
+		// stop at the segment end, the next segments are visited by the outer loop
+		for (ea_t ea = s->startEA; BADADDR != ea; ea = hlp::getNextNamedCodeOrDataEA(ea, s->endEA, m_Settings.nonCodeNames))
 		{
-			if (get_true_name(&name, ea, flags) > 0 && is_uname(name.c_str()))
+			if (get_true_name(&name, ea, flags) <= 0 || !is_uname(name.c_str()))
+				continue;
+
+			std::string s = name.c_str();
+			if (s.length() >= OLLY_TEXTLEN)
+				s.erase(s.begin() + OLLY_TEXTLEN - 1, s.end());
+			uint64_t synced = 0;
+			if (useJournal &&
+				journal.supval(ea, &synced, sizeof(synced), kSyncJournalNameTag) == sizeof(synced) &&
+				synced == syncJournalHash(s, base, remoteBase))
 			{
-				std::string s = name.c_str();
-				if (s.length() >= OLLY_TEXTLEN)
-					s.erase(s.begin() + OLLY_TEXTLEN - 1, s.end());
-				labelPoints.push_back(FuncNameSync::Data(ea, s));
-				msg("%08X: %s\n", ea, name.c_str());
+				++unchanged;
+				continue;
 			}
-			
-			ea = hlp::getNextCodeOrDataEA(ea, m_Settings.nonCodeNames);
-			if (BADADDR == ea)
-				break;
-			//auto sel_ea = sel2ea(s->sel);
+			labelPoints.push_back(FuncNameSync::Data(ea, s));
+			if (unsigned(labelPoints.size()) >= batchNames)
+				flushBatch();
 		}
 	}
+	flushBatch();
 
-	if (!labelPoints.empty())
-		addFuncNameSyncData(labelPoints);
+	msg("Labeless: %u name(s) queued in %u batch(es), %u unchanged since the last sync, collected in %lld ms\n",
+		progress->total, progress->batches, unchanged, static_cast<long long>(progress->timer.elapsed()));
 	m_SynchronizeAllNow = false;
 }
 
+void Labeless::onPullNamesRequested()
+{
+	auto req = std::make_shared<GetNamesReq>();
+	req->start = inf.minEA;
+	req->end = inf.maxEA;
+	addRpcData(req, RpcReadyToSendHandler(), this, SLOT(onGetNamesFinished()));
+}
+
+void Labeless::onGetNamesFinished()
+{
+	RpcDataPtr rd = qobject_cast<RpcData*>(sender());
+	if (!rd)
+		return;
+	auto req = std::dynamic_pointer_cast<GetNamesReq>(rd->iCmd);
+	if (!req)
+	{
+		msg("%s: Invalid type of ICommand\n", __FUNCTION__);
+		return;
+	}
+	if (!req->error.empty())
+	{
+		msg("%s: %s\n", __FUNCTION__, req->error.c_str());
+		return;
+	}
+
+	// IDA's own names and comments are kept unless "pull_overwrite" global setting is on
+	const bool overwrite = GlobalSettingsManger::instance().value(GSK_PullOverwrite, false).toBool();
+	ScopedEnabler enabler(m_IgnoreRename);
+
+	netnode journal;
+	journal.create(kNetNodeSyncJournal.c_str());
+
+	unsigned labels = 0;
+	unsigned comments = 0;
+	unsigned same = 0;
+	unsigned conflicts = 0;
+	unsigned failed = 0;
+	qstring current;
+	char buff[MAXSTR];
+	for (auto it = req->data.cbegin(); it != req->data.cend(); ++it)
+	{
+		const ea_t ea = it->ea;
+		if (!it->label.empty())
+		{
+			current.qclear();
+			get_true_name(&current, ea, 0);
+			if (it->label == current.c_str())
+			{
+				++same;
+			}
+			else if (has_user_name(get_flags_novalue(ea)) && !overwrite)
+			{
+				if (conflicts++ < kMaxReportedConflicts)
+					msg("%08X: IDA name '%s' is kept, Olly has '%s'\n", ea, current.c_str(), it->label.c_str());
+			}
+			else if (set_name(ea, it->label.c_str(), SN_CHECK | SN_NOWARN) || do_name_anyway(ea, it->label.c_str()))
+			{
+				++labels;
+			}
+			else
+			{
+				++failed;
+			}
+
+			// Olly has the same name now, the next sync shouldn't send it back
+			current.qclear();
+			if (get_true_name(&current, ea, 0) > 0 && it->label == current.c_str())
+			{
+				const uint64_t h = syncJournalHash(it->label, req->base, req->remoteBase);
+				journal.supset(ea, &h, sizeof(h), kSyncJournalNameTag);
+				m_SentNameHashes[ea] = h;
+			}
+		}
+		if (!it->comment.empty())
+		{
+			if (get_cmt(ea, false, buff, sizeof(buff)) <= 0)
+				buff[0] = '\0';
+			if (it->comment == buff)
+				++same;
+			else if (buff[0] && !overwrite)
+			{
+				if (conflicts++ < kMaxReportedConflicts)
+					msg("%08X: IDA comment '%s' is kept, Olly has '%s'\n", ea, buff, it->comment.c_str());
+			}
+			else if (set_cmt(ea, it->comment.c_str(), false))
+				++comments;
+			else
+				++failed;
+		}
+	}
+	msg("Labeless: %u label(s) and %u comment(s) pulled from Olly, %u unchanged, %u conflict(s) kept IDA's value, %u failed\n",
+		labels, comments, same, conflicts, failed);
+}
+
+void Labeless::onSyncBatchAcknowledged(ICommandPtr cmd)
+{
+	auto fns = std::dynamic_pointer_cast<FuncNameSync>(cmd);
+	auto lls = std::dynamic_pointer_cast<LocalLabelsSync>(cmd);
+	if (!fns && !lls)
+		return;
+
+	const SyncProgressPtr progress = fns ? fns->progress : lls->progress;
+	if (progress && progress->batches > 1)
+	{
+		progress->done += fns ? fns->data.size() : lls->data.size();
+		++progress->batchesDone;
+		if (progress->batchesDone < progress->batches)
+			msg("Labeless: %u of %u item(s) synced, batch %u of %u\n", progress->done, progress->total,
+				progress->batchesDone, progress->batches);
+		else
+			msg("Labeless: %u item(s) synced by %u batches in %lld ms\n", progress->done, progress->batches,
+				static_cast<long long>(progress->timer.elapsed()));
+	}
+
+	netnode n;
+	n.create(kNetNodeSyncJournal.c_str());
+	if (fns)
+	{
+		for (auto it = fns->data.constBegin(); it != fns->data.constEnd(); ++it)
+		{
+			const uint64_t h = syncJournalHash(it->label, cmd->base, cmd->remoteBase);
+			if (!takeQueuedHash(m_QueuedNameHashes, it->ea, h))
+				continue;
+			n.supset(it->ea, &h, sizeof(h), kSyncJournalNameTag);
+			m_SentNameHashes[it->ea] = h;
+		}
+	}
+	else
+	{
+		for (auto it = lls->data.constBegin(); it != lls->data.constEnd(); ++it)
+		{
+			const uint64_t h = syncJournalHash(it->label, cmd->base, cmd->remoteBase);
+			if (!takeQueuedHash(m_QueuedCommentHashes, it->ea, h))
+				continue;
+			n.supset(it->ea, &h, sizeof(h), kSyncJournalCommentTag);
+			m_SentCommentHashes[it->ea] = h;
+		}
+	}
+}
+
 bool Labeless::setEnabled()
 {
 	if (!!m_Enabled)
@@ -352,14 +625,43 @@ void Labeless::onRename(uint32_t ea, const std::string& newName)
 {
 	//if (m_LabelSyncOnRenameIfZero)
 	//	return;
-	if (!m_Settings.enabled)
+	if (!m_Settings.enabled || m_IgnoreRename)
 		return;
 	if (!m_DumpList.isEmpty() && m_DumpList.last().state != IDADump::ST_Done)
 		return;
-	msg("%s: rename addr %08X to %s\n", __FUNCTION__, ea, newName.c_str());
+
+	// a script renaming thousands of names shouldn't cost a round trip per name
+	if (m_PendingRenames.isEmpty())
+		m_PendingRenamesTimer.start();
+	m_PendingRenames[ea] = newName;
+	++m_PendingRenamesReceived;
+
+	if (unsigned(m_PendingRenames.size()) >= kMaxRenameBatch)
+	{
+		flushPendingRenames();
+		return;
+	}
+	// debounce, but don't delay the oldest rename for more than kRenameMaxDelayMs
+	const qint64 left = kRenameMaxDelayMs - m_PendingRenamesTimer.elapsed();
+	m_RenameFlushTimer.start(int(qBound(qint64(0), left, qint64(kRenameDebounceMs))));
+}
+
+void Labeless::flushPendingRenames()
+{
+	m_RenameFlushTimer.stop();
+	if (m_PendingRenames.isEmpty())
+		return;
+
 	FuncNameSync::DataList fncdl;
-	fncdl.push_back(FuncNameSync::Data(ea, newName));
-	addFuncNameSyncData(fncdl);
+	for (auto it = m_PendingRenames.constBegin(); it != m_PendingRenames.constEnd(); ++it)
+		fncdl.push_back(FuncNameSync::Data(it.key(), it.value()));
+
+	msg("%s: %u rename(s) of %u sent, oldest waited %lld ms\n", __FUNCTION__, unsigned(m_PendingRenames.size()),
+		m_PendingRenamesReceived, static_cast<long long>(m_PendingRenamesTimer.elapsed()));
+	m_PendingRenames.clear();
+	m_PendingRenamesReceived = 0;
+
+	addFuncNameSyncData(fncdl, RpcData::PR_Rename);
 }
 
 void Labeless::onAutoanalysisFinished()
@@ -445,6 +747,8 @@ bool Labeless::firstInit()
 			m_MenuActions << dumpMenu->addAction(tr("Wipe all and import..."), this, SLOT(onWipeAndImportRequested()));
 			m_MenuActions << dumpMenu->addAction(tr("Keep existing and import..."), this, SLOT(onKeepAndImportRequested()));
 			m_MenuActions << m->addAction(QIcon(":/sync.png"), tr("Sync labels now"), this, SLOT(onSyncronizeAllRequested()));
+			m_MenuActions << m->addAction(tr("Resync all labels"), this, SLOT(onForceSyncronizeAllRequested()));
+			m_MenuActions << m->addAction(tr("Pull labels and comments from Olly"), this, SLOT(onPullNamesRequested()));
 			m->addSeparator();
 			m_MenuActions << m->addAction(QIcon(":/settings.png"), tr("Settings..."), this, SLOT(onSettingsRequested()));
 		}
@@ -470,6 +774,8 @@ bool Labeless::initialize()
 	CHECKED_CONNECT(connect(m_Thread.data(), SIGNAL(finished()), worker, SLOT(deleteLater())));
 	worker->moveToThread(m_Thread.data());
 	m_Thread->start();
+	lock.unlock();
+	updateMirrors();
 	m_Initialized = true;
 
 	return true;
@@ -498,7 +804,15 @@ void Labeless::terminate()
 		m_Thread = nullptr;
 	}
 	lock.unlock();
+	m_Mirrors.clear();
 	m_Queue.clear();
+	m_RenameFlushTimer.stop();
+	m_PendingRenames.clear();
+	m_PendingRenamesReceived = 0;
+	m_SentNameHashes.clear();
+	m_SentCommentHashes.clear();
+	m_QueuedNameHashes.clear();
+	m_QueuedCommentHashes.clear();
 
 	m_ExternSegData = ExternSegData();
 }
@@ -510,36 +824,135 @@ void Labeless::shutdown()
 	GlobalSettingsManger::instance().detach();
 }
 
-void Labeless::addFuncNameSyncData(const FuncNameSync::DataList& sds)
+void Labeless::addFuncNameSyncData(const FuncNameSync::DataList& sds, RpcData::Priority priority, SyncProgressPtr progress)
 {
-	auto sync = std::make_shared<FuncNameSync>();
-	sync->data = sds;
-	addRpcData(sync);
+	const FuncNameSync::DataList changed = dropUnchanged(sds, m_SentNameHashes, m_QueuedNameHashes, get_imagebase(), m_Settings.remoteModBase);
+	if (changed.size() != sds.size())
+		msg("%s: %u unchanged name(s) of %u skipped\n", __FUNCTION__, unsigned(sds.size() - changed.size()),
+			unsigned(sds.size()));
+	if (changed.isEmpty())
+		return;
+
+	if (!progress)
+		progress = std::make_shared<SyncProgress>();
+	const QList<FuncNameSync::DataList> batches = splitSyncData(changed);
+	for (auto it = batches.constBegin(); it != batches.constEnd(); ++it)
+	{
+		auto sync = std::make_shared<FuncNameSync>();
+		sync->data = *it;
+		sync->progress = progress;
+		if (RpcDataPtr rd = makeRpcData(sync, RpcReadyToSendHandler()))
+		{
+			progress->total += it->size();
+			++progress->batches;
+			rd->priority = priority;
+			mirrorRpcData(rd);
+			addRpcData(rd);
+		}
+	}
 }
 
-void Labeless::addLocLabelSyncData(const LocalLabelsSync::DataList& dl)
+void Labeless::addLocLabelSyncData(const LocalLabelsSync::DataList& dl, RpcData::Priority priority, SyncProgressPtr progress)
 {
-	auto sync = std::make_shared<LocalLabelsSync>();
-	sync->data = dl;
-	addRpcData(sync);
+	const LocalLabelsSync::DataList changed = dropUnchanged(dl, m_SentCommentHashes, m_QueuedCommentHashes, get_imagebase(), m_Settings.remoteModBase);
+	if (changed.size() != dl.size())
+		msg("%s: %u unchanged comment(s) of %u skipped\n", __FUNCTION__, unsigned(dl.size() - changed.size()),
+			unsigned(dl.size()));
+	if (changed.isEmpty())
+		return;
+
+	if (!progress)
+		progress = std::make_shared<SyncProgress>();
+	const QList<LocalLabelsSync::DataList> batches = splitSyncData(changed);
+	for (auto it = batches.constBegin(); it != batches.constEnd(); ++it)
+	{
+		auto sync = std::make_shared<LocalLabelsSync>();
+		sync->data = *it;
+		sync->progress = progress;
+		if (RpcDataPtr rd = makeRpcData(sync, RpcReadyToSendHandler()))
+		{
+			progress->total += it->size();
+			++progress->batches;
+			rd->priority = priority;
+			mirrorRpcData(rd);
+			addRpcData(rd);
+		}
+	}
 }
 
 RpcDataPtr Labeless::addRpcData(ICommandPtr cmd, RpcReadyToSendHandler ready, const QObject* receiver, const char* member, Qt::ConnectionType ct)
+{
+	RpcDataPtr rd = makeRpcData(cmd, ready);
+	if (!rd)
+		return rd;
+	return addRpcData(rd, receiver, member, ct);
+}
+
+void Labeless::updateMirrors()
+{
+	// a target is restarted if its Hello is changed
+	std::vector<MirrorTargetPtr> mirrors;
+	for (auto it = m_Settings.mirrors.constBegin(); it != m_Settings.mirrors.constEnd(); ++it)
+	{
+		if (*it == OllyAddress(m_Settings.host, m_Settings.port))
+			continue;
+		MirrorTargetPtr mt;
+		for (auto mit = m_Mirrors.begin(); mit != m_Mirrors.end(); ++mit)
+		{
+			if ((*mit)->address() == *it && (*mit)->relocations() == m_Settings.relocations)
+			{
+				mt = *mit;
+				break;
+			}
+		}
+		if (!mt)
+		{
+			mt = std::make_shared<MirrorTarget>(*it, m_Settings.relocations);
+			mt->start();
+		}
+		mirrors.push_back(mt);
+	}
+	m_Mirrors.swap(mirrors);
+	if (!m_Mirrors.empty())
+		msg("Labeless: names and comments are mirrored to %u other Olly instance(s)\n", unsigned(m_Mirrors.size()));
+}
+
+void Labeless::mirrorRpcData(RpcDataPtr rd)
+{
+	if (m_Mirrors.empty() || !rd)
+		return;
+	// the only copy of the serialized request, shared by all the targets
+	const SharedParams params = std::make_shared<const std::string>(rd->params);
+	for (auto it = m_Mirrors.begin(); it != m_Mirrors.end(); ++it)
+		(*it)->enqueue(params, rd->minProtocolVersion);
+}
+
+RpcDataPtr Labeless::makeRpcData(ICommandPtr cmd, RpcReadyToSendHandler ready)
 {
 	RpcDataPtr rd(new RpcData());
 	rd->iCmd = cmd;
 	rd->readyToSendHandler = ready;
+	if (std::dynamic_pointer_cast<ExecPyScript>(cmd) || std::dynamic_pointer_cast<GetMemoryMapReq>(cmd) ||
+		std::dynamic_pointer_cast<GetNamesReq>(cmd))
+		rd->priority = RpcData::PR_Interactive;
+	else if (std::dynamic_pointer_cast<FuncNameSync>(cmd) || std::dynamic_pointer_cast<LocalLabelsSync>(cmd))
+		rd->priority = RpcData::PR_BulkSync;
+	else
+		rd->priority = RpcData::PR_DumpAnalysis;
 
 	if (!cmd->base)
 		cmd->base = get_imagebase();
 	if (!cmd->remoteBase)
 		cmd->remoteBase = m_Settings.remoteModBase;
+	// the newest one until connected, RpcThreadWorker serializes it again for an older peer
+	const int protocolVersion = m_ProtocolVersion;
+	cmd->protocolVersion = protocolVersion ? static_cast<uint8_t>(protocolVersion) : netframe::kProtocolVersion;
 	if (!cmd->serialize(rd))
 	{
 		msg("%s: serialize() failed\n", __FUNCTION__);
 		return RpcDataPtr();
 	}
-	return addRpcData(rd, receiver, member, ct);
+	return rd;
 }
 
 RpcDataPtr Labeless::addRpcData(RpcDataPtr rpc, const QObject* receiver, const char* member, Qt::ConnectionType ct)
@@ -549,6 +962,7 @@ RpcDataPtr Labeless::addRpcData(RpcDataPtr rpc, const QObject* receiver, const c
 	CHECKED_CONNECT(connect(rpc.data(), SIGNAL(received()), this, SLOT(onSyncResultReady()), Qt::QueuedConnection));
 	CHECKED_CONNECT(connect(rpc.data(), SIGNAL(failed(QString)), this, SLOT(onRpcRequestFailed(QString)), Qt::QueuedConnection));
 	m_QueueLock.lock();
+	rpc->queuedTimer.start();
 	m_Queue.push_back(rpc);
 	m_QueueLock.unlock();
 
@@ -556,8 +970,11 @@ RpcDataPtr Labeless::addRpcData(RpcDataPtr rpc, const QObject* receiver, const c
 	return rpc;
 }
 
-SOCKET Labeless::connectToHost(const std::string& host, uint16_t port, QString& errorMsg, bool keepAlive /*= true*/)
+SOCKET Labeless::connectToHost(const std::string& host, uint16_t port, QString& errorMsg, uint8_t& protocolVersion, uint8_t& codec,
+	const RelocationList& relocations /*= RelocationList()*/, bool keepAlive /*= true*/)
 {
+	protocolVersion = 0;
+	codec = compression::CODEC_None;
 	if (host.empty() || !port)
 		return INVALID_SOCKET;
 	sockaddr_in addr;
@@ -626,6 +1043,19 @@ SOCKET Labeless::connectToHost(const std::string& host, uint16_t port, QString&
 				.arg(hlp::net::wsaErrorToString().c_str());
 			break;
 		}
+		const uint32_t offeredCodecs = GlobalSettingsManger::instance().value(GSK_Compression, true).toBool()
+			? compression::supportedCodecs()
+			: 0;
+		std::string error;
+		if (!hlp::net::handshake(s, offeredCodecs, relocations, protocolVersion, codec, error))
+		{
+			errorMsg = QString("%1: handshake with %2:%3 failed. Error: %4\n")
+				.arg(__FUNCTION__)
+				.arg(QString::fromStdString(host))
+				.arg(port)
+				.arg(QString::fromStdString(error));
+			break;
+		}
 		failed = false;
 	} while (0);
 	if (failed)
@@ -659,7 +1089,23 @@ void Labeless::onSettingsRequested()
 
 	if (QDialog::Accepted != sd.exec())
 		return;
-	sd.getSettings(m_Settings);
+	const RelocationList prevRelocations = m_Settings.relocations;
+	do {
+		QMutexLocker lock(&m_ConfigLock);
+		sd.getSettings(m_Settings);
+	} while (0);
+	if (!(m_Settings.relocations == prevRelocations))
+	{
+		// names go to the other remote addresses now
+		netnode journal(kNetNodeSyncJournal.c_str());
+		if (journal != BADNODE)
+			journal.kill();
+		m_SentNameHashes.clear();
+		m_SentCommentHashes.clear();
+		msg("Labeless: relocation map is changed, the next sync sends all the names\n");
+	}
+	if (m_Initialized)
+		updateMirrors();
 	if (sd.isPaletteChanged())
 	{
 		sd.getLightPalette(PythonPaletteManager::instance().lightPalette());
@@ -754,10 +1200,14 @@ void Labeless::onRunScriptRequested()
 
 	const std::string& idaScript = m_PyOllyView->getIDAScript().toStdString();
 	std::string externObj;
+	std::string externMarshal;
 	if (!idaScript.empty())
 	{
+		// JSON is for the older Labeless Olly, it's made too until the peer version is known
+		const int protocolVersion = m_ProtocolVersion;
+		const bool jsonExtern = protocolVersion < netframe::kBinaryExternProtocolVersion;
 		std::string errorMsg;
-		if (!runIDAPythonScript(idaScript, externObj, errorMsg))
+		if (!runIDAPythonScript(idaScript, externObj, externMarshal, jsonExtern, errorMsg))
 		{
 			m_PyOllyView->prependStdoutLog(QString("runIDAPythonScript() failed with error: %1\n")
 				.arg(QString::fromStdString(errorMsg)));
@@ -772,6 +1222,7 @@ void Labeless::onRunScriptRequested()
 	auto cmd = std::make_shared<ExecPyScript>();
 	cmd->d.ollyScript = script;
 	cmd->d.idaExtern = externObj;
+	cmd->d.idaExternMarshal = externMarshal;
 	cmd->d.idaScript = idaScript;
 	addRpcData(cmd, RpcReadyToSendHandler(), this, SLOT(onRunPythonScriptFinished()));
 }
@@ -859,6 +1310,8 @@ void Labeless::onSyncResultReady()
 		msg("unable to parse response\n");
 		return;
 	}
+	if (rd->iCmd->error.empty())
+		onSyncBatchAcknowledged(rd->iCmd);
 	rd->emitParsed();
 }
 
@@ -920,7 +1373,11 @@ void Labeless::onGetMemoryMapFinished()
 		if (v.base + v.size > endEa)
 			endEa = v.base + v.size;
 		msg("addr: %08X, size: %08X, protect: %08X\n", v.base, v.size, v.protect);
-		rmr->data.push_back(ReadMemoryRegions::t_memory(v.base, v.size, v.protect, ""));
+		ReadMemoryRegions::t_memory m(v.base, v.size, v.protect, "");
+		// on a re-dump Labeless Olly sends only the pages which differ from the database.
+		// Nothing is hashed for the regions the database has no segment for, e.g. on the first dump
+		hlp::memoryPageHashes(m.base, m.size, ReadMemoryRegions::kPageSize, m.pageHashes);
+		rmr->data.push_back(m);
 	}
 	if (!rmr->data.empty())
 	{
@@ -1005,13 +1462,29 @@ void Labeless::onGetMemoryMapFinished()
 
 		m_DumpList.append(dump);
 
-		RpcDataPtr p = m_DumpList.back().nextState(nullptr).state == IDADump::ST_CheckingPEHeader
-			? addRpcData(dump.checkPEHeaders, RpcReadyToSendHandler(), this, SLOT(onCheckPEHeadersFinished()))
-			: addRpcData(dump.readMemRegions, RpcReadyToSendHandler(), this, SLOT(onReadMemoryRegionsFinished()));
-		p->setProperty("wipe", dump.wipe);
+		if (m_DumpList.back().nextState(nullptr).state == IDADump::ST_CheckingPEHeader)
+		{
+			RpcDataPtr p = addRpcData(dump.checkPEHeaders, RpcReadyToSendHandler(), this, SLOT(onCheckPEHeadersFinished()));
+			p->setProperty("wipe", dump.wipe);
+		}
+		else
+		{
+			addReadMemoryRegions(dump);
+		}
 	}
 }
 
+RpcDataPtr Labeless::addReadMemoryRegions(const IDADump& icInfo)
+{
+	RpcDataPtr p = addRpcData(icInfo.readMemRegions, RpcReadyToSendHandler(), this, SLOT(onReadMemoryRegionsFinished()));
+	if (!p)
+		return p;
+	p->setProperty("wipe", icInfo.wipe);
+	CHECKED_CONNECT(connect(p.data(), SIGNAL(chunkReceived(quint32, quint32, QByteArray)),
+		this, SLOT(onReadMemoryChunkReceived(quint32, quint32, QByteArray)), Qt::QueuedConnection));
+	return p;
+}
+
 void Labeless::onCheckPEHeadersFinished()
 {
 	RpcDataPtr pRD = qobject_cast<RpcData*>(sender());
@@ -1040,8 +1513,7 @@ void Labeless::onCheckPEHeadersFinished()
 		info.sections[i].va += req->base;
 	}
 	info.nextState(pRD).nextState(nullptr);
-	RpcDataPtr p = addRpcData(info.readMemRegions, RpcReadyToSendHandler(), this, SLOT(onReadMemoryRegionsFinished()));
-	p->setProperty("wipe", info.wipe);
+	addReadMemoryRegions(info);
 }
 
 void Labeless::onReadMemoryRegionsFinished()
@@ -1072,15 +1544,143 @@ void Labeless::onReadMemoryRegionsFinished()
 	IDADump& icInfo = m_DumpList.back();
 	icInfo.nextState(pRD);
 
-	if (pRD->property("wipe").toBool())
+	if (!beginMemoryRegionsImport(icInfo, *rmr, pRD->property("wipe").toBool()))
+		return;
+
+	const ea_t region_base = rmr->data.front().base;
+	const uint32_t region_size = rmr->data.back().base + rmr->data.back().size - region_base;
+
+	icInfo.nextState(nullptr);
+
+	uint64_t unchanged = 0;
+	for (int i = 0; i < rmr->data.size(); ++i)
 	{
+		ReadMemoryRegions::t_memory& m = rmr->data[i];
+		const uint32_t streamed = m.streamed + m.unchanged;
+		const uint32_t received = streamed ? streamed : static_cast<uint32_t>(m.raw.size());
+		if (received != m.size)
+		{
+			msg("%s: Data size mismatch (expected %08X, received %08X)\n", __FUNCTION__, m.size, received);
+			return;
+		}
+		if (!m.merged)
+		{
+			if (!mergeMemoryRegion(icInfo, m, region_base, region_size))
+				return;
+			m.merged = true;
+			std::string().swap(m.raw);
+		}
+		if (m.streamed)
+			noUsed(m.base, m.base + m.size); // plan to reanalyze
+		unchanged += m.unchanged;
+
+		auto gdp = std::make_shared<AnalyzeExternalRefs>();
+		gdp->req.eaFrom = m.base;
+		gdp->req.eaTo = m.base + m.size;
+		gdp->req.increment = 1;
+		gdp->req.base = region_base;
+		gdp->req.size = region_size;
+
+		auto p = addRpcData(gdp, RpcReadyToSendHandler(), this, SLOT(onAnalyzeExternalRefsFinished()));
+		p->setProperty("wipe", icInfo.wipe);
+
+		icInfo.analyzeExtRefs.append(IDADump::AnalyseExtRefsWrapper(p));
+	}
+	if (unchanged)
+		msg("%s: %llu bytes are unchanged since the previous dump\n", __FUNCTION__, static_cast<unsigned long long>(unchanged));
+}
+
+void Labeless::onReadMemoryChunkReceived(quint32 regionIndex, quint32 offset, QByteArray data)
+{
+	RpcDataPtr pRD = qobject_cast<RpcData*>(sender());
+	if (!pRD)
+		return;
+	auto rmr = std::dynamic_pointer_cast<ReadMemoryRegions>(pRD->iCmd);
+	if (!rmr)
+	{
+		msg("%s: Invalid type of ICommand\n", __FUNCTION__);
+		return;
+	}
+	if (regionIndex >= static_cast<quint32>(rmr->data.size()))
+	{
+		msg("%s: Invalid region index: %u\n", __FUNCTION__, regionIndex);
+		return;
+	}
+	if (m_DumpList.isEmpty())
+	{
+		msg("%s: internal data is wrong, no ImportCodeInfo found\n", __FUNCTION__);
+		return;
+	}
+	IDADump& icInfo = m_DumpList.back();
+	if (!beginMemoryRegionsImport(icInfo, *rmr, pRD->property("wipe").toBool()))
+		return;
+
+	ReadMemoryRegions::t_memory& m = rmr->data[regionIndex];
+	const uint32_t len = static_cast<uint32_t>(data.size());
+	if (offset > m.size || len > m.size - offset)
+	{
+		msg("%s: Chunk [%08X, %08X) is out of region %08X size %08X\n", __FUNCTION__, offset, offset + len, m.base, m.size);
+		return;
+	}
+
+	// the segment is created by the first chunk, so the region is visible before the whole dump is received
+	if (!m.merged)
+	{
+		const ea_t region_base = rmr->data.front().base;
+		const uint32_t region_size = rmr->data.back().base + rmr->data.back().size - region_base;
+		if (!mergeMemoryRegion(icInfo, m, region_base, region_size))
+		{
+			icInfo.memoryImportReady = false; // drop the rest of the dump
+			return;
+		}
+		m.merged = true;
+		std::string().swap(m.raw);
+	}
+	mem2base(data.constData(), m.base + offset, m.base + offset + len, -1);
+	m.streamed += len;
+	if (m.streamed == m.size)
+		msg("%s: region %08X size %08X received\n", __FUNCTION__, m.base, m.size);
+}
+
+bool Labeless::beginMemoryRegionsImport(IDADump& icInfo, ReadMemoryRegions& rmr, bool wipe)
+{
+	if (icInfo.memoryImportStarted)
+		return icInfo.memoryImportReady;
+	icInfo.memoryImportStarted = true;
+
+	if (wipe)
+	{
+		// Olly skips the pages matching the hashes, so the bytes of such regions stay in the database:
+		// their segment is shrunk to them and deleted without disabling the addresses, the new one reuses them
 		while (segment_t* seg = getnseg(0))
-			del_segm(seg->startEA, SEGMOD_KILL);
+		{
+			const ea_t startEA = seg->startEA;
+			const ea_t endEA = seg->endEA;
+			ea_t keepStart = BADADDR;
+			ea_t keepEnd = 0;
+			for (auto it = rmr.data.cbegin(); it != rmr.data.cend(); ++it)
+			{
+				if (it->pageHashes.empty() || it->base < startEA || it->base + it->size > endEA)
+					continue;
+				keepStart = qMin(keepStart, it->base);
+				keepEnd = qMax(keepEnd, it->base + it->size);
+			}
+			if (BADADDR == keepStart)
+			{
+				del_segm(startEA, SEGMOD_KILL);
+				continue;
+			}
+			if (keepEnd < endEA)
+				set_segm_end(startEA, keepEnd, SEGMOD_KILL);
+			if (keepStart > startEA)
+				set_segm_start(startEA, keepStart, SEGMOD_KILL);
+			del_segm(keepStart, SEGMOD_KEEP);
+		}
 
 		m_ExternSegData = ExternSegData();
-		if (!rmr->data.empty())
+		if (!rmr.data.empty())
 		{
-			ea_t newBase = rmr->data.front().base;
+			ea_t newBase = rmr.data.front().base;
 			set_imagebase(newBase);
 			msg("ImageBase automatically changed to %08X because 'wipe' is requested\n", newBase);
 			m_Settings.remoteModBase = newBase;
@@ -1088,9 +1688,9 @@ void Labeless::onReadMemoryRegionsFinished()
 		}
 	}
 
-	m_LabelSyncOnRenameIfZero = rmr->data.size();
+	m_LabelSyncOnRenameIfZero = rmr.data.size();
 
-	if (!rmr->data.empty())
+	if (!rmr.data.empty())
 	{
 		static const ea_t kReservedFreeSpace = 0x1000;
 		const ea_t impSegFrom = MAXADDR - m_Settings.defaultExternSegSize - kReservedFreeSpace;
@@ -1101,38 +1701,11 @@ void Labeless::onReadMemoryRegionsFinished()
 			msg("%s: Unable to create import segment from: 0x%08X to 0x%08X\n",
 				__FUNCTION__, impSegFrom, impSegTo);
 			// TODO: may be fail
-			return;
-		}
-	}
-
-	const ea_t region_base = rmr->data.front().base;
-	const uint32_t region_size = rmr->data.back().base + rmr->data.back().size - region_base;
-
-	icInfo.nextState(nullptr);
-
-	for (int i = 0; i < rmr->data.size(); ++i)
-	{
-		const ReadMemoryRegions::t_memory& m = rmr->data.at(i);
-		if (m.raw.size() != m.size)
-		{
-			msg("%s: Raw data size mismatch (expected %08X, received %08X)\n", __FUNCTION__, m.size, m.raw.size());
-			return;
+			return false;
 		}
-		if (!mergeMemoryRegion(icInfo, m, region_base, region_size))
-			return;
-
-		auto gdp = std::make_shared<AnalyzeExternalRefs>();
-		gdp->req.eaFrom = m.base;
-		gdp->req.eaTo = m.base + m.size;
-		gdp->req.increment = 1;
-		gdp->req.base = region_base;
-		gdp->req.size = region_size;
-
-		auto p = addRpcData(gdp, RpcReadyToSendHandler(), this, SLOT(onAnalyzeExternalRefsFinished()));
-		p->setProperty("wipe", icInfo.wipe);
-
-		icInfo.analyzeExtRefs.append(IDADump::AnalyseExtRefsWrapper(p));
 	}
+	icInfo.memoryImportReady = true;
+	return true;
 }
 
 void Labeless::getRegionPermissionsAndType(const IDADump& icInfo, const ReadMemoryRegions::t_memory& m, uchar& perm, uchar& type) const
@@ -1242,7 +1815,9 @@ bool Labeless::createSegment(const area_t& area, uchar perm, uchar type, const s
 	if (!set_default_segreg_value(getseg(area.startEA), str2reg("ss"), 0))
 		msg("%s: set_default_segreg_value('ss') failed\n", __FUNCTION__);
 
-	mem2base(data.c_str(), area.startEA, area.endEA, -1);
+	// the streamed regions are filled in later, chunk by chunk
+	if (!data.empty())
+		mem2base(data.c_str(), area.startEA, area.endEA, -1);
 
 	do_unknown_range(area.startEA, area.size(), DOUNK_EXPAND);
 	noUsed(area.startEA, area.endEA); // plan to reanalyze
@@ -1497,7 +2072,9 @@ void Labeless::onTestConnectRequested()
 bool Labeless::testConnect(const std::string& host, uint16_t port, QString& errorMsg)
 {
 	errorMsg.clear();
-	SOCKET s = connectToHost(host, port, errorMsg, false);
+	uint8_t protocolVersion = 0;
+	uint8_t codec = compression::CODEC_None;
+	SOCKET s = connectToHost(host, port, errorMsg, protocolVersion, codec, RelocationList(), false);
 	if (INVALID_SOCKET == s)
 	{
 		if (errorMsg.isEmpty())
@@ -1512,22 +2089,18 @@ bool Labeless::testConnect(const std::string& host, uint16_t port, QString& erro
 		"from py_olly import labeless_ver\n"
 		"print 'pong'\n"
 		"print >> sys.stderr, 'v:%s' % labeless_ver()");
-	if (!hlp::net::sockSendString(s, command.SerializeAsString()))
+	std::string error;
+	if (!hlp::net::sendFrame(s, netframe::FT_Execute, command.SerializeAsString(), error, protocolVersion, codec))
 	{
-		errorMsg = "sockSendString() failed";
+		errorMsg = QString("sendFrame() failed, error: %1").arg(QString::fromStdString(error));
 		return false;
 	}
 
-	/*if (SOCKET_ERROR == shutdown(s, SD_SEND))
-	{
-		msg("shutdown() failed. Error: %s\n", hlp::net::wsaErrorToString());
-		return false;
-	}*/
-
+	netframe::Header header;
 	std::string rawResponse;
-	if (!hlp::net::sockRecvAll(s, rawResponse) || rawResponse.empty())
+	if (!hlp::net::recvFrame(s, header, rawResponse) || header.type != netframe::FT_Response)
 	{
-		errorMsg = QString("sockRecvAll() failed, error: %1").arg(hlp::net::wsaErrorToString().c_str());
+		errorMsg = QString("recvFrame() failed, error: %1").arg(hlp::net::wsaErrorToString().c_str());
 		return false;
 	}
 
@@ -1990,7 +2563,7 @@ bool Labeless::initIDAPython()
 		return false;
 	}
 	char errbuff[1024] = {};
-	static const std::string pyInitMsg = "import json\n"
+	static const std::string pyInitMsg = "import ctypes, json, marshal\n"
 		"idaapi.msg('Labeless: Python initialized... OK\\n')\n";
 	if (!run_statements(pyInitMsg.c_str(), errbuff, _countof(errbuff), elng))
 	{
@@ -2003,7 +2576,8 @@ bool Labeless::initIDAPython()
 	return true;
 }
 
-bool Labeless::runIDAPythonScript(const std::string& script, std::string& externObj, std::string& error)
+bool Labeless::runIDAPythonScript(const std::string& script, std::string& externObj, std::string& externMarshal,
+	bool jsonExtern, std::string& error)
 {
 	const extlang_t* elng = find_extlang_by_name("python");
 	if (!elng)
@@ -2013,6 +2587,7 @@ bool Labeless::runIDAPythonScript(const std::string& script, std::string& extern
 	}
 	char errbuff[1024] = {};
 	externObj.clear();
+	externMarshal.clear();
 	error.clear();
 
 	if (!run_statements(script.c_str(), errbuff, _countof(errbuff), elng))
@@ -2022,14 +2597,42 @@ bool Labeless::runIDAPythonScript(const std::string& script, std::string& extern
 		msg("%s: unable to execute Python script, error: %s", __FUNCTION__, errbuff);
 		return false;
 	}
+	// idc strings are NUL terminated, so ctypes copies the marshal data right into externMarshal
 	errbuff[0] = '\0';
 	idc_value_t rv;
+	if (!run_statements("__labeless_marshal__ = marshal.dumps(__extern__)", errbuff, _countof(errbuff), elng))
+	{
+		if (!::qstrlen(errbuff) || QString::fromAscii(errbuff).contains("NameError"))
+			return true; // no __extern__
+		jsonExtern = true; // marshal takes the built-in types only, not their subclasses
+	}
+	else if (elng->calcexpr(BADADDR, "len(__labeless_marshal__)", &rv, errbuff, sizeof(errbuff)) && rv.vtype == VT_LONG)
+	{
+		externMarshal.resize(static_cast<size_t>(rv.num));
+		const std::string copy = QString("ctypes.memmove(%1, __labeless_marshal__, %2)")
+			.arg(reinterpret_cast<quintptr>(externMarshal.data()))
+			.arg(externMarshal.size()).toStdString();
+		if (externMarshal.empty() || !run_statements(copy.c_str(), errbuff, _countof(errbuff), elng))
+		{
+			externMarshal.clear();
+			jsonExtern = true;
+		}
+	}
+	else
+	{
+		jsonExtern = true;
+	}
+	run_statements("__labeless_marshal__ = None", errbuff, _countof(errbuff), elng);
+	if (!jsonExtern)
+		return true;
+
+	errbuff[0] = '\0';
 	if (elng->calcexpr(BADADDR, "json.dumps(__extern__)", &rv, errbuff, sizeof(errbuff)))
 	{
 		externObj = rv.c_str();
 		VarFree(&rv);
 	}
-	else if (::qstrlen(errbuff) && !QString::fromAscii(errbuff).contains("NameError"))
+	else if (::qstrlen(errbuff))
 	{
 		error = errbuff;
 		return false;
@@ -8,20 +8,25 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QHash>
 #include <QList>
 #include <QMap>
 #include <QMutex>
 #include <QPointer>
 #include <QSharedPointer>
 #include <QThread>
+#include <QTimer>
 #include <QWaitCondition>
 
 #include <pro.h>
 #include "sync/sync.h"
 #include "rpcdata.h"
 #include "idadump.h"
+#include "mirrortarget.h"
 
 QT_FORWARD_DECLARE_CLASS(QAction)
 QT_FORWARD_DECLARE_CLASS(QMainWindow)
@@ -69,8 +74,11 @@ public:
 	void onAddDref(ea_t from, ea_t to, dref_t type);
 	/**< hook processor_t::idp_notify - end */
 
-	void addFuncNameSyncData(const FuncNameSync::DataList& sds);
-	void addLocLabelSyncData(const LocalLabelsSync::DataList& dl);
+	// the data is split into batches limited by "sync_batch_names" and "sync_batch_bytes" global settings
+	void addFuncNameSyncData(const FuncNameSync::DataList& sds, RpcData::Priority priority = RpcData::PR_BulkSync,
+		SyncProgressPtr progress = SyncProgressPtr());
+	void addLocLabelSyncData(const LocalLabelsSync::DataList& dl, RpcData::Priority priority = RpcData::PR_BulkSync,
+		SyncProgressPtr progress = SyncProgressPtr());
 	RpcDataPtr addRpcData(ICommandPtr cmd,
 		RpcReadyToSendHandler ready = [](RpcDataPtr){ return true; },
 		const QObject* receiver = nullptr, const char* member = nullptr,
@@ -93,10 +101,13 @@ private slots:
 	void onGetMemoryMapFinished();
 	void onCheckPEHeadersFinished();
 	void onReadMemoryRegionsFinished();
+	void onReadMemoryChunkReceived(quint32 regionIndex, quint32 offset, QByteArray data);
 	void onAnalyzeExternalRefsFinished();
+	void onGetNamesFinished();
 
 	void onSyncResultReady();
 	void onRpcRequestFailed(QString message);
+	void flushPendingRenames();
 
 	void onPyOllyFormClose();
 	void onRunScriptRequested();
@@ -106,6 +117,8 @@ private slots:
 
 public slots:
 	void onSyncronizeAllRequested();
+	void onForceSyncronizeAllRequested();
+	void onPullNamesRequested();
 	void onSettingsRequested();
 	void onWipeAndImportRequested();
 	void onKeepAndImportRequested();
@@ -115,7 +128,8 @@ public slots:
 	void onLogMessage(const QString& message, const QString& prefix);
 
 private:
-	static SOCKET connectToHost(const std::string& host, uint16_t port, QString& errorMsg, bool keepAlive = true);
+	static SOCKET connectToHost(const std::string& host, uint16_t port, QString& errorMsg, uint8_t& protocolVersion, uint8_t& codec,
+		const RelocationList& relocations = RelocationList(), bool keepAlive = true);
 
 	static bool testConnect(const std::string& host, uint16_t port, QString& errorMsg);
 
@@ -131,14 +145,22 @@ private:
 	qstring getNewNameOfEntry() const;
 
 	bool initIDAPython();
-	bool runIDAPythonScript(const std::string& script, std::string& externObj, std::string& error);
+	bool runIDAPythonScript(const std::string& script, std::string& externObj, std::string& externMarshal, bool jsonExtern,
+		std::string& error);
 
 	Settings loadSettings();
 	void storeSettings();
 
 	QMainWindow* findIDAMainWindow() const;
 private:
+	void syncronizeAll(bool force);
+	void onSyncBatchAcknowledged(ICommandPtr cmd);
+	RpcDataPtr makeRpcData(ICommandPtr cmd, RpcReadyToSendHandler ready);
+	void updateMirrors();
+	void mirrorRpcData(RpcDataPtr rd);
 	bool addAPIEnumValue(const std::string& name, uval_t value);
+	bool beginMemoryRegionsImport(IDADump& icInfo, ReadMemoryRegions& rmr, bool wipe);
+	RpcDataPtr addReadMemoryRegions(const IDADump& icInfo);
 	bool mergeMemoryRegion(IDADump& icInfo, const ReadMemoryRegions::t_memory& m, ea_t region_base, uint32_t region_size);
 	segment_t* getFirstOverlappedSegment(const area_t& area, segment_t* exceptThisSegment);
 	bool createSegment(const area_t& area, uchar perm, uchar type, const std::string& data, segment_t& result);
@@ -150,21 +172,39 @@ public:
 	bool							m_Initialized;
 	QAtomicInt						m_IgnoreMakeData;
 	QAtomicInt						m_IgnoreMakeCode;
+	QAtomicInt						m_IgnoreRename; // names pulled from Olly aren't sent back
 	QAtomicInt						m_SuppressMessageBoxesFromIDA;
 
 private:
 	friend class RpcThreadWorker;
+	friend class MirrorTarget;
 
 	mutable QMutex					m_ConfigLock;
 	Settings						m_Settings;
 	bool							m_SynchronizeAllNow;
 	size_t							m_LabelSyncOnRenameIfZero;
+
+	// renames are coalesced by address and sent as a single FuncNameSync
+	QMap<uint32_t, std::string>		m_PendingRenames;
+	unsigned						m_PendingRenamesReceived; // including overwritten ones
+	QElapsedTimer					m_PendingRenamesTimer; // started by the first pending rename
+	QTimer							m_RenameFlushTimer;
+	// syncJournalHash() of the texts Labeless Olly acknowledged in this session, by address.
+	// An address is dropped while an other text of it is in flight
+	QHash<uint32_t, uint64_t>		m_SentNameHashes;
+	QHash<uint32_t, uint64_t>		m_SentCommentHashes;
+	// syncJournalHash() of the last text queued, by address, until it is acknowledged
+	QHash<uint32_t, uint64_t>		m_QueuedNameHashes;
+	QHash<uint32_t, uint64_t>		m_QueuedCommentHashes;
+	std::vector<MirrorTargetPtr>	m_Mirrors; // of Settings::mirrors
 	bool							m_ShowAllResponsesInLog;
 
 	QMutex							m_ThreadLock;
 	QPointer<QThread>				m_Thread;
 	QMutex							m_QueueLock;
 	qlist<RpcDataPtr>				m_Queue;
+	QAtomicInt						m_ProtocolVersion; // negotiated with Labeless Olly, 0 if not connected
+	QAtomicInt						m_Codec; // compression::Codec negotiated with Labeless Olly
 
 	QWaitCondition					m_QueueCond;
 
@@ -0,0 +1,223 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#include "mirrortarget.h"
+
+#include "labeless_ida.h"
+#include "globalsettingsmanager.h"
+#include "hlp.h"
+#include "../common/cpp/rpc.pb.h"
+
+namespace {
+
+static const unsigned kDefaultMaxRequestsInFlight = 4;
+static const unsigned kMaxRequestsInFlightLimit = 64;
+static const long kResponsePollIntervalMs = 50;
+static const unsigned long kIdleWaitMs = 1000;
+static const unsigned long kStopTimeoutMs = 2000;
+
+} // anonymous
+
+MirrorTarget::MirrorTarget(const OllyAddress& address, const RelocationList& relocations)
+	: m_Address(address)
+	, m_Relocations(relocations)
+	, m_Stop(false)
+	, m_Socket(INVALID_SOCKET)
+	, m_ProtocolVersion(0)
+	, m_Codec(compression::CODEC_None)
+	, m_LastRequestId(0)
+	, m_Sent(0)
+	, m_Acked(0)
+	, m_Failed(0)
+	, m_TooOld(0)
+{
+}
+
+MirrorTarget::~MirrorTarget()
+{
+	stop();
+	if (!wait(kStopTimeoutMs))
+	{
+		// blocked in connect() to a dead host
+		terminate();
+		wait();
+	}
+}
+
+void MirrorTarget::enqueue(const SharedParams& params, uint8_t minProtocolVersion)
+{
+	const Item item = { params, minProtocolVersion };
+	QMutexLocker lock(&m_Lock);
+	m_Queue.push_back(item);
+	m_Cond.wakeAll();
+}
+
+void MirrorTarget::stop()
+{
+	QMutexLocker lock(&m_Lock);
+	m_Stop = true;
+	m_Cond.wakeAll();
+}
+
+void MirrorTarget::run()
+{
+	const unsigned maxInFlight = qBound(1u,
+		GlobalSettingsManger::instance().value(GSK_MaxRequestsInFlight, kDefaultMaxRequestsInFlight).toUInt(),
+		kMaxRequestsInFlightLimit);
+
+	for (;;)
+	{
+		std::deque<Item> toSend;
+		bool stopped = false;
+		do {
+			QMutexLocker lock(&m_Lock);
+			while (!m_Stop && m_Queue.empty() && m_InFlight.empty())
+			{
+				logStats();
+				m_Cond.wait(&m_Lock, kIdleWaitMs);
+			}
+			stopped = m_Stop;
+			while (!m_Queue.empty() && m_InFlight.size() + toSend.size() < maxInFlight)
+			{
+				toSend.push_back(m_Queue.front());
+				m_Queue.pop_front();
+			}
+		} while (0);
+		if (stopped)
+			break;
+
+		if (!toSend.empty() && INVALID_SOCKET == m_Socket && !connectToOlly())
+		{
+			// don't try to connect for each of the queued requests
+			QMutexLocker lock(&m_Lock);
+			m_Failed += unsigned(toSend.size() + m_Queue.size());
+			m_Queue.clear();
+			continue;
+		}
+		for (auto it = toSend.cbegin(); it != toSend.cend(); ++it)
+			sendItem(*it);
+
+		if (m_InFlight.empty())
+			continue;
+
+		fd_set rfds;
+		FD_ZERO(&rfds);
+		FD_SET(m_Socket, &rfds);
+		timeval tv = { 0, kResponsePollIntervalMs * 1000 };
+		const int rv = select(0, &rfds, nullptr, nullptr, &tv);
+		if (SOCKET_ERROR == rv)
+			closeConnection(std::string("select() failed, error: ") + hlp::net::wsaErrorToString().c_str());
+		else if (rv > 0)
+			receiveResponse();
+	}
+	closeConnection("mirror is stopped");
+	logStats();
+}
+
+bool MirrorTarget::connectToOlly()
+{
+	QString errorMsg;
+	m_Socket = Labeless::connectToHost(m_Address.host, m_Address.port, errorMsg, m_ProtocolVersion, m_Codec, m_Relocations);
+	if (INVALID_SOCKET != m_Socket)
+		return true;
+	hlp::addLogMsg("Labeless: mirror %s:%u is unavailable. %s\n", m_Address.host.c_str(), unsigned(m_Address.port),
+		errorMsg.toStdString().c_str());
+	return false;
+}
+
+void MirrorTarget::sendItem(const Item& item)
+{
+	if (INVALID_SOCKET == m_Socket)
+	{
+		++m_Failed;
+		return;
+	}
+	if (item.minProtocolVersion > m_ProtocolVersion)
+	{
+		++m_TooOld;
+		return;
+	}
+
+	rpc::Execute command;
+	command.set_script(std::string());
+	command.set_rpc_request(*item.params);
+	const uint64_t requestId = ++m_LastRequestId;
+	command.set_request_id(requestId);
+
+	std::string error;
+	if (!hlp::net::sendFrame(m_Socket, netframe::FT_Execute, command.SerializeAsString(), error, m_ProtocolVersion, m_Codec))
+	{
+		++m_Failed;
+		closeConnection("sendFrame() failed, error: " + error);
+		return;
+	}
+	m_InFlight.insert(requestId);
+	++m_Sent;
+}
+
+void MirrorTarget::receiveResponse()
+{
+	netframe::Header header;
+	if (!hlp::net::recvFrame(m_Socket, header, m_RecvBuff, &m_PackedBuff) ||
+		(header.type != netframe::FT_Response && header.type != netframe::FT_MemoryChunk &&
+			header.type != netframe::FT_OutputChunk))
+	{
+		closeConnection(std::string("recvFrame() failed, error: ") + hlp::net::wsaErrorToString().c_str());
+		return;
+	}
+	if (header.type != netframe::FT_Response)
+		return;
+
+	rpc::Response response;
+	if (!hlp::protobuf::parseBigMessage(response, m_RecvBuff))
+	{
+		closeConnection("rpc::Response::ParseFromString() failed");
+		return;
+	}
+	if (!m_InFlight.erase(response.request_id()))
+		return;
+	if (response.has_error() && !response.error().empty())
+	{
+		++m_Failed;
+		m_LastError = response.error();
+	}
+	else
+	{
+		++m_Acked;
+	}
+}
+
+void MirrorTarget::closeConnection(const std::string& reason)
+{
+	if (INVALID_SOCKET != m_Socket)
+	{
+		closesocket(m_Socket);
+		m_Socket = INVALID_SOCKET;
+		m_ProtocolVersion = 0;
+		m_Codec = compression::CODEC_None;
+	}
+	if (m_InFlight.empty())
+		return;
+	m_Failed += unsigned(m_InFlight.size());
+	m_LastError = reason;
+	m_InFlight.clear();
+}
+
+void MirrorTarget::logStats()
+{
+	if (!m_Sent && !m_Failed && !m_TooOld)
+		return;
+	hlp::addLogMsg("Labeless: mirror %s:%u: %u of %u request(s) acknowledged, %u failed%s%s\n",
+		m_Address.host.c_str(), unsigned(m_Address.port), m_Acked, m_Sent, m_Failed,
+		m_LastError.empty() ? "" : ", last error: ", m_LastError.c_str());
+	if (m_TooOld)
+		hlp::addLogMsg("Labeless: mirror %s:%u: %u request(s) skipped, Labeless Olly there is too old for them\n",
+			m_Address.host.c_str(), unsigned(m_Address.port), m_TooOld);
+	m_Sent = m_Acked = m_Failed = m_TooOld = 0;
+	m_LastError.clear();
+}
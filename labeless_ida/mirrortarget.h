@@ -0,0 +1,77 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <set>
+#include <string>
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+#include "types.h"
+
+typedef std::shared_ptr<const std::string> SharedParams; // rpc::RpcRequest serialized once for all the targets
+
+/* An other Labeless Olly the names and comments are mirrored to, see Settings::mirrors.
+ * It has its own connection, queue and thread, so a slow or dead target doesn't hold the others.
+ * Nothing is parsed from the responses, only the acknowledgements are counted and logged.
+ */
+class MirrorTarget : public QThread
+{
+public:
+	MirrorTarget(const OllyAddress& address, const RelocationList& relocations);
+	~MirrorTarget();
+
+	inline const OllyAddress& address() const { return m_Address; }
+	inline const RelocationList& relocations() const { return m_Relocations; }
+
+	void enqueue(const SharedParams& params, uint8_t minProtocolVersion);
+	void stop();
+
+protected:
+	virtual void run() override;
+
+private:
+	struct Item
+	{
+		SharedParams	params;
+		uint8_t			minProtocolVersion;
+	};
+
+	bool connectToOlly();
+	void sendItem(const Item& item);
+	void receiveResponse();
+	void closeConnection(const std::string& reason);
+	void logStats();
+
+	const OllyAddress		m_Address;
+	const RelocationList	m_Relocations;
+
+	QMutex					m_Lock;
+	QWaitCondition			m_Cond;
+	std::deque<Item>		m_Queue;
+	bool					m_Stop;
+
+	// used by the thread only
+	SOCKET					m_Socket;
+	uint8_t					m_ProtocolVersion;
+	uint8_t					m_Codec;
+	uint64_t				m_LastRequestId;
+	std::set<uint64_t>		m_InFlight; // by rpc::Execute::request_id
+	std::string				m_RecvBuff;
+	std::string				m_PackedBuff;
+	unsigned				m_Sent;
+	unsigned				m_Acked;
+	unsigned				m_Failed;
+	unsigned				m_TooOld; // the params need a newer Labeless Olly
+	std::string				m_LastError;
+};
+
+typedef std::shared_ptr<MirrorTarget> MirrorTargetPtr;
@@ -22,7 +22,9 @@ RpcData::RpcData(uint64_t jobId_,
 	, params(params_)
 	, iCmd(iCmd_)
 	, readyToSendHandler(readyToSendHandler_)
+	, minProtocolVersion(0)
 	, m_State(ST_Working)
+	, priority(PR_BulkSync)
 {
 }
 
@@ -43,3 +45,8 @@ void RpcData::emitFailed(const QString& message)
 	m_State = ST_Failed;
 	emit failed(message);
 }
+
+void RpcData::emitChunkReceived(quint32 regionIndex, quint32 offset, const QByteArray& data)
+{
+	emit chunkReceived(regionIndex, offset, data);
+}
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "types.h"
+#include <QByteArray>
+#include <QElapsedTimer>
 #include <QObject>
 
 class RpcData : public QObject
@@ -24,6 +26,17 @@ public:
 		ST_Failed
 	};
 
+	// scheduling class in the RPC queue, lower is sent first
+	enum Priority
+	{
+		PR_Interactive,		// scripts run by the user
+		PR_Rename,			// names changed by the user
+		PR_BulkSync,		// "sync all" and other mass updates
+		PR_DumpAnalysis,	// memory dump, external references analysis
+
+		PR_Count
+	};
+
 	RpcData(uint64_t jobId_ = 0,
 		uint32_t retryCount_ = 0,
 		const std::string& script_ = std::string(),
@@ -36,23 +49,32 @@ public:
 	void emitReceived();
 	void emitParsed();
 	void emitFailed(const QString& message);
+	void emitChunkReceived(quint32 regionIndex, quint32 offset, const QByteArray& data);
 
 	inline State state() { return m_State; }
 signals:
 	void received();
 	void parsed();
 	void failed(QString message);
+	void chunkReceived(quint32 regionIndex, quint32 offset, QByteArray data);
 
 public:
 	uint64_t jobId;
 	uint32_t retryCount;
 	std::string script;
 	std::string scriptExternObj;
+	std::string scriptExternMarshal;
 	std::string params;
 	std::shared_ptr<rpc::Response> response;
 	ICommandPtr iCmd;
 	State m_State;
 
 	RpcReadyToSendHandler readyToSendHandler;
+	uint8_t minProtocolVersion; // the params need a peer of this version at least, 0 if any
+	std::string streamedStdOut; // rpc::OutputChunk texts received before the response, used by the RPC thread only
+	std::string streamedStdErr;
+
+	Priority priority;
+	QElapsedTimer queuedTimer; // restarted when queued or while not ready to be sent
 };
 
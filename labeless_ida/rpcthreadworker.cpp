@@ -9,13 +9,111 @@
 #include "rpcthreadworker.h"
 
 #include "labeless_ida.h"
+#include "globalsettingsmanager.h"
 #include "hlp.h"
 #include "../common/cpp/rpc.pb.h"
 
+#include <algorithm>
+#include <vector>
 #include <QApplication>
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
+namespace {
+
+static const unsigned kDefaultMaxRequestsInFlight = 4;
+static const unsigned kMaxRequestsInFlightLimit = 64;
+static const long kResponsePollIntervalMs = 50;
+static const qint64 kAgingIntervalMs = 2000; // a queued request is promoted by one class per interval
+
+static const char* const kPriorityNames[RpcData::PR_Count] = {
+	"interactive",
+	"rename",
+	"bulk sync",
+	"dump analysis"
+};
+
+inline int effectivePriority(const RpcData& rd)
+{
+	const qint64 promoted = rd.queuedTimer.elapsed() / kAgingIntervalMs;
+	return promoted >= rd.priority ? 0 : int(rd.priority - promoted);
+}
+
+struct MemoryChunkView
+{
+	::google::protobuf::uint64 requestId = 0;
+	::google::protobuf::uint32 regionIndex = 0;
+	::google::protobuf::uint32 offset = 0;
+	QByteArray data;
+};
+
+// rpc::MemoryChunk parsed right from the receive buffer, the data is copied once into the QByteArray
+bool parseMemoryChunk(const std::string& payload, MemoryChunkView& chunk)
+{
+	using ::google::protobuf::internal::WireFormatLite;
+	static const int kLimit = static_cast<int>(netframe::kMaxPayloadSize);
+
+	::google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8*>(payload.data()),
+		static_cast<int>(payload.size()));
+	input.SetTotalBytesLimit(kLimit, kLimit);
+
+	bool hasRegionIndex = false;
+	bool hasOffset = false;
+	bool hasData = false;
+	while (const ::google::protobuf::uint32 tag = input.ReadTag())
+	{
+		const WireFormatLite::WireType wireType = WireFormatLite::GetTagWireType(tag);
+		switch (WireFormatLite::GetTagFieldNumber(tag))
+		{
+		case rpc::MemoryChunk::kRequestIdFieldNumber:
+			if (wireType != WireFormatLite::WIRETYPE_VARINT || !input.ReadVarint64(&chunk.requestId))
+				return false;
+			break;
+		case rpc::MemoryChunk::kRegionIndexFieldNumber:
+			if (wireType != WireFormatLite::WIRETYPE_VARINT || !input.ReadVarint32(&chunk.regionIndex))
+				return false;
+			hasRegionIndex = true;
+			break;
+		case rpc::MemoryChunk::kOffsetFieldNumber:
+			if (wireType != WireFormatLite::WIRETYPE_VARINT || !input.ReadVarint32(&chunk.offset))
+				return false;
+			hasOffset = true;
+			break;
+		case rpc::MemoryChunk::kDataFieldNumber:
+			do {
+				::google::protobuf::uint32 len = 0;
+				if (wireType != WireFormatLite::WIRETYPE_LENGTH_DELIMITED || !input.ReadVarint32(&len))
+					return false;
+				const void* p = nullptr;
+				int avail = 0;
+				if (len && (!input.GetDirectBufferPointer(&p, &avail) || avail < static_cast<int>(len)))
+					return false;
+				chunk.data = len ? QByteArray(static_cast<const char*>(p), static_cast<int>(len)) : QByteArray();
+				if (!input.Skip(static_cast<int>(len)))
+					return false;
+				hasData = true;
+			} while (0);
+			break;
+		default:
+			if (!WireFormatLite::SkipField(&input, tag))
+				return false;
+			break;
+		}
+	}
+	return input.ConsumedEntireMessage() && hasRegionIndex && hasOffset && hasData;
+}
+
+} // anonymous
+
 RpcThreadWorker::RpcThreadWorker(QObject* parent)
+	: m_Socket(INVALID_SOCKET)
+	, m_Port(0)
+	, m_LastRequestId(0)
+	, m_ConnectsCount(0)
+	, m_RequestsCount(0)
 {
+	memset(m_PriorityStats, 0, sizeof(m_PriorityStats));
 	msg("%s\n", Q_FUNC_INFO);
 }
 
@@ -30,112 +128,391 @@ void RpcThreadWorker::main()
 	static const unsigned long waitTime = 1000;
 
 	Labeless& ll = Labeless::instance();
+
+	const unsigned maxInFlight = qBound(1u,
+		GlobalSettingsManger::instance().value(GSK_MaxRequestsInFlight, kDefaultMaxRequestsInFlight).toUInt(),
+		kMaxRequestsInFlightLimit);
+
 	while (ll.m_Enabled == 1)
 	{
+		QList<RpcDataPtr> toSend;
 		QMutexLocker lock(&ll.m_QueueLock);
-		while (ll.m_Queue.empty() && ll.m_Enabled == 1)
+		while (m_InFlight.empty() && ll.m_Queue.empty() && ll.m_Enabled == 1)
 		{
 			ll.m_QueueCond.wait(&ll.m_QueueLock, waitTime);
 		}
 		if (ll.m_Enabled != 1)
 			break;
 
-		RpcDataPtr pRD;
-		unsigned queueSize = 0;
-		for (auto it = ll.m_Queue.begin(), end = ll.m_Queue.end(); it != end; ++it)
+		pickRequestsToSend(toSend, maxInFlight);
+		if (toSend.isEmpty() && m_InFlight.empty())
 		{
-			RpcDataPtr ptr = *it;
-			if (ptr && (!ptr->readyToSendHandler || ptr->readyToSendHandler(ptr)))
-			{
-				pRD = *it;
-				ll.m_Queue.erase(it);
-				queueSize = ll.m_Queue.size();
-				break;
-			}
+			// only deferred requests are queued
+			ll.m_QueueCond.wait(&ll.m_QueueLock, kResponsePollIntervalMs);
+			continue;
 		}
 		lock.unlock();
-		if (!pRD)
+
+		if (!toSend.isEmpty())
+		{
+			ll.m_ConfigLock.lock();
+			const std::string host = ll.m_Settings.host;
+			const uint16_t port = ll.m_Settings.port;
+			const RelocationList relocations = ll.m_Settings.relocations;
+			ll.m_ConfigLock.unlock();
+
+			if (INVALID_SOCKET != m_Socket && (host != m_Host || port != m_Port || !(relocations == m_Relocations)))
+				closeConnection("Connection settings were changed");
+			m_Relocations = relocations;
+
+			/* TODO: don't send ExecPyScript command if Olly script is empty
+			auto eps = std::dynamic_pointer_cast<ExecPyScript>(pRD->iCmd);
+			if (eps && QString::fromStdString(eps->d.ollyScript).trimmed().isEmpty())
+			{
+				pRD->emitReceived();
+				continue;
+			}*/
+
+			for (auto it = toSend.begin(); it != toSend.end(); ++it)
+				sendRequest(*it, host, port);
+		}
+
+		if (m_InFlight.empty())
 			continue;
 
-		ll.m_ConfigLock.lock();
-		const std::string host = ll.m_Settings.host;
-		const uint16_t port = ll.m_Settings.port;
-		ll.m_ConfigLock.unlock();
+		// wait for the responses, but come back to the queue periodically to keep the pipeline full
+		fd_set rfds;
+		FD_ZERO(&rfds);
+		FD_SET(m_Socket, &rfds);
+		timeval tv = { 0, kResponsePollIntervalMs * 1000 };
+		const int rv = select(0, &rfds, nullptr, nullptr, &tv);
+		if (SOCKET_ERROR == rv)
+			closeConnection(QString("select() failed, error: %1").arg(hlp::net::wsaErrorToString().c_str()));
+		else if (rv > 0)
+			receiveResponse();
+	}
+	closeConnection("RPC thread is stopped");
+	if (m_ConnectsCount)
+		hlp::addLogMsg("%s: %u request(s) sent over %u connection(s)\n", __FUNCTION__, m_RequestsCount, m_ConnectsCount);
+	logPriorityStats();
+	if (m_RecvBuffStats.growths)
+		hlp::addLogMsg("%s: receive buffer grown %u time(s), peak size 0x%08X\n", __FUNCTION__,
+			m_RecvBuffStats.growths, unsigned(m_RecvBuffStats.peak));
+	moveToThread(qApp->thread());
+	deleteLater();
+}
+
+void RpcThreadWorker::pickRequestsToSend(QList<RpcDataPtr>& toSend, unsigned maxInFlight)
+{
+	// called with Labeless::m_QueueLock held
+	Labeless& ll = Labeless::instance();
+
+	struct Candidate
+	{
+		int rank;
+		unsigned order;
+		qlist<RpcDataPtr>::iterator it;
 
-		/* TODO: don't send ExecPyScript command if Olly script is empty
-		auto eps = std::dynamic_pointer_cast<ExecPyScript>(pRD->iCmd);
-		if (eps && QString::fromStdString(eps->d.ollyScript).trimmed().isEmpty())
+		bool operator<(const Candidate& r) const { return rank != r.rank ? rank < r.rank : order < r.order; }
+	};
+	std::vector<Candidate> candidates;
+	unsigned queued[RpcData::PR_Count] = {};
+	unsigned order = 0;
+	for (auto it = ll.m_Queue.begin(); it != ll.m_Queue.end(); ++it, ++order)
+	{
+		RpcDataPtr ptr = *it;
+		if (!ptr)
+			continue;
+		++queued[ptr->priority];
+		if (ptr->readyToSendHandler && !ptr->readyToSendHandler(ptr))
 		{
-			pRD->emitReceived();
+			ptr->queuedTimer.restart(); // deferred requests don't age
 			continue;
-		}*/
+		}
+		Candidate c = { effectivePriority(*ptr), order, it };
+		candidates.push_back(c);
+	}
+	for (int i = 0; i < RpcData::PR_Count; ++i)
+		m_PriorityStats[i].maxQueued = qMax(m_PriorityStats[i].maxQueued, queued[i]);
 
-		QString errorMsg;
-		SOCKET s = ll.connectToHost(host, port, errorMsg);
-		if (INVALID_SOCKET == s)
+	// the dump analysis never takes the last free slot, so a rename or a script isn't stuck behind it
+	unsigned dumpsInFlight = 0;
+	for (auto it = m_InFlight.cbegin(); it != m_InFlight.cend(); ++it)
+	{
+		if (it->second && it->second->priority == RpcData::PR_DumpAnalysis)
+			++dumpsInFlight;
+	}
+
+	std::stable_sort(candidates.begin(), candidates.end());
+	for (auto c = candidates.begin(); c != candidates.end() && m_InFlight.size() + toSend.size() < maxInFlight; ++c)
+	{
+		RpcDataPtr ptr = *c->it;
+		if (ptr->priority == RpcData::PR_DumpAnalysis)
 		{
-			if (errorMsg.isEmpty())
-				errorMsg = "connectToHost() failed";
-			hlp::addLogMsg("%s\n", errorMsg.toStdString().c_str());
-			pRD->emitFailed(errorMsg);
+			if (maxInFlight > 1 && dumpsInFlight + 1 >= maxInFlight)
+				continue;
+			++dumpsInFlight;
+		}
+
+		PriorityStats& stats = m_PriorityStats[ptr->priority];
+		const qint64 waitMs = ptr->queuedTimer.elapsed();
+		++stats.sent;
+		stats.totalWaitMs += waitMs;
+		stats.maxWaitMs = qMax(stats.maxWaitMs, waitMs);
+
+		toSend.push_back(ptr);
+		ll.m_Queue.erase(c->it);
+	}
+}
+
+void RpcThreadWorker::logPriorityStats() const
+{
+	for (int i = 0; i < RpcData::PR_Count; ++i)
+	{
+		const PriorityStats& stats = m_PriorityStats[i];
+		if (!stats.sent)
 			continue;
+		hlp::addLogMsg("%s: %s: %u request(s) sent, wait avg: %lld ms, max: %lld ms, max queue depth: %u\n",
+			__FUNCTION__, kPriorityNames[i], stats.sent,
+			static_cast<long long>(stats.totalWaitMs / stats.sent), static_cast<long long>(stats.maxWaitMs),
+			stats.maxQueued);
+	}
+}
+
+bool RpcThreadWorker::sendRequest(RpcDataPtr pRD, const std::string& host, uint16_t port)
+{
+	Labeless& ll = Labeless::instance();
+
+	rpc::Execute command;
+	command.set_script(pRD->script);
+	if (!pRD->scriptExternObj.empty())
+		command.set_script_extern_obj(pRD->scriptExternObj);
+	if (!pRD->scriptExternMarshal.empty())
+		command.set_script_extern_marshal(pRD->scriptExternMarshal);
+	command.set_rpc_request(pRD->params);
+	if (std::dynamic_pointer_cast<AnalyzeExternalRefs>(pRD->iCmd) && !pRD->jobId && pRD->retryCount == 0)
+		command.set_background(true);
+	if (pRD->jobId)
+		command.set_job_id(pRD->jobId);
+	const uint64_t requestId = ++m_LastRequestId;
+	command.set_request_id(requestId);
+
+	std::string message = command.SerializeAsString();
+
+	QString errorMsg;
+	// a connection which was idle for a while may be dropped by the peer, so reconnect once.
+	// It's safe only if nothing else is in flight, otherwise the failed requests are reported
+	for (int attempt = 0; attempt < 2; ++attempt)
+	{
+		const bool reused = INVALID_SOCKET != m_Socket;
+		if (!reused)
+		{
+			uint8_t protocolVersion = 0;
+			uint8_t codec = compression::CODEC_None;
+			m_Socket = ll.connectToHost(host, port, errorMsg, protocolVersion, codec, m_Relocations);
+			ll.m_ProtocolVersion = protocolVersion;
+			ll.m_Codec = codec;
+			if (INVALID_SOCKET == m_Socket)
+				break;
+			m_Host = host;
+			m_Port = port;
+			++m_ConnectsCount;
 		}
-		std::shared_ptr<void> guard(nullptr, [s](void*){ closesocket(s); }); // clean-up guard
 
-		try
+		const uint8_t peerVersion = uint8_t(int(ll.m_ProtocolVersion));
+		if (pRD->minProtocolVersion > peerVersion)
 		{
-			rpc::Execute command;
-			command.set_script(pRD->script);
+			// serialized before the connection to an older Labeless Olly
+			pRD->iCmd->protocolVersion = peerVersion;
+			if (!pRD->iCmd->serialize(pRD))
+			{
+				errorMsg = QString("Unable to serialize the request for protocol version %1").arg(peerVersion);
+				break;
+			}
+			command.set_rpc_request(pRD->params);
+			command.clear_script_extern_obj();
+			command.clear_script_extern_marshal();
 			if (!pRD->scriptExternObj.empty())
 				command.set_script_extern_obj(pRD->scriptExternObj);
-			command.set_rpc_request(pRD->params);
-			if (std::dynamic_pointer_cast<AnalyzeExternalRefs>(pRD->iCmd) && !pRD->jobId && pRD->retryCount == 0)
-				command.set_background(true);
-			if (pRD->jobId)
-				command.set_job_id(pRD->jobId);
-
-			const std::string message = command.SerializeAsString();
+			if (!pRD->scriptExternMarshal.empty())
+				command.set_script_extern_marshal(pRD->scriptExternMarshal);
+			message = command.SerializeAsString();
+		}
 
-			if (!hlp::net::sockSendString(s, message))
-				continue;
+		std::string error;
+		if (hlp::net::sendFrame(m_Socket, netframe::FT_Execute, message, error,
+			uint8_t(int(ll.m_ProtocolVersion)), uint8_t(int(ll.m_Codec))))
+		{
+			m_InFlight[requestId] = pRD;
+			++m_RequestsCount;
+			return true;
+		}
+		errorMsg = QString("sendFrame() failed, error: %1").arg(QString::fromStdString(error));
+		const bool canRetry = reused && m_InFlight.empty();
+		closeConnection(errorMsg);
+		if (!canRetry)
+			break;
+	}
 
-			std::string strResponse;
-			if (!hlp::net::sockRecvAll(s, strResponse) || strResponse.empty())
-			{
-				hlp::addLogMsg("sockRecvAll() failed, error: %s\n", hlp::net::wsaErrorToString().c_str());
-				continue;
-			}
+	if (errorMsg.isEmpty())
+		errorMsg = "connectToHost() failed";
+	hlp::addLogMsg("%s\n", errorMsg.toStdString().c_str());
+	pRD->emitFailed(errorMsg);
+	return false;
+}
 
-			auto response = std::make_shared<rpc::Response>();
-			const bool parsedOk = hlp::protobuf::parseBigMessage(*response, strResponse);
-			if (!parsedOk)
-				hlp::addLogMsg("%s: rpc::Response::ParseFromString() failed\n", __FUNCTION__);
-			else
-				hlp::addLogMsg("OK, tasks left: %u\n", queueSize);
+bool RpcThreadWorker::receiveResponse()
+{
+	netframe::Header header;
+	const size_t capacity = m_RecvBuff.capacity();
+	const bool ok = hlp::net::recvFrame(m_Socket, header, m_RecvBuff, &m_PackedBuff);
+	m_RecvBuffStats.update(capacity, m_RecvBuff.capacity());
+	// don't hold the memory of a huge response until the next one
+	std::shared_ptr<void> guard(nullptr, [this](void*) {
+		recvbuffer::release(m_RecvBuff);
+		recvbuffer::release(m_PackedBuff);
+	});
+	if (!ok || (header.type != netframe::FT_Response && header.type != netframe::FT_MemoryChunk &&
+		header.type != netframe::FT_OutputChunk))
+	{
+		closeConnection(QString("recvFrame() failed, error: %1").arg(hlp::net::wsaErrorToString().c_str()));
+		return false;
+	}
+	if (header.type == netframe::FT_MemoryChunk)
+		return receiveMemoryChunk(m_RecvBuff);
+	if (header.type == netframe::FT_OutputChunk)
+		return receiveOutputChunk(m_RecvBuff);
+	const std::string& strResponse = m_RecvBuff;
 
 #ifdef LABELESS_ADDITIONAL_LOGGING
-			do {
-				if (auto f = qfopen("c:\\labeless_ida.log", "ab+"))
-				{
-					qfseek(f, 0, SEEK_END);
-					static const std::string s = "\nReceived:\n";
-					qfwrite(f, s.c_str(), s.length());
-					qfwrite(f, strResponse.c_str(), strResponse.length());
-					qfwrite(f, "\r\n", 2);
-					qfclose(f);
-				}
-			} while (0);
+	do {
+		if (auto f = qfopen("c:\\labeless_ida.log", "ab+"))
+		{
+			qfseek(f, 0, SEEK_END);
+			static const std::string s = "\nReceived:\n";
+			qfwrite(f, s.c_str(), s.length());
+			qfwrite(f, strResponse.c_str(), strResponse.length());
+			qfwrite(f, "\r\n", 2);
+			qfclose(f);
+		}
+	} while (0);
 #endif // LABELESS_ADDITIONAL_LOGGING
 
-			if (parsedOk)
-				pRD->response = response;
-			pRD->emitReceived();
+	try
+	{
+		auto response = std::make_shared<rpc::Response>();
+		if (!hlp::protobuf::parseBigMessage(*response, strResponse))
+		{
+			// the response can't be matched to its request without request_id
+			closeConnection(QString("%1: rpc::Response::ParseFromString() failed").arg(__FUNCTION__));
+			return false;
+		}
+
+		const auto it = m_InFlight.find(response->request_id());
+		if (it == m_InFlight.end())
+		{
+			hlp::addLogMsg("%s: unexpected response, request_id: %llu\n", __FUNCTION__,
+				static_cast<unsigned long long>(response->request_id()));
+			return false;
 		}
-		catch (...)
+		RpcDataPtr pRD = it->second;
+		m_InFlight.erase(it);
+		if (!pRD)
+			return false;
+
+		Labeless& ll = Labeless::instance();
+		unsigned queued[RpcData::PR_Count] = {};
+		ll.m_QueueLock.lock();
+		const unsigned queueSize = ll.m_Queue.size();
+		for (auto qit = ll.m_Queue.begin(); qit != ll.m_Queue.end(); ++qit)
 		{
-			continue;
+			if (*qit)
+				++queued[(*qit)->priority];
 		}
+		ll.m_QueueLock.unlock();
+		hlp::addLogMsg("OK, tasks left: %u (interactive: %u, rename: %u, bulk sync: %u, dump analysis: %u), in flight: %u\n",
+			queueSize, queued[RpcData::PR_Interactive], queued[RpcData::PR_Rename], queued[RpcData::PR_BulkSync],
+			queued[RpcData::PR_DumpAnalysis], unsigned(m_InFlight.size()));
+
+		// the log item gets the whole output, the streamed part first
+		if (!pRD->streamedStdOut.empty())
+			response->mutable_std_out()->insert(0, pRD->streamedStdOut);
+		if (!pRD->streamedStdErr.empty())
+			response->mutable_std_err()->insert(0, pRD->streamedStdErr);
+		pRD->response = response;
+		pRD->emitReceived();
 	}
-	moveToThread(qApp->thread());
-	deleteLater();
+	catch (...)
+	{
+		return false;
+	}
+	return true;
+}
+
+bool RpcThreadWorker::receiveMemoryChunk(const std::string& payload)
+{
+	MemoryChunkView chunk;
+	if (!parseMemoryChunk(payload, chunk))
+	{
+		hlp::addLogMsg("%s: rpc::MemoryChunk parsing failed\n", __FUNCTION__);
+		return false;
+	}
+	// the request stays in flight until its response arrives
+	const auto it = m_InFlight.find(chunk.requestId);
+	if (it == m_InFlight.end() || !it->second)
+	{
+		hlp::addLogMsg("%s: unexpected memory chunk, request_id: %llu\n", __FUNCTION__,
+			static_cast<unsigned long long>(chunk.requestId));
+		return false;
+	}
+	it->second->emitChunkReceived(chunk.regionIndex, chunk.offset, chunk.data);
+	return true;
+}
+
+bool RpcThreadWorker::receiveOutputChunk(const std::string& payload)
+{
+	rpc::OutputChunk chunk;
+	if (!chunk.ParseFromString(payload))
+	{
+		hlp::addLogMsg("%s: rpc::OutputChunk parsing failed\n", __FUNCTION__);
+		return false;
+	}
+	const auto it = m_InFlight.find(chunk.request_id());
+	if (it == m_InFlight.end() || !it->second)
+	{
+		hlp::addLogMsg("%s: unexpected output chunk, request_id: %llu\n", __FUNCTION__,
+			static_cast<unsigned long long>(chunk.request_id()));
+		return false;
+	}
+	// show the output of a long script while it's still running, hlp::addLogMsg() would truncate it
+	static const QString kOllyOutput = "Olly";
+	const QString text = QString::fromStdString(chunk.std_out() + chunk.std_err()).trimmed();
+	if (!text.isEmpty())
+		QMetaObject::invokeMethod(&Labeless::instance(), "onLogMessage", Qt::QueuedConnection,
+			Q_ARG(QString, text),
+			Q_ARG(QString, kOllyOutput));
+	it->second->streamedStdOut += chunk.std_out();
+	it->second->streamedStdErr += chunk.std_err();
+	return true;
+}
+
+void RpcThreadWorker::closeConnection(const QString& reason)
+{
+	if (INVALID_SOCKET != m_Socket)
+	{
+		closesocket(m_Socket);
+		m_Socket = INVALID_SOCKET;
+		Labeless::instance().m_ProtocolVersion = 0;
+		Labeless::instance().m_Codec = compression::CODEC_None;
+	}
+
+	for (auto it = m_InFlight.begin(); it != m_InFlight.end(); ++it)
+	{
+		if (it->second)
+			it->second->emitFailed(reason);
+	}
+	if (!m_InFlight.empty())
+		hlp::addLogMsg("%s: %u request(s) in flight failed: %s\n", __FUNCTION__, unsigned(m_InFlight.size()),
+			reason.toStdString().c_str());
+	m_InFlight.clear();
 }
@@ -8,7 +8,12 @@
 
 #pragma once
 
+#include <map>
+#include <string>
 #include <QObject>
+#include "types.h"
+#include "rpcdata.h"
+#include "../common/recvbuffer.h"
 
 class RpcThreadWorker : public QObject
 {
@@ -19,5 +24,39 @@ public:
 
 public slots:
 	void main();
+
+private:
+	struct PriorityStats
+	{
+		unsigned	sent;
+		unsigned	maxQueued;
+		qint64		totalWaitMs;
+		qint64		maxWaitMs;
+	};
+
+	void pickRequestsToSend(QList<RpcDataPtr>& toSend, unsigned maxInFlight);
+	void logPriorityStats() const;
+	bool sendRequest(RpcDataPtr pRD, const std::string& host, uint16_t port);
+	bool receiveResponse();
+	bool receiveMemoryChunk(const std::string& payload);
+	bool receiveOutputChunk(const std::string& payload);
+	void closeConnection(const QString& reason = QString());
+
+private:
+	SOCKET							m_Socket;
+	std::string						m_Host;
+	uint16_t						m_Port;
+	RelocationList					m_Relocations; // sent in Hello of the current connection
+	uint64_t						m_LastRequestId;
+	std::map<uint64_t, RpcDataPtr>	m_InFlight; // by rpc::Execute::request_id
+
+	unsigned						m_ConnectsCount;
+	unsigned						m_RequestsCount;
+	PriorityStats					m_PriorityStats[RpcData::PR_Count];
+
+	// frame buffers are reused by the next response, they keep the capacity of the biggest one
+	std::string						m_RecvBuff;
+	std::string						m_PackedBuff;
+	recvbuffer::Stats				m_RecvBuffStats;
 };
 
@@ -17,6 +17,7 @@
 
 #include "types.h"
 #include "globalsettingsmanager.h"
+#include "hlp.h"
 #include "pythonpalettemanager.h"
 #include "../common/version.h"
 
@@ -58,6 +59,8 @@ SettingsDialog::SettingsDialog(const Settings& settings, quint32 currModBase, QW
 	m_UI->sbOllyPort->setValue(settings.port);
 	m_UI->leRemoteModuleBase->setText(QString("0x%1").arg(settings.remoteModBase, 8, 16, QChar('0')));
 	m_UI->leRemoteModuleBase->setToolTip(QString("Current IDA DB's module base is 0x%1.").arg(currModBase, 8, 16, QChar('0')));
+	m_UI->leRelocations->setText(hlp::relocationsToString(settings.relocations));
+	m_UI->leMirrors->setText(hlp::ollyAddressesToString(settings.mirrors));
 	m_UI->gbEnabledSync->setChecked(settings.enabled);
 	m_UI->chDemangleNames->setChecked(settings.demangle);
 	m_UI->chLocalLabels->setChecked(settings.localLabels);
@@ -151,6 +154,9 @@ void SettingsDialog::getSettings(Settings& result)
 
 	if (!ok)
 		result.remoteModBase = remoteModBase.toUInt(&ok, 16);
+	QString error;
+	hlp::parseRelocations(m_UI->leRelocations->text(), result.relocations, error);
+	hlp::parseOllyAddresses(m_UI->leMirrors->text(), result.mirrors, error);
 	
 	result.enabled = m_UI->gbEnabledSync->isChecked();
 	result.demangle = m_UI->chDemangleNames->isChecked();
@@ -242,6 +248,19 @@ bool SettingsDialog::validate() const
 		info(tr("Size of \"extern\" segment in hex is <b>invalid</b>.<br>Should be multiple by DWORD_PTR size(for i686 arch = 4) and not less than 0x1000.").toStdString().c_str());
 		return false;
 	}
+	RelocationList relocations;
+	QString error;
+	if (!hlp::parseRelocations(m_UI->leRelocations->text(), relocations, error))
+	{
+		info("%s", error.toStdString().c_str());
+		return false;
+	}
+	OllyAddressList mirrors;
+	if (!hlp::parseOllyAddresses(m_UI->leMirrors->text(), mirrors, error))
+	{
+		info("%s", error.toStdString().c_str());
+		return false;
+	}
 
 	return true;
 }
@@ -0,0 +1,47 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace externprologue {
+
+// the standard base64 alphabet with the padding, as binascii.a2b_base64() reads it
+inline std::string base64(const std::string& data)
+{
+	static const char kChars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	std::string rv;
+	rv.reserve((data.size() + 2) / 3 * 4);
+	for (size_t i = 0; i < data.size(); i += 3)
+	{
+		const size_t left = data.size() - i;
+		const uint32_t v = (uint32_t(uint8_t(data[i])) << 16) |
+			(left > 1 ? uint32_t(uint8_t(data[i + 1])) << 8 : 0) |
+			(left > 2 ? uint32_t(uint8_t(data[i + 2])) : 0);
+		rv += kChars[(v >> 18) & 0x3F];
+		rv += kChars[(v >> 12) & 0x3F];
+		rv += left > 1 ? kChars[(v >> 6) & 0x3F] : '=';
+		rv += left > 2 ? kChars[v & 0x3F] : '=';
+	}
+	return rv;
+}
+
+/* The script for a peer older than netframe::kBinaryExternProtocolVersion when __extern__ is marshal data only.
+ * Such a peer doesn't know rpc::Execute::script_extern_marshal, so the script sets __extern__ itself
+ * from the marshal data in base64, then runs as usual.
+ */
+inline std::string prepend(const std::string& externMarshal, const std::string& script)
+{
+	return "__extern__ = __import__('marshal').loads(__import__('binascii').a2b_base64('" +
+		base64(externMarshal) + "'))\n" + script;
+}
+
+} // externprologue
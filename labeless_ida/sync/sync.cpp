@@ -7,12 +7,17 @@
  */
 
 #include "sync.h"
+#include <algorithm>
 #include <sstream>
+#include <vector>
 #include <QFile>
 
 #include "../hlp.h"
 #include "../rpcdata.h"
 #include "../../common/cpp/rpc.pb.h"
+#include "../../common/netframe.h"
+#include "../../common/packednames.h"
+#include "externprologue.h"
 
 namespace {
 
@@ -25,6 +30,27 @@ std::string trimToOllyLimitsString(const std::string& s)
 	return rv;
 }
 
+// see rpc::PackedNames
+template <typename DataList>
+void packNames(const DataList& dl, rpc::PackedNames* packed)
+{
+	typedef typename DataList::value_type Data;
+	std::vector<const Data*> items;
+	items.reserve(dl.size());
+	for (auto it = dl.constBegin(); it != dl.constEnd(); ++it)
+		items.push_back(&*it);
+	// stable, so the last one of the same address still wins
+	std::stable_sort(items.begin(), items.end(), [](const Data* l, const Data* r) { return l->ea < r->ea; });
+
+	packed->mutable_ea_deltas()->Reserve(static_cast<int>(items.size()));
+	packed->mutable_shared_sizes()->Reserve(static_cast<int>(items.size()));
+	packed->mutable_suffix_sizes()->Reserve(static_cast<int>(items.size()));
+
+	packednames::Writer<rpc::PackedNames> writer(packed);
+	for (auto it = items.cbegin(); it != items.cend(); ++it)
+		writer.add((*it)->ea, trimToOllyLimitsString((*it)->label));
+}
+
 //static const std::string kRpcCallPythonCommand = "import pyexcore\npyexcore.PyExCore.execute()";
 
 } // anonymous
@@ -96,7 +122,26 @@ std::string ICommand::makeRpcParam(T* pMessage, int requestType) const throw ()
 bool ExecPyScript::serialize(QPointer<RpcData> rd) const
 {
 	rd->script = d.ollyScript;
-	rd->scriptExternObj = d.idaExtern;
+	rd->scriptExternObj.clear();
+	rd->scriptExternMarshal.clear();
+	rd->minProtocolVersion = 0;
+	if (!d.idaExternMarshal.empty() && protocolVersion >= netframe::kBinaryExternProtocolVersion)
+	{
+		rd->scriptExternMarshal = d.idaExternMarshal;
+		rd->minProtocolVersion = netframe::kBinaryExternProtocolVersion;
+	}
+	else if (!d.idaExternMarshal.empty() && d.idaExtern.empty())
+	{
+		// __extern__ was made for a newer peer and there is no JSON for this one, the script decodes it itself.
+		// A v5 or older Labeless Olly gets an empty script_extern_obj and sets no __extern__, then runs the
+		// prologue line in __main__ like the rest of the script. The script grows by 4/3 of the marshal data
+		// size, and the line numbers in its tracebacks are one more than in the editor
+		rd->script = externprologue::prepend(d.idaExternMarshal, d.ollyScript);
+	}
+	else
+	{
+		rd->scriptExternObj = d.idaExtern;
+	}
 	return true;
 }
 
@@ -115,12 +160,21 @@ bool FuncNameSync::serialize(QPointer<RpcData> rd) const
 		request->set_base(base);
 		request->set_remote_base(remoteBase);
 
-		for (auto it = data.begin(), end = data.end(); it != end; ++it)
+		rd->minProtocolVersion = 0;
+		if (protocolVersion >= netframe::kPackedNamesProtocolVersion)
+		{
+			packNames(data, request->mutable_packed_names());
+			rd->minProtocolVersion = netframe::kPackedNamesProtocolVersion;
+		}
+		else
 		{
-			const Data& sd = *it;
-			auto v = request->add_names();
-			v->set_ea(sd.ea);
-			v->set_name(trimToOllyLimitsString(sd.label));
+			for (auto it = data.begin(), end = data.end(); it != end; ++it)
+			{
+				const Data& sd = *it;
+				auto v = request->add_names();
+				v->set_ea(sd.ea);
+				v->set_name(trimToOllyLimitsString(sd.label));
+			}
 		}
 		rd->script.clear();
 		rd->params = rpcRequest.SerializeAsString();
@@ -150,12 +204,21 @@ bool LocalLabelsSync::serialize(QPointer<RpcData> rd) const
 		request->set_base(base);
 		request->set_remote_base(remoteBase);
 
-		for (auto it = data.begin(), end = data.end(); it != end; ++it)
+		rd->minProtocolVersion = 0;
+		if (protocolVersion >= netframe::kPackedNamesProtocolVersion)
+		{
+			packNames(data, request->mutable_packed_names());
+			rd->minProtocolVersion = netframe::kPackedNamesProtocolVersion;
+		}
+		else
 		{
-			const Data& sd = *it;
-			auto v = request->add_names();
-			v->set_ea(sd.ea);
-			v->set_name(trimToOllyLimitsString(sd.label));
+			for (auto it = data.begin(), end = data.end(); it != end; ++it)
+			{
+				const Data& sd = *it;
+				auto v = request->add_names();
+				v->set_ea(sd.ea);
+				v->set_name(trimToOllyLimitsString(sd.label));
+			}
 		}
 		rd->script.clear();
 		rd->params = rpcRequest.SerializeAsString();
@@ -229,7 +292,10 @@ bool ReadMemoryRegions::serialize(QPointer<RpcData> rd) const
 			rpc::ReadMemoryRegionsRequest_Region* const region = request->add_regions();
 			region->set_addr(it->base);
 			region->set_size(it->size);
+			for (auto h = it->pageHashes.cbegin(), e = it->pageHashes.cend(); h != e; ++h)
+				region->add_page_hashes(*h);
 		}
+		request->set_chunk_size(kChunkSize);
 
 		rd->script.clear();
 		rd->params = rpcRequest.SerializeAsString();
@@ -270,7 +336,10 @@ bool ReadMemoryRegions::parseResponse(QPointer<RpcData> rd)
 				msg("%s: data inconsistence, addr/size mismatch\n", __FUNCTION__);
 				return false;
 			}
-			m.raw = memory.mem();
+			// the streamed regions are already in the database
+			if (!memory.mem().empty())
+				m.raw = memory.mem();
+			m.unchanged = memory.unchanged_size();
 			if (!m.protect)
 				m.protect = memory.protect();
 		}
@@ -446,3 +515,68 @@ bool CheckPEHeaders::parseResponse(QPointer<RpcData> rd)
 	}
 	return false;
 }
+
+bool GetNamesReq::serialize(QPointer<RpcData> rd) const
+{
+	try
+	{
+		rpc::RpcRequest rpcRequest;
+		rpcRequest.set_request_type(rpc::RpcRequest::RPCT_GET_NAMES);
+
+		rpc::GetNamesRequest* const request = rpcRequest.mutable_get_names_req();
+		request->set_base(base);
+		request->set_remote_base(remoteBase);
+		request->set_start(start);
+		request->set_end(end);
+
+		rd->script.clear();
+		rd->params = rpcRequest.SerializeAsString();
+		return true;
+	}
+	catch (...)
+	{
+		msg("%s: Unable to serialize rpc::GetNamesRequest\n", __FUNCTION__);
+	}
+	return false;
+}
+
+bool GetNamesReq::parseResponse(QPointer<RpcData> rd)
+{
+	if (!ICommand::parseResponse(rd))
+		return false;
+
+	try
+	{
+		rpc::GetNamesResult result;
+		if (!hlp::protobuf::parseBigMessage(result, rd->response->rpc_result()))
+		{
+			msg("%s: rpc::GetNamesResult::ParseFromString() failed\n", __FUNCTION__);
+			return false;
+		}
+
+		data.clear();
+		data.reserve(result.names_size());
+		uint32_t ea = start;
+		const auto& names = result.names();
+		for (auto it = names.begin(), end = names.end(); it != end; ++it)
+		{
+			ea += it->ea_delta();
+			Data d = {
+				ea,
+				it->label(),
+				it->comment()
+			};
+			data.push_back(d);
+		}
+		return true;
+	}
+	catch (std::runtime_error e)
+	{
+		msg("%s: Runtime error: %s\n", __FUNCTION__, e.what());
+	}
+	catch (...)
+	{
+		msg("%s: Unable to parse GetNamesRequest response\n", __FUNCTION__);
+	}
+	return false;
+}
@@ -10,10 +10,12 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 #include <pro.h>
 
 #include "../types.h"
 
+#include <QElapsedTimer>
 #include <QList>
 #include <QPointer>
 
@@ -26,6 +28,7 @@ struct ICommand
 	ea_t		remoteBase;
 	uint64_t	jobId;
 	bool		pending;
+	uint8_t		protocolVersion; // of Labeless Olly the request is serialized for
 
 	std::string stdOut;
 	std::string stdErr;
@@ -39,6 +42,7 @@ struct ICommand
 		, remoteBase(0)
 		, jobId(0)
 		, pending(false)
+		, protocolVersion(0)
 	{}
 protected:
 	template <typename T>
@@ -50,7 +54,8 @@ struct ExecPyScript : public ICommand
 	struct Data
 	{
 		std::string idaScript;
-		std::string idaExtern;
+		std::string idaExtern; // JSON
+		std::string idaExternMarshal; // marshal.dumps(), preferred by the protocol version >= 6 peers
 		std::string ollyScript;
 	};
 	Data d;
@@ -59,6 +64,26 @@ struct ExecPyScript : public ICommand
 	virtual bool parseResponse(QPointer<RpcData> rd) override;
 };
 
+// shared by the batches of one names/comments sync to report its progress
+struct SyncProgress
+{
+	unsigned		total;
+	unsigned		done;
+	unsigned		batches;
+	unsigned		batchesDone;
+	QElapsedTimer	timer;
+
+	SyncProgress()
+		: total(0)
+		, done(0)
+		, batches(0)
+		, batchesDone(0)
+	{
+		timer.start();
+	}
+};
+typedef std::shared_ptr<SyncProgress> SyncProgressPtr;
+
 struct FuncNameSync : public ICommand
 {
 	struct Data
@@ -73,6 +98,7 @@ struct FuncNameSync : public ICommand
 	typedef QList<Data> DataList;
 
 	DataList data;
+	SyncProgressPtr progress;
 
 	virtual bool serialize(QPointer<RpcData> rd) const override;
 	virtual bool parseResponse(QPointer<RpcData> rd) override;
@@ -92,6 +118,7 @@ struct LocalLabelsSync : public ICommand
 	typedef QList<Data> DataList;
 
 	DataList data;
+	SyncProgressPtr progress;
 
 	virtual bool serialize(QPointer<RpcData> rd) const override;
 	virtual bool parseResponse(QPointer<RpcData> rd) override;
@@ -110,13 +137,23 @@ struct ReadMemoryRegions : public ICommand
 	struct t_memory : public MemoryRegion
 	{
 		std::string raw;
+		uint32_t streamed; // bytes written to the segment by rpc::MemoryChunk, raw stays empty then
+		uint32_t unchanged; // bytes of the pages matching pageHashes, not sent by Olly
+		bool merged; // the segment is created
+		std::vector<uint64_t> pageHashes; // of the data the database already has, see hlp::memoryPageHashes()
 		t_memory(ea_t base_, uint32_t size_, uint32_t protect_, const std::string& raw_)
 			: MemoryRegion(base_, size_, protect_)
 			, raw(raw_)
+			, streamed(0)
+			, unchanged(0)
+			, merged(false)
 		{}
 	};
 	typedef QList<t_memory> DataList;
 
+	static const uint32_t kChunkSize = 1024 * 1024;
+	static const uint32_t kPageSize = 0x1000;
+
 	DataList data;
 
 	virtual bool serialize(QPointer<RpcData> rd) const override;
@@ -213,3 +250,29 @@ struct CheckPEHeaders : public ICommand
 	virtual bool serialize(QPointer<RpcData> rd) const override;
 	virtual bool parseResponse(QPointer<RpcData> rd) override;
 };
+
+struct GetNamesReq : public ICommand
+{
+	struct Data
+	{
+		uint32_t	ea;
+		std::string label;
+		std::string comment;
+	};
+	typedef std::vector<Data> DataList;
+
+	// params, IDA addresses
+	ea_t start;
+	ea_t end;
+
+	// result, sorted by ea
+	DataList data;
+
+	GetNamesReq()
+		: start(0)
+		, end(0)
+	{}
+
+	virtual bool serialize(QPointer<RpcData> rd) const override;
+	virtual bool parseResponse(QPointer<RpcData> rd) override;
+};
@@ -0,0 +1,41 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+namespace syncbatch {
+
+static const unsigned kItemOverhead = 12; // protobuf framing of a name: ea, tags and lengths
+
+/* Splits the names or comments (anything with a std::string label) into batches of at most maxNames items
+ * and about maxBytes on the wire each. An item larger than maxBytes goes alone in its batch.
+ */
+template <typename List, typename Batches>
+void split(const List& dl, unsigned maxNames, size_t maxBytes, Batches& rv)
+{
+	List batch;
+	size_t bytes = 0;
+	for (auto it = dl.begin(); it != dl.end(); ++it)
+	{
+		const size_t itemBytes = it->label.size() + kItemOverhead;
+		if (!batch.empty() && (unsigned(batch.size()) >= maxNames || bytes + itemBytes > maxBytes))
+		{
+			rv.push_back(batch);
+			batch.clear();
+			bytes = 0;
+		}
+		batch.push_back(*it);
+		bytes += itemBytes;
+	}
+	if (!batch.empty())
+		rv.push_back(batch);
+}
+
+} // syncbatch
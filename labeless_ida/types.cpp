@@ -32,6 +32,19 @@ bool MemoryRegion::isIntersects(const MemoryRegion& r) const
 	return base <= r.end() && r.base <= end();
 }
 
+Relocation::Relocation(uint32_t start_, uint32_t end_, uint32_t remoteStart_)
+	: start(start_)
+	, end(end_)
+	, remoteStart(remoteStart_)
+{
+}
+
+OllyAddress::OllyAddress(const std::string& host_, uint16_t port_)
+	: host(host_)
+	, port(port_)
+{
+}
+
 Settings::Settings(const std::string host_,
 	uint16_t port_,
 	uint32_t remoteModBase_,
@@ -117,6 +117,34 @@ struct MemoryRegion
 };
 typedef QList<MemoryRegion> MemoryRegionList;
 
+// an IDB range [start, end) which is at remoteStart in the debuggee
+struct Relocation
+{
+	uint32_t start;
+	uint32_t end;
+	uint32_t remoteStart;
+
+	Relocation(uint32_t start_ = 0, uint32_t end_ = 0, uint32_t remoteStart_ = 0);
+
+	inline bool operator==(const Relocation& r) const {
+		return start == r.start && end == r.end && remoteStart == r.remoteStart;
+	}
+};
+typedef QList<Relocation> RelocationList;
+
+struct OllyAddress
+{
+	std::string host;
+	uint16_t port;
+
+	OllyAddress(const std::string& host_ = std::string(), uint16_t port_ = 0);
+
+	inline bool operator==(const OllyAddress& r) const {
+		return host == r.host && port == r.port;
+	}
+};
+typedef QList<OllyAddress> OllyAddressList;
+
 struct ReadMemoryRegions;
 struct CheckPEHeaders;
 struct AnalyzeExternalRefs;
@@ -142,6 +170,8 @@ struct Settings
 	bool postProcessFixCallJumps;
 	uint32_t defaultExternSegSize;
 	OverwriteWarning overwriteWarning;
+	RelocationList relocations; // sorted, names out of these ranges are relocated by remoteModBase
+	OllyAddressList mirrors; // other Labeless Olly instances the names and comments are mirrored to
 
 	Settings(const std::string host_ = std::string(),
 		uint16_t port = 0,
@@ -8,21 +8,30 @@
 
 #include "labeless.h"
 
+#include <algorithm>
 #include <fstream>
 #include <intsafe.h>
 #include <inttypes.h>
+#include <list>
 #include <memory>
 #include <mstcpip.h>
 #include <regex>
 #include <strsafe.h>
 #include <time.h>
+#include <unordered_map>
+#include <vector>
 
 #include "types.h"
 #include "util.h"
 
+#include <google/protobuf/io/coded_stream.h>
+
 #include "../common/cpp/rpc.pb.h"
+#include "../common/packednames.h"
 #include "../common/version.h"
 
+#include <marshal.h>
+
 extern "C" {
 	void init_ollyapi();
 };
@@ -182,27 +191,169 @@ inline void server_log(const char* fmt, ...)
 	PostMessage(gConfig.helperWnd, gConfig.hlpLogMessageId, reinterpret_cast<WPARAM>(msg), static_cast<LPARAM>(len));
 }
 
-static PyObject* stdOutHandler(PyObject* self, PyObject* arg)
+static const size_t kOutputChunkSize = 16 * 1024;
+static const size_t kResponseReserve = 64 * 1024; // the rest of rpc::Response appended to rpc_result
+static const DWORD kChunksStallTimeoutMs = 10 * 1000; // send_memory_chunk() gives up if no chunk is sent for so long
+
+// the output is streamed to the client by kOutputChunkSize increments while the job is running
+static void flushOutput(Request& r)
 {
-	const char* str = PyString_AsString(arg);
+	rpc::OutputChunk chunk;
+	chunk.set_request_id(r.requestId);
+	chunk.mutable_std_out()->swap(r.stdOut.text);
+	chunk.mutable_std_err()->swap(r.stdErr.text);
 
-	auto& cd = Labeless::instance().clientData();
-	recursive_lock_guard lock(cd.stdOutLock);
-	cd.stdOut << str << "\n";
+	Labeless& ll = Labeless::instance();
+	ExecutionData& ed = ll.executionData();
+	do {
+		recursive_lock_guard lock(ed.commandsLock);
+		if (ed.find(r.id) != &r)
+			return; // dropped with its connection
+		r.chunks.push_back(PendingFrame(netframe::FT_OutputChunk, chunk.SerializeAsString()));
+		ed.queuedChunkBytes += r.chunks.back().second.size();
+	} while (0);
+	ll.notifyResultsReady();
+}
 
+// python runs on the GUI thread only, so the running job's output is written without a lock
+static void captureOutput(PyObject* arg, bool isStdErr)
+{
+	char* str = nullptr;
+	Py_ssize_t size = 0;
+	if (!PyString_Check(arg) || PyString_AsStringAndSize(arg, &str, &size) < 0)
+		return;
+
+	Labeless& ll = Labeless::instance();
+	ExecutionData& ed = ll.executionData();
+	Request* const r = ed.runningJob.get();
+	if (!r)
+	{
+		(isStdErr ? ed.stdErr : ed.stdOut).write(str, size) << "\n";
+		return;
+	}
+
+	OutputCapture& out = isStdErr ? r->stdErr : r->stdOut;
+	if (!out.append(str, static_cast<size_t>(size), ll.maxOutputSize()))
+		return;
+	if (r->outputStreamingAllowed && r->stdOut.text.size() + r->stdErr.text.size() >= kOutputChunkSize)
+		flushOutput(*r);
+}
+
+// the output not streamed yet, followed by the truncation notice if it was over the limit
+static void takeOutput(OutputCapture& out, std::string& rv)
+{
+	rv.swap(out.text);
+	if (!out.dropped)
+		return;
+	char buff[128] = {};
+	_snprintf_s(buff, _countof(buff), _TRUNCATE, "[Labeless: %Iu byte(s) of the output dropped, see max_output_size]\n",
+		out.dropped);
+	rv += buff;
+}
+
+static PyObject* stdOutHandler(PyObject* self, PyObject* arg)
+{
+	captureOutput(arg, false);
 	Py_RETURN_NONE;
 }
 
 static PyObject* stdErrHandler(PyObject*, PyObject* arg)
 {
-	const char* str = PyString_AsString(arg);
-	auto& cd = Labeless::instance().clientData();
-	recursive_lock_guard lock(cd.stdErrLock);
-	cd.stdErr << str << "\n";
-
+	captureOutput(arg, true);
 	Py_RETURN_NONE;
 }
 
+// protobuf wire format writers, the big bytes fields are built in place instead of being copied by a message
+static void putVarint(std::string& out, uint64_t v)
+{
+	for (; v >= 0x80; v >>= 7)
+		out.push_back(static_cast<char>(v | 0x80));
+	out.push_back(static_cast<char>(v));
+}
+
+static void putVarintField(std::string& out, int field, uint64_t v)
+{
+	putVarint(out, static_cast<uint64_t>(field) << 3); // WIRETYPE_VARINT
+	putVarint(out, v);
+}
+
+static void putBytesField(std::string& out, int field, const char* data, size_t size)
+{
+	putVarint(out, (static_cast<uint64_t>(field) << 3) | 2); // WIRETYPE_LENGTH_DELIMITED
+	putVarint(out, size);
+	out.append(data, size);
+}
+
+// read-only buffer over Request::params, it keeps the job alive while Python references it
+struct JobParamsObject
+{
+	PyObject_HEAD
+	RequestPtr*	request;
+};
+
+static PyTypeObject gJobParamsType = { PyVarObject_HEAD_INIT(NULL, 0) };
+
+static const std::string& jobParams(PyObject* self)
+{
+	return (*reinterpret_cast<JobParamsObject*>(self)->request)->params;
+}
+
+static void jobParamsDealloc(PyObject* self)
+{
+	delete reinterpret_cast<JobParamsObject*>(self)->request;
+	PyObject_Del(self);
+}
+
+static Py_ssize_t jobParamsReadBuffer(PyObject* self, Py_ssize_t segment, void** ptr)
+{
+	if (segment != 0)
+	{
+		PyErr_SetString(PyExc_SystemError, "accessing non-existent segment");
+		return -1;
+	}
+	*ptr = const_cast<char*>(jobParams(self).data());
+	return static_cast<Py_ssize_t>(jobParams(self).size());
+}
+
+static Py_ssize_t jobParamsCharBuffer(PyObject* self, Py_ssize_t segment, char** ptr)
+{
+	return jobParamsReadBuffer(self, segment, reinterpret_cast<void**>(ptr));
+}
+
+static Py_ssize_t jobParamsSegCount(PyObject* self, Py_ssize_t* size)
+{
+	if (size)
+		*size = static_cast<Py_ssize_t>(jobParams(self).size());
+	return 1;
+}
+
+static int jobParamsGetBuffer(PyObject* self, Py_buffer* view, int flags)
+{
+	const std::string& params = jobParams(self);
+	return PyBuffer_FillInfo(view, self, const_cast<char*>(params.data()), static_cast<Py_ssize_t>(params.size()),
+		1, flags);
+}
+
+static PyBufferProcs gJobParamsBufferProcs = {
+	jobParamsReadBuffer,
+	nullptr,
+	jobParamsSegCount,
+	jobParamsCharBuffer,
+	jobParamsGetBuffer,
+	nullptr
+};
+
+static bool initJobParamsType()
+{
+	gJobParamsType.tp_name = "_py_olly.JobParams";
+	gJobParamsType.tp_basicsize = sizeof(JobParamsObject);
+	gJobParamsType.tp_dealloc = jobParamsDealloc;
+	gJobParamsType.tp_as_buffer = &gJobParamsBufferProcs;
+	gJobParamsType.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER;
+	gJobParamsType.tp_doc = "RPC call parameters of a job";
+	return PyType_Ready(&gJobParamsType) == 0;
+}
+
 static PyObject* setBinaryResult(PyObject*, PyObject* arg)
 {
 	if (!PyTuple_Check(arg))
@@ -244,20 +395,25 @@ static PyObject* setBinaryResult(PyObject*, PyObject* arg)
 
 	if (PyObject_AsCharBuffer(pyBuff, &buff, &size) >= 0 && buff)
 	{
-		auto& cd = Labeless::instance().clientData();
+		// the only copy of the result: the rest of rpc::Response is appended when the job is finished
+		std::string result;
+		result.reserve(static_cast<size_t>(size) + kResponseReserve);
+		putBytesField(result, rpc::Response::kRpcResultFieldNumber, buff, size);
+
+		auto& cd = Labeless::instance().executionData();
 		recursive_lock_guard lock(cd.commandsLock);
 		Request* r = cd.find(jobId);
 		if (r)
-			r->binaryResult = std::string(buff, size);
+			r->result.swap(result);
 		else
 			log_r("Unable to set bynary result, no commands found for jobId: %" PRIu64, jobId);
 	}
 	Py_RETURN_NONE;
 }
 
-static PyObject* get_params(PyObject*, PyObject* arg)
+static bool parseJobId(PyObject* arg, uint64_t& jobId)
 {
-	uint64_t jobId = 0;
+	jobId = 0;
 	if (PyInt_Check(arg))
 	{
 		jobId = static_cast<uint64_t>(PyInt_AsLong(arg));
@@ -271,21 +427,63 @@ static PyObject* get_params(PyObject*, PyObject* arg)
 		if (PyErr_Occurred())
 			PyErr_Print();
 		log_r("Invalid jobId type, should be int or long");
-		Py_RETURN_NONE;
+		return false;
 	}
-	if (!jobId)
+	return jobId != 0;
+}
+
+static PyObject* get_params(PyObject*, PyObject* arg)
+{
+	uint64_t jobId = 0;
+	if (!parseJobId(arg, jobId))
 		Py_RETURN_NONE;
 
-	ClientData& cd = Labeless::instance().clientData();
-	recursive_lock_guard lock(cd.commandsLock);
-	std::string params;
-	for (const Request& r : cd.commands)
+	RequestPtr request;
+	do {
+		ExecutionData& cd = Labeless::instance().executionData();
+		recursive_lock_guard lock(cd.commandsLock);
+		request = cd.acquire(jobId);
+	} while (0);
+	if (!request)
+		Py_RETURN_NONE;
+
+	// the params are not changed after the request is added, so they are read without the lock
+	JobParamsObject* params = PyObject_New(JobParamsObject, &gJobParamsType);
+	if (!params)
+		return nullptr;
+	params->request = new RequestPtr(request);
+	PyObject* rv = PyBuffer_FromObject(reinterpret_cast<PyObject*>(params), 0, Py_END_OF_BUFFER);
+	Py_DECREF(params);
+	return rv;
+}
+
+// [(start, end, remote_start), ...] sent by the client of the job, see rpc::Hello::relocations
+static PyObject* get_relocations(PyObject*, PyObject* arg)
+{
+	uint64_t jobId = 0;
+	if (!parseJobId(arg, jobId))
+		Py_RETURN_NONE;
+
+	RelocationsPtr relocations;
+	do {
+		ExecutionData& cd = Labeless::instance().executionData();
+		recursive_lock_guard lock(cd.commandsLock);
+		if (const Request* r = cd.find(jobId))
+			relocations = r->relocations;
+	} while (0);
+
+	PyObject* rv = PyList_New(0);
+	if (!rv || !relocations)
+		return rv;
+	for (auto it = relocations->begin(); it != relocations->end(); ++it)
 	{
-		if (r.id == jobId)
-			return PyString_FromString(r.params.c_str());
+		PyObject* item = Py_BuildValue("(III)", it->start, it->end, it->remoteStart);
+		if (!item)
+			continue;
+		PyList_Append(rv, item);
+		Py_DECREF(item);
 	}
-
-	Py_RETURN_NONE;
+	return rv;
 }
 
 static PyObject* olly_log(PyObject*, PyObject* arg)
@@ -336,7 +534,7 @@ static PyObject* olly_set_error(PyObject*, PyObject* arg)
 	if (!errorStr)
 		Py_RETURN_NONE;
 
-	auto& cd = Labeless::instance().clientData();
+	auto& cd = Labeless::instance().executionData();
 	recursive_lock_guard lock(cd.commandsLock);
 	Request* r = cd.find(jobId);
 	if (r)
@@ -346,6 +544,104 @@ static PyObject* olly_set_error(PyObject*, PyObject* arg)
 	Py_RETURN_NONE;
 }
 
+static PyObject* sendMemoryChunk(PyObject*, PyObject* arg)
+{
+	PyObject* pyJobId = nullptr;
+	unsigned regionIndex = 0;
+	unsigned offset = 0;
+	PyObject* pyBuff = nullptr;
+	if (!PyArg_ParseTuple(arg, "OIIO", &pyJobId, &regionIndex, &offset, &pyBuff))
+	{
+		if (PyErr_Occurred())
+			PyErr_Print();
+		Py_RETURN_FALSE;
+	}
+
+	uint64_t jobId = 0;
+	if (PyInt_Check(pyJobId))
+	{
+		jobId = static_cast<uint64_t>(PyInt_AsLong(pyJobId));
+	}
+	else if (PyLong_Check(pyJobId))
+	{
+		jobId = PyLong_AsUnsignedLongLong(pyJobId);
+	}
+	else
+	{
+		if (PyErr_Occurred())
+			PyErr_Print();
+		log_r("Invalid jobId type, should be int or long");
+		Py_RETURN_FALSE;
+	}
+
+	Py_ssize_t size = 0;
+	const char* buff = nullptr;
+	if (PyObject_AsCharBuffer(pyBuff, &buff, &size) < 0 || !buff)
+	{
+		if (PyErr_Occurred())
+			PyErr_Print();
+		Py_RETURN_FALSE;
+	}
+
+	Labeless& ll = Labeless::instance();
+	auto& ed = ll.executionData();
+	uint64_t requestId = 0;
+	do {
+		recursive_lock_guard lock(ed.commandsLock);
+		const Request* r = ed.find(jobId);
+		// the client is gone or it can't handle chunks, the caller has to put the data into the result
+		if (!r || !r->streamingAllowed)
+			Py_RETURN_FALSE;
+		requestId = r->requestId;
+	} while (0);
+
+	// serialized rpc::MemoryChunk, the data is copied right into it
+	std::string payload;
+	payload.reserve(static_cast<size_t>(size) + 32);
+	putVarintField(payload, rpc::MemoryChunk::kRequestIdFieldNumber, requestId);
+	putVarintField(payload, rpc::MemoryChunk::kRegionIndexFieldNumber, regionIndex);
+	putVarintField(payload, rpc::MemoryChunk::kOffsetFieldNumber, offset);
+	putBytesField(payload, rpc::MemoryChunk::kDataFieldNumber, buff, size);
+
+	// this is the GUI thread, so don't wait for a client which doesn't read the chunks
+	DWORD lastProgress = GetTickCount();
+	while (true)
+	{
+		HANDLE chunksTakenEvt = nullptr;
+		do {
+			recursive_lock_guard lock(ed.commandsLock);
+			Request* r = ed.find(jobId);
+			// the job is dropped with its client
+			if (!r)
+				Py_RETURN_FALSE;
+			if (ed.queuedChunkBytes < ExecutionData::kMaxQueuedChunkBytes)
+			{
+				r->chunks.push_back(PendingFrame(netframe::FT_MemoryChunk, std::move(payload)));
+				ed.queuedChunkBytes += r->chunks.back().second.size();
+				ll.notifyResultsReady();
+				Py_RETURN_TRUE;
+			}
+			chunksTakenEvt = ed.chunksTakenEvt;
+			if (chunksTakenEvt)
+				ResetEvent(chunksTakenEvt);
+		} while (0);
+
+		if (!chunksTakenEvt)
+			Py_RETURN_FALSE; // the server is stopped
+		// let the server thread drain the queue
+		ll.notifyResultsReady();
+		const DWORD elapsed = GetTickCount() - lastProgress;
+		if (elapsed >= kChunksStallTimeoutMs ||
+			WAIT_OBJECT_0 != WaitForSingleObject(chunksTakenEvt, kChunksStallTimeoutMs - elapsed))
+		{
+			log_r("Memory chunks of job %" PRIu64 " are not sent for %u ms, the rest goes to the result",
+				jobId, kChunksStallTimeoutMs);
+			Py_RETURN_FALSE;
+		}
+		lastProgress = GetTickCount();
+	}
+}
+
 static PyObject* olly_get_ver(PyObject*, PyObject* arg)
 {
 	PyObject* rv = PyString_FromString(LABELESS_VER_STR);
@@ -359,14 +655,124 @@ static PyMethodDef PyOllyMethods [] =
 	{ "std_err_handler", stdErrHandler, METH_O, "stderr handler" },
 	{ "set_binary_result", setBinaryResult, METH_VARARGS, "binary result handler" },
 	{ "get_params", get_params, METH_O, "get RPC call parameters" },
+	{ "get_relocations", get_relocations, METH_O, "get relocation map of the RPC call's client" },
 	{ "olly_log", olly_log, METH_O, "Olly log output" },
 	{ "set_error", olly_set_error, METH_VARARGS, NULL },
+	{ "send_memory_chunk", sendMemoryChunk, METH_VARARGS, "stream a piece of memory region to the client" },
 	{ "labeless_ver", olly_get_ver, METH_NOARGS, "get Labeless version" },
 	{ NULL, NULL, 0, NULL }
 };
 
 static const std::string kExternKeyword = "__extern__";
 
+// LRU cache of the compiled scripts, the fast actions and the IDA side helpers are run over and over.
+// Used by the GUI thread only
+class CompiledScripts
+{
+public:
+	static const size_t kCapacity = 64;
+	static const size_t kMaxScriptSize = 256 * 1024; // bigger ones are hardly repeated, they are compiled each time
+
+	// new reference, nullptr with the Python error set if the script can't be compiled
+	PyObject* get(const std::string& script, int flags)
+	{
+		PyCompilerFlags cf = { flags };
+		if (script.size() > kMaxScriptSize)
+			return Py_CompileStringFlags(script.c_str(), "<string>", Py_file_input, &cf);
+
+		const size_t hash = std::hash<std::string>()(script);
+		const auto it = m_Index.find(hash);
+		if (it != m_Index.end())
+		{
+			const Entries::iterator entry = it->second;
+			if (entry->flags == flags && entry->script == script)
+			{
+				++m_Hits;
+				m_Entries.splice(m_Entries.begin(), m_Entries, entry);
+				Py_INCREF(entry->code);
+				return entry->code;
+			}
+			drop(entry); // the hash collided
+		}
+
+		PyObject* code = Py_CompileStringFlags(script.c_str(), "<string>", Py_file_input, &cf);
+		if (!code)
+			return nullptr;
+		++m_Misses;
+		m_Entries.push_front(Entry());
+		Entry& e = m_Entries.front();
+		e.hash = hash;
+		e.flags = flags;
+		e.script = script;
+		e.code = code;
+		Py_INCREF(code);
+		m_Index[hash] = m_Entries.begin();
+		if (m_Entries.size() > kCapacity)
+			drop(--m_Entries.end());
+		return code;
+	}
+
+	// before Py_Finalize()
+	void clear()
+	{
+		if (m_Hits || m_Misses)
+			log_r("compiled scripts cache: %u hit(s), %u miss(es)", m_Hits, m_Misses);
+		while (!m_Entries.empty())
+			drop(m_Entries.begin());
+		m_Hits = m_Misses = 0;
+	}
+
+private:
+	struct Entry
+	{
+		size_t		hash;
+		int			flags; // PyCompilerFlags::cf_flags
+		std::string	script;
+		PyObject*	code;
+	};
+	typedef std::list<Entry> Entries;
+
+	void drop(Entries::iterator entry)
+	{
+		Py_DECREF(entry->code);
+		m_Index.erase(entry->hash);
+		m_Entries.erase(entry);
+	}
+
+	Entries			m_Entries; // the most recently used first
+	std::unordered_map<size_t, Entries::iterator> m_Index; // by Entry::hash
+	unsigned		m_Hits = 0;
+	unsigned		m_Misses = 0;
+} gCompiledScripts;
+
+static PyObject* runCompiledScript(const std::string& script, PyObject* globals)
+{
+	PyObject* code = gCompiledScripts.get(script, 0);
+	if (!code)
+		return nullptr;
+	PyObject* rv = PyEval_EvalCode(reinterpret_cast<PyCodeObject*>(code), globals, globals);
+	Py_DECREF(code);
+	return rv;
+}
+
+// pyexcore module imported by callRpcDispatcher(), released with the compiled scripts before Py_Finalize()
+static PyObject* gPyExCore = nullptr;
+
+// pyexcore.PyExCore.execute(jobId). The module is imported once, but the method is looked up on every call,
+// so the scripts customizing PyExCore keep working
+static PyObject* callRpcDispatcher(uint64_t jobId)
+{
+	if (!gPyExCore && !(gPyExCore = PyImport_ImportModule("pyexcore")))
+		return nullptr;
+
+	PyObject* cls = PyObject_GetAttrString(gPyExCore, "PyExCore");
+	if (!cls)
+		return nullptr;
+	PyObject* rv = PyObject_CallMethod(cls, "execute", "K", static_cast<unsigned long long>(jobId));
+	Py_DECREF(cls);
+	return rv;
+}
+
 DWORD pyExecExceptionFilter(DWORD code, _EXCEPTION_POINTERS* ep)
 {
 	PyObject* msg = PyString_FromFormat("An exception occurred, code: 0x%x", code);
@@ -375,7 +781,10 @@ DWORD pyExecExceptionFilter(DWORD code, _EXCEPTION_POINTERS* ep)
 	return EXCEPTION_EXECUTE_HANDLER;
 }
 
-static bool safePyRunSimpleString(const std::string& script, const std::string& scriptExternObj, bool& exceptionOccured)
+// runs the script, or dispatches the params of rpcJobId to pyexcore if it's not 0.
+// __extern__ is set from scriptExternMarshal if any, from scriptExternObj JSON otherwise
+static bool safePyRunSimpleString(const std::string& script, const std::string& scriptExternObj,
+	const std::string& scriptExternMarshal, uint64_t rpcJobId, bool& exceptionOccured)
 {
 	bool rv = true;
 	exceptionOccured = false;
@@ -387,7 +796,18 @@ static bool safePyRunSimpleString(const std::string& script, const std::string&
 			return false;
 		PyObject* d = PyModule_GetDict(m);
 
-		if (!scriptExternObj.empty())
+		if (!scriptExternMarshal.empty())
+		{
+			PyObject* result = PyMarshal_ReadObjectFromString(const_cast<char*>(scriptExternMarshal.data()),
+				static_cast<Py_ssize_t>(scriptExternMarshal.size()));
+			if (result)
+				PyDict_SetItemString(d, kExternKeyword.c_str(), result);
+			else
+				PyErr_PrintEx(0);
+			rv = !!result;
+			Py_XDECREF(result);
+		}
+		else if (!scriptExternObj.empty())
 		{
 			PyObject* pyJson = nullptr;
 			PyObject* pyJsonLoads = nullptr;
@@ -422,7 +842,7 @@ static bool safePyRunSimpleString(const std::string& script, const std::string&
 			}
 			Py_XDECREF(pyExternKey);
 		}
-		PyObject* v = PyRun_StringFlags(script.c_str(), Py_file_input, d, d, NULL);
+		PyObject* v = rpcJobId ? callRpcDispatcher(rpcJobId) : runCompiledScript(script, d);
 		if (v == NULL)
 		{
 			PyErr_Print();
@@ -458,46 +878,276 @@ std::string wsaErrorToString()
 	return rv.str();
 }
 
-bool sendAll(SOCKET s, const std::string& buff, std::string& error)
+bool parseMessage(::google::protobuf::Message& msg, const char* data, size_t size)
+{
+	// parse in place, the default 64 MiB limit is too small for big requests
+	static const int kLimit = static_cast<int>(netframe::kMaxPayloadSize);
+
+	::google::protobuf::io::CodedInputStream input(reinterpret_cast<const ::google::protobuf::uint8*>(data),
+		static_cast<int>(size));
+	input.SetTotalBytesLimit(kLimit, kLimit);
+	return msg.ParseFromCodedStream(&input) && input.ConsumedEntireMessage();
+}
+
+// the address in the debuggee of an IDB address, ptrdiff is used out of the relocation ranges
+uint32_t relocate(const Relocations* relocations, uint32_t ea, uint32_t ptrdiff)
 {
-	unsigned total_sent = 0;
-	int sent;
-	while (total_sent < buff.length())
+	if (relocations && !relocations->empty())
 	{
-		if (SOCKET_ERROR == (sent = send(s, buff.c_str() + total_sent, buff.length() - total_sent, 0)))
-		{
-			error = wsaErrorToString().c_str();
-			return false;
-		}
-		total_sent += static_cast<unsigned>(sent);
+		auto it = std::upper_bound(relocations->begin(), relocations->end(), ea, [](uint32_t v, const Relocation& r) {
+			return v < r.start;
+		});
+		if (it != relocations->begin() && ea < (--it)->end)
+			return ea - it->start + it->remoteStart;
 	}
-	const auto rv = total_sent == buff.size();
-	if (!rv)
-		error = "Sent bytes number differs from buffer length";
-	return rv;
+	return ea + ptrdiff;
+}
+
+// QueryPerformanceCounter() value, 0 if it's unavailable
+int64_t performanceCounter()
+{
+	LARGE_INTEGER now = {};
+	return QueryPerformanceCounter(&now) ? now.QuadPart : 0;
+}
+
+void queueChunks(ClientData& cd, std::deque<PendingFrame>& chunks)
+{
+	for (; !chunks.empty(); chunks.pop_front())
+		cd.queue(chunks.front().first, chunks.front().second);
+}
+
+// false if the connection is to be dropped: it is broken or a legacy client has got its response
+bool flushOutput(ClientData& cd)
+{
+	std::string error;
+	if (!cd.flush(error))
+	{
+		server_log("%s: send() failed, error: %s", __FUNCTION__, error.c_str());
+		return false;
+	}
+	return !cd.closeWhenSent || !cd.outQueue.empty();
 }
 
 } // anonymous
 
-Request* ClientData::find(uint64_t jobId)
+Request* ExecutionData::find(uint64_t jobId)
+{
+	const auto it = jobs.find(jobId);
+	return it != jobs.end() ? it->second.get() : nullptr;
+}
+
+RequestPtr ExecutionData::acquire(uint64_t jobId)
+{
+	const auto it = jobs.find(jobId);
+	return it != jobs.end() ? it->second : RequestPtr();
+}
+
+void ExecutionData::add(const RequestPtr& r)
 {
-	for (unsigned i = 0, e = commands.size(); i < e; ++i)
-		if (commands[i].id == jobId)
-			return &commands[i];
-	return nullptr;
+	jobs[r->id] = r;
+	clientJobs[r->clientId].push_back(r->id);
+}
+
+bool ExecutionData::remove(uint64_t jobId)
+{
+	const auto it = jobs.find(jobId);
+	if (it == jobs.end())
+		return false;
+
+	const auto ids = clientJobs.find(it->second->clientId);
+	if (ids != clientJobs.end())
+	{
+		ids->second.erase(std::remove(ids->second.begin(), ids->second.end(), jobId), ids->second.end());
+		if (ids->second.empty())
+			clientJobs.erase(ids);
+	}
+	std::deque<PendingFrame> dropped;
+	takeChunks(*it->second, dropped);
+	jobs.erase(it);
+	return true;
 }
 
-bool ClientData::remove(uint64_t jobId)
+size_t ExecutionData::expireJobs(int64_t finishedBefore)
 {
-	for (auto it = commands.cbegin(), end = commands.cend(); it != end; ++it)
+	// foreground jobs are removed once sent or with their connection, only the background ones may be forgotten
+	std::vector<uint64_t> expired;
+	for (auto it = jobs.cbegin(), end = jobs.cend(); it != end; ++it)
 	{
-		if (it->id == jobId)
+		const Request& r = *it->second;
+		if (r.background && r.finishedAt && r.finishedAt < finishedBefore)
+			expired.push_back(r.id);
+	}
+	for (auto it = expired.cbegin(), end = expired.cend(); it != end; ++it)
+		remove(*it);
+	return expired.size();
+}
+
+bool ExecutionData::popNextPendingJob(uint64_t& jobId)
+{
+	if (pendingJobs.empty())
+		return false;
+
+	// round-robin over the connections, so a big job list of one client doesn't block the others
+	auto it = pendingJobs.upper_bound(lastScheduledClientId);
+	if (it == pendingJobs.end())
+		it = pendingJobs.begin();
+
+	lastScheduledClientId = it->first;
+	jobId = it->second.front();
+	it->second.pop_front();
+	if (it->second.empty())
+		pendingJobs.erase(it);
+	return true;
+}
+
+void ExecutionData::dropClientRequests(uint64_t clientId)
+{
+	pendingJobs.erase(clientId);
+
+	const auto ids = clientJobs.find(clientId);
+	if (ids == clientJobs.end())
+		return;
+	// nobody is waiting for the results of the foreground requests anymore
+	std::vector<uint64_t> dropped;
+	for (auto it = ids->second.cbegin(), end = ids->second.cend(); it != end; ++it)
+	{
+		const Request* r = find(*it);
+		if (r && !r->background)
+			dropped.push_back(*it);
+	}
+	for (auto it = dropped.cbegin(), end = dropped.cend(); it != end; ++it)
+		remove(*it);
+}
+
+void ExecutionData::takeChunks(Request& r, std::deque<PendingFrame>& out)
+{
+	if (r.chunks.empty())
+		return;
+	for (auto it = r.chunks.begin(), end = r.chunks.end(); it != end; ++it)
+	{
+		queuedChunkBytes -= it->second.size();
+		out.push_back(std::move(*it));
+	}
+	r.chunks.clear();
+	if (chunksTakenEvt)
+		SetEvent(chunksTakenEvt);
+}
+
+void ClientData::queue(netframe::FrameType type, std::string& payload)
+{
+	bytesOut += payload.size();
+	std::string packed;
+	const bool isPacked = compression::pack(compression::Codec(codec), payload, packed);
+	if (isPacked)
+		payload.swap(packed);
+	bytesOutPacked += payload.size();
+
+	netframe::Header h = netframe::makeHeader(type, static_cast<uint32_t>(payload.size()), protocolVersion);
+	h.codec = isPacked ? codec : compression::CODEC_None;
+	queueRaw(payload);
+	outQueue.back().head.assign(reinterpret_cast<const char*>(&h), sizeof(h));
+	outQueueBytes += sizeof(h);
+}
+
+void ClientData::queueRaw(std::string& payload)
+{
+	// not moved, VS2013 doesn't generate move constructors
+	outQueue.push_back(OutgoingBuffer());
+	outQueue.back().payload.swap(payload);
+	outQueueBytes += outQueue.back().payload.size();
+}
+
+bool ClientData::flush(std::string& error)
+{
+	while (!outQueue.empty())
+	{
+		OutgoingBuffer& b = outQueue.front();
+		const size_t total = b.head.size() + b.payload.size();
+		WSABUF wb[2] = {};
+		DWORD count = 0;
+		if (b.sent < b.head.size())
 		{
-			commands.erase(it);
-			return true;
+			wb[count].len = static_cast<ULONG>(b.head.size() - b.sent);
+			wb[count++].buf = &b.head[b.sent];
+		}
+		const size_t payloadSent = b.sent > b.head.size() ? b.sent - b.head.size() : 0;
+		if (payloadSent < b.payload.size())
+		{
+			wb[count].len = static_cast<ULONG>(b.payload.size() - payloadSent);
+			wb[count++].buf = &b.payload[payloadSent];
 		}
+
+		DWORD sent = 0;
+		if (count && SOCKET_ERROR == WSASend(s, wb, count, &sent, 0, nullptr, nullptr))
+		{
+			if (WSAGetLastError() == WSAEWOULDBLOCK)
+				return true; // FD_WRITE is signaled once the socket takes more
+			error = wsaErrorToString();
+			return false;
+		}
+		b.sent += sent;
+		if (b.sent < total)
+			continue;
+		outQueueBytes -= total;
+		outQueue.pop_front();
 	}
-	return false;
+	return true;
+}
+
+bool ClientData::reserveNetBuff(size_t size)
+{
+	return recvbuffer::resize(netBuff, size, netBuffStats);
+}
+
+void ClientData::releaseNetBuffers()
+{
+	netBuffReceived = 0;
+	// keep the usual request size allocated, but don't hold the memory of a huge one
+	recvbuffer::release(netBuff);
+	recvbuffer::release(unpackBuff);
+}
+
+void ClientData::resetNetState()
+{
+	mode = CM_Unknown;
+	protocolVersion = 0;
+	codec = compression::CODEC_None;
+	bytesOut = 0;
+	bytesOutPacked = 0;
+	netBuffStats = recvbuffer::Stats();
+	frameHeaderReceived = 0;
+	requestsServed = 0;
+	std::fill(latencyHistogram, latencyHistogram + kLatencyBuckets, 0);
+	outQueue.clear();
+	outQueueBytes = 0;
+	closeWhenSent = false;
+	std::string().swap(netBuff);
+	std::string().swap(unpackBuff);
+	netBuffReceived = 0;
+}
+
+void ClientData::onResponseSent(const Request& r)
+{
+	++requestsServed;
+
+	LARGE_INTEGER now = {};
+	LARGE_INTEGER freq = {};
+	if (!r.receivedAt || !QueryPerformanceCounter(&now) || !QueryPerformanceFrequency(&freq) || !freq.QuadPart)
+		return;
+	const int64_t us = (now.QuadPart - r.receivedAt) * 1000000 / freq.QuadPart;
+	unsigned bucket = 0;
+	for (int64_t limit = 1000; bucket < kLatencyBuckets - 1 && us >= limit; limit *= 10)
+		++bucket;
+	++latencyHistogram[bucket];
+}
+
+std::string ClientData::latencyHistogramToString() const
+{
+	static const char* const kBucketNames[kLatencyBuckets] = { "<1ms", "<10ms", "<100ms", "<1s", ">=1s" };
+	std::stringstream rv;
+	for (unsigned i = 0; i < kLatencyBuckets; ++i)
+		rv << (i ? ", " : "") << kBucketNames[i] << ": " << latencyHistogram[i];
+	return rv.str();
 }
 
 std::atomic_bool Labeless::m_ServerEnabled;
@@ -507,8 +1157,11 @@ Labeless::Labeless()
 	, m_Port(defaultPort())
 	//, m_HelperWnd(nullptr)
 	, m_LogList(nullptr)
+	, m_ResultsReadyEvt(WSA_INVALID_EVENT)
 {
 	__asm __volatile finit; // Stupid Olly's bug fix
+	m_NativeSync = true;
+	m_MaxOutputSize = kDefaultMaxOutputSize;
 }
 
 Labeless& Labeless::instance()
@@ -580,6 +1233,11 @@ bool Labeless::initPython()
 #endif // ENABLE_PYTHON_ZIP
 
 	Py_InitModule("_py_olly", PyOllyMethods);
+	if (!initJobParamsType())
+	{
+		Addtolist(0, -1, "  Could not initialize _py_olly.JobParams type");
+		return false;
+	}
 	PyRun_SimpleString("import site");
 
 	init_ollyapi();
@@ -596,7 +1254,7 @@ bool Labeless::initPython()
 			PyErr_Fetch(nullptr, nullptr, &ptTB);
 			pyTraceback_AsString(ptTB, error);
 		}
-		if (!clientData().stdErr.str().empty() || !clientData().stdOut.str().empty())
+		if (!executionData().stdErr.str().empty() || !executionData().stdOut.str().empty())
 		{
 #ifdef LABELESS_ADDITIONAL_LOGGING
 			std::ofstream of("c:\\labeless.log", std::ios_base::app);
@@ -606,8 +1264,8 @@ bool Labeless::initPython()
 				_strdate_s(buff, 128);
 				of << "\r\n" << std::string(buff);
 				_strtime_s(buff, 128);
-				of << " " << std::string(buff) << " FAILED TO INIT PYTHON, STDERR: " << clientData().stdErr.str() << std::endl
-					<< "STDOUT:" << clientData().stdOut.str();
+				of << " " << std::string(buff) << " FAILED TO INIT PYTHON, STDERR: " << executionData().stdErr.str() << std::endl
+					<< "STDOUT:" << executionData().stdOut.str();
 				of << "\nTraceBack:\n" << error;
 				of.close();
 			}
@@ -623,6 +1281,9 @@ bool Labeless::initPython()
 
 void Labeless::destroyPython()
 {
+	gCompiledScripts.clear();
+	Py_XDECREF(gPyExCore);
+	gPyExCore = nullptr;
 	Py_Finalize();
 }
 
@@ -717,6 +1378,14 @@ void Labeless::stopServer()
 	if (m_Thread->joinable())
 		m_Thread->join();
 	m_Thread.reset();
+	if (WSA_INVALID_EVENT != m_ResultsReadyEvt)
+		WSACloseEvent(m_ResultsReadyEvt);
+	m_ResultsReadyEvt = WSA_INVALID_EVENT;
+
+	recursive_lock_guard commandsLock(m_Rpc.commandsLock);
+	if (m_Rpc.chunksTakenEvt)
+		CloseHandle(m_Rpc.chunksTakenEvt);
+	m_Rpc.chunksTakenEvt = nullptr;
 }
 
 bool Labeless::startServer()
@@ -728,6 +1397,13 @@ bool Labeless::startServer()
 	recursive_lock_guard lock(m_ThreadLock);
 	if (m_Thread)
 		return true;
+	if (WSA_INVALID_EVENT == m_ResultsReadyEvt)
+		m_ResultsReadyEvt = WSACreateEvent();
+	do {
+		recursive_lock_guard commandsLock(m_Rpc.commandsLock);
+		if (!m_Rpc.chunksTakenEvt)
+			m_Rpc.chunksTakenEvt = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+	} while (0);
 	m_Thread.reset(new std::thread(Labeless::serverThread, this));
 
 	log_r("Server thread started.");
@@ -786,12 +1462,17 @@ void WINAPI Labeless::serverThread(Labeless* ll)
 		wsaInitialized = true;
 	}
 
-	ClientData& client = ll->clientData();
+	// evts[0]: listening socket, evts[1]: results are ready (set by the GUI thread), evts[2...]: client sockets
+	enum { kListenIdx, kResultsIdx, kFirstClientIdx };
+	static const size_t kMaxClients = WSA_MAXIMUM_WAIT_EVENTS - kFirstClientIdx;
+	static const int64_t kJobsSweepIntervalSec = 60;
 
-	SOCKET sockets[2] { INVALID_SOCKET, INVALID_SOCKET };
+	std::vector<ClientDataPtr> clients;
+	uint64_t lastClientId = 0;
+	SOCKET listenSock = INVALID_SOCKET;
 	WORD wPort = ll->m_Port;
 
-	if (!bindAndListenSock(sockets[0], wPort))
+	if (!bindAndListenSock(listenSock, wPort))
 	{
 		server_log("Unable to start server");
 		return;
@@ -804,88 +1485,202 @@ void WINAPI Labeless::serverThread(Labeless* ll)
 		PostMessage(gConfig.helperWnd, gConfig.hlpPortChanged, 0, 0);
 	}
 
-	WSAEVENT evts[2] = {};
-	evts[0] = WSACreateEvent();
-	WSAEventSelect(sockets[0], evts[0], FD_ACCEPT | FD_CLOSE);
-	DWORD actualClients = 1;
+	const WSAEVENT listenEvt = WSACreateEvent();
+	WSAEventSelect(listenSock, listenEvt, FD_ACCEPT | FD_CLOSE);
+
+	auto dropClient = [&](size_t idx) {
+		ClientDataPtr cd = clients[idx];
+		clients.erase(clients.begin() + idx);
+		if (!ll->onClientSockClose(*cd))
+			server_log("onClientSockClose() failed.");
+		WSACloseEvent(cd->evt);
+		server_log("%u client(s) connected", unsigned(clients.size()));
+	};
+	auto isSignaled = [](WSAEVENT evt) {
+		return WAIT_OBJECT_0 == WaitForSingleObject(evt, 0);
+	};
+
+	LARGE_INTEGER freq = {};
+	QueryPerformanceFrequency(&freq);
+	int64_t lastJobsSweep = performanceCounter();
+
+	WSAEVENT evts[WSA_MAXIMUM_WAIT_EVENTS] = {};
 	while (Labeless::m_ServerEnabled)
 	{
-		DWORD index = WSAWaitForMultipleEvents(actualClients, evts, FALSE, 1000, FALSE);
+		const int64_t now = performanceCounter();
+		if (freq.QuadPart && now - lastJobsSweep >= kJobsSweepIntervalSec * freq.QuadPart)
+		{
+			lastJobsSweep = now;
+			ExecutionData& ed = ll->executionData();
+			recursive_lock_guard lock(ed.commandsLock);
+			if (const size_t expired = ed.expireJobs(now - ExecutionData::kFinishedJobTtlSec * freq.QuadPart))
+				server_log("%u finished background job(s) expired, %u job(s) left", unsigned(expired), unsigned(ed.jobs.size()));
+		}
+
+		evts[kListenIdx] = listenEvt;
+		evts[kResultsIdx] = ll->m_ResultsReadyEvt;
+		for (size_t i = 0; i < clients.size(); ++i)
+			evts[kFirstClientIdx + i] = clients[i]->evt;
+
+		// the timeout is only needed to notice m_ServerEnabled change
+		DWORD index = WSAWaitForMultipleEvents(DWORD(kFirstClientIdx + clients.size()), evts, FALSE, 1000, FALSE);
 		index -= WSA_WAIT_EVENT_0;
 		if (WSA_WAIT_FAILED == index || WSA_WAIT_TIMEOUT == index)
+			continue;
+
+		// WSAWaitForMultipleEvents() reports the lowest signaled index only,
+		// so check every event to not let the first clients starve the others
+		if (isSignaled(ll->m_ResultsReadyEvt))
 		{
-			// look for command result
-			if (client.s != INVALID_SOCKET)
+			WSAResetEvent(ll->m_ResultsReadyEvt);
+			// look for command results, the requests keep arriving while the previous ones are executed
+			for (size_t i = clients.size(); i-- > 0; )
 			{
-				recursive_lock_guard lock(client.commandsLock);
-				if (!client.commands.empty() && client.commands.back().finished)
-				{
-					std::string sendError;
-					if (!sendAll(client.s, client.commands.back().result, sendError))
-						server_log("%s: send() failed, error: %s", __FUNCTION__, sendError.c_str());
-					closesocket(client.s);
-
-					server_log("%s: jobId %" PRIu64 " socket %08X Response sent, len: 0x%08X", __FUNCTION__,
-						client.commands.back().id, unsigned(client.s), client.commands.back().result.length());
-					client.s = INVALID_SOCKET;
-					if (!client.commands.back().background)
-					{
-						server_log("%s: jobId %" PRIu64 " is removed", __FUNCTION__, client.commands.back().id);
-						client.commands.pop_back();
-					}
-					else
-					{
-						client.commands.back().finished = false;
-						client.commands.back().result.clear();
-					}
-
-					actualClients = 1;
-					WSACloseEvent(evts[1]);
-					evts[1] = 0;
-				}
+				if (!sendFinishedResults(*clients[i]))
+					dropClient(i);
 			}
-			continue;
 		}
+
+		for (size_t i = clients.size(); i-- > 0; )
+		{
+			ClientData& cd = *clients[i];
+			if (!isSignaled(cd.evt))
+				continue;
+			WSANETWORKEVENTS e = {};
+			if (SOCKET_ERROR == WSAEnumNetworkEvents(cd.s, cd.evt, &e))
+				continue;
+			if ((e.lNetworkEvents & FD_READ) && e.iErrorCode[FD_READ_BIT] == 0 && !ll->onClientSockRead(cd))
+			{
+				// the header and the buffer are left mid-frame, every next byte would be parsed as garbage
+				server_log("onClientSockRead() failed, socket %08X dropped", unsigned(cd.s));
+				dropClient(i);
+				continue;
+			}
+			// the queue is drained, so the results held back for it go now
+			if ((e.lNetworkEvents & FD_WRITE) && e.iErrorCode[FD_WRITE_BIT] == 0 &&
+				(!flushOutput(cd) || !sendFinishedResults(cd)))
+			{
+				dropClient(i);
+				continue;
+			}
+			if (e.lNetworkEvents & FD_CLOSE)
+				dropClient(i);
+		}
+
+		if (!isSignaled(listenEvt))
+			continue;
 		WSANETWORKEVENTS e = {};
-		if (SOCKET_ERROR == WSAEnumNetworkEvents(sockets[index], evts[index], &e))
+		if (SOCKET_ERROR == WSAEnumNetworkEvents(listenSock, listenEvt, &e))
 			continue;
 		if ((e.lNetworkEvents & FD_ACCEPT) && e.iErrorCode[FD_ACCEPT_BIT] == 0)
 		{
-			if (!ll->onClientSockAccept(sockets[index], client))
+			auto cd = std::make_shared<ClientData>();
+			cd->id = ++lastClientId;
+			if (!ll->onClientSockAccept(listenSock, *cd))
+			{
 				server_log("onClientSockAccept() failed.");
-			else
+				continue;
+			}
+			if (clients.size() >= kMaxClients)
 			{
-				evts[1] = WSACreateEvent();
-				if (actualClients == 1)
-					actualClients = 2;
-				sockets[1] = client.s;
-				WSAEventSelect(client.s, evts[1], FD_READ | FD_CLOSE);
-				server_log("socket %08X accepted", unsigned(client.s));
+				server_log("socket %08X rejected, too many clients connected", unsigned(cd->s));
+				closesocket(cd->s);
+				continue;
 			}
+			cd->evt = WSACreateEvent();
+			WSAEventSelect(cd->s, cd->evt, FD_READ | FD_WRITE | FD_CLOSE);
+			clients.push_back(cd);
+			server_log("socket %08X accepted, %u client(s) connected", unsigned(cd->s), unsigned(clients.size()));
 		}
-		else if ((e.lNetworkEvents & FD_READ) && e.iErrorCode[FD_READ_BIT] == 0)
+	}
+	while (!clients.empty())
+		dropClient(clients.size() - 1);
+	if (listenEvt)
+		WSACloseEvent(listenEvt);
+	if (listenSock != INVALID_SOCKET)
+		closesocket(listenSock);
+	server_log("server thread is down");
+}
+
+bool Labeless::sendFinishedResults(ClientData& cd)
+{
+	ExecutionData& ed = Labeless::instance().executionData();
+
+	// a slow peer leaves the results in its jobs until FD_WRITE, so the producer of the chunks waits for it
+	if (cd.closeWhenSent || !cd.canQueue())
+		return true;
+
+	// stream the chunks of the running requests without holding the lock, the GUI thread keeps producing them
+	std::deque<PendingFrame> chunks;
+	do {
+		recursive_lock_guard lock(ed.commandsLock);
+		const auto ids = ed.clientJobs.find(cd.id);
+		if (ids == ed.clientJobs.end())
+			return true;
+		for (auto it = ids->second.cbegin(); it != ids->second.cend(); ++it)
 		{
-			if (!ll->onClientSockRead(client))
-				server_log("onClientSockRead() failed.");
+			if (Request* r = ed.find(*it))
+				ed.takeChunks(*r, chunks);
 		}
-		else if ((e.lNetworkEvents & FD_CLOSE) && e.iErrorCode[FD_CLOSE_BIT] == 0 && index == 1)
+	} while (0);
+	queueChunks(cd, chunks);
+
+	recursive_lock_guard lock(ed.commandsLock);
+	// several requests may be in flight, send every finished one in the order they were received
+	const auto ids = ed.clientJobs.find(cd.id);
+	if (ids == ed.clientJobs.end())
+		return flushOutput(cd);
+	bool keepConnection = true;
+	std::vector<uint64_t> sent;
+	for (auto it = ids->second.cbegin(); it != ids->second.cend(); ++it)
+	{
+		Request* const r = ed.find(*it);
+		if (!r || !r->finished)
+			continue;
+		if (!cd.canQueue())
+		{
+			// a queue left over the limit waits for FD_WRITE, which comes with the rest of the results
+			keepConnection = flushOutput(cd);
+			if (!keepConnection || !cd.canQueue())
+				break;
+		}
+		// chunks queued after the first pass must precede the response
+		ed.takeChunks(*r, chunks);
+		queueChunks(cd, chunks);
+		const size_t resultSize = r->result.length();
+		queueResponse(cd, r->result);
+		cd.onResponseSent(*r);
+
+		server_log("%s: jobId %" PRIu64 " socket %08X Response queued, len: 0x%08X", __FUNCTION__,
+			r->id, unsigned(cd.s), unsigned(resultSize));
+		if (!r->background)
+		{
+			server_log("%s: jobId %" PRIu64 " is removed", __FUNCTION__, r->id);
+			sent.push_back(r->id);
+		}
+		else
 		{
-			if (!ll->onClientSockClose(client))
-				server_log("onClientSockClose() failed.");
+			r->finished = false;
+			std::string().swap(r->result);
+		}
+
+		// framed clients keep the connection open for the next requests
+		if (cd.mode != ClientData::CM_Framed)
+		{
+			cd.closeWhenSent = true;
+			break;
 		}
 	}
-	if (evts[1])
-		WSACloseEvent(evts[1]);
-	if (evts[0])
-		WSACloseEvent(evts[0]);
-	if (client.s != INVALID_SOCKET)
-		closesocket(client.s);
-	if (sockets[1] != INVALID_SOCKET)
-		closesocket(sockets[1]);
-	if (sockets[0] != INVALID_SOCKET)
-		closesocket(sockets[0]);
-	client.s = INVALID_SOCKET;
-	server_log("server thread is down");
+	// not while iterating, remove() changes ids
+	for (auto it = sent.cbegin(); it != sent.cend(); ++it)
+		ed.remove(*it);
+	return keepConnection && flushOutput(cd);
+}
+
+void Labeless::notifyResultsReady()
+{
+	if (WSA_INVALID_EVENT != m_ResultsReadyEvt)
+		WSASetEvent(m_ResultsReadyEvt);
 }
 
 LRESULT CALLBACK Labeless::helperWinProc(HWND hw, UINT msg, WPARAM wp, LPARAM lp)
@@ -905,8 +1700,7 @@ LRESULT CALLBACK Labeless::helperWinProc(HWND hw, UINT msg, WPARAM wp, LPARAM lp
 	}
 	if (msg == gConfig.hlpCommandReceived)
 	{
-		ClientData& cd = ll.clientData();
-		if (!ll.onCommandReceived(cd))
+		if (!ll.onCommandReceived(ll.executionData()))
 			log_r("onCommandReceived() failed.");
 
 		return 0;
@@ -926,10 +1720,11 @@ LRESULT CALLBACK Labeless::helperWinProc(HWND hw, UINT msg, WPARAM wp, LPARAM lp
 	return 0;
 }
 
-bool Labeless::onCommandReceived(const std::string& command, const std::string& scriptExternObj)
+bool Labeless::onCommandReceived(const Request& request)
 {
 	bool hasException = false;
-	const bool rv = safePyRunSimpleString(command, scriptExternObj, hasException);
+	const bool rv = safePyRunSimpleString(request.script, request.scriptExternObj, request.scriptExternMarshal,
+		request.rpc ? request.id : 0, hasException);
 	if (!rv)
 	{
 		log_r("safePyRunSimpleString() failed. With exception: %u", int(hasException));
@@ -957,39 +1752,52 @@ bool Labeless::onCommandReceived(const std::string& command, const std::string&
 	return pType == nullptr;*/
 }
 
-bool Labeless::onCommandReceived(ClientData& cd)
+bool Labeless::onCommandReceived(ExecutionData& ed)
 {
 	rpc::Response response;
-	Request request;
+	uint64_t jobId = 0;
+	// the script and the params are not changed after the request is added, so they are read without the lock
+	RequestPtr request;
 	try
 	{
 		do {
-			recursive_lock_guard lock(cd.commandsLock);
-			if (cd.commands.empty())
+			recursive_lock_guard lock(ed.commandsLock);
+			if (!ed.popNextPendingJob(jobId))
+				return true; // the client was disconnected, its requests are dropped
+			request = ed.acquire(jobId);
+			if (!request)
+			{
+				log_r("Unable to find request for job id: %" PRIu64, jobId);
 				return false;
-			request = cd.commands.back();
+			}
 		} while (0);
-		response.set_job_id(request.id);
+		response.set_job_id(jobId);
+		if (request->requestId)
+			response.set_request_id(request->requestId);
 
-		cd.stdOut.str("");
-		cd.stdOut.clear();
-		cd.stdErr.str("");
-		cd.stdErr.clear();
+		ed.runningJob = request;
 
-		if (!onCommandReceived(request.script, request.scriptExternObj))
+		bool handled = false;
+		std::string nativeResult;
+		std::string nativeError;
+		if (request->native && !applyRpcRequestNatively(*request, handled, nativeResult, nativeError))
+			response.set_error(nativeError);
+
+		if (!handled && !onCommandReceived(*request))
 		{
 			log_r("An error occured");
 			response.set_error("An error occurred");
 		}
-		response.set_std_out(cd.stdOut.str());
-		response.set_std_err(cd.stdErr.str());
+		ed.runningJob.reset();
+		takeOutput(request->stdOut, *response.mutable_std_out());
+		takeOutput(request->stdErr, *response.mutable_std_err());
 
 		do {
-			recursive_lock_guard lock(cd.commandsLock);
-			Request* const pReq = cd.find(request.id);
+			recursive_lock_guard lock(ed.commandsLock);
+			Request* const pReq = ed.find(jobId);
 			if (!pReq)
 			{
-				log_r("Unable to find request for job id: %" PRIu64, request.id);
+				log_r("Unable to find request for job id: %" PRIu64, jobId);
 				return false;
 			}
 			if (!pReq->error.empty())
@@ -998,10 +1806,13 @@ bool Labeless::onCommandReceived(ClientData& cd)
 					pReq->error = response.error() + "\r\n" + pReq->error;
 				response.set_error(pReq->error);
 			}
-			response.set_rpc_result(pReq->binaryResult);
+			// pReq->result already holds rpc_result if the script has called set_binary_result()
+			if (handled)
+				putBytesField(pReq->result, rpc::Response::kRpcResultFieldNumber, nativeResult.data(), nativeResult.size());
 			response.set_job_status(rpc::Response::JS_FINISHED);
-			pReq->result = response.SerializeAsString();
+			response.AppendToString(&pReq->result);
 			pReq->finished = true;
+			pReq->finishedAt = performanceCounter();
 		} while (0);
 	}
 	catch (...)
@@ -1009,23 +1820,154 @@ bool Labeless::onCommandReceived(ClientData& cd)
 		log_r("exception occured");
 
 		response.set_error("Labeless::onCommandReceived() thrown an exception");
-		response.set_std_out(cd.stdOut.str());
-		response.set_std_err(cd.stdErr.str());
+		ed.runningJob.reset();
+		if (request)
+		{
+			takeOutput(request->stdOut, *response.mutable_std_out());
+			takeOutput(request->stdErr, *response.mutable_std_err());
+		}
 
 		do {
-			recursive_lock_guard lock(cd.commandsLock);
-			Request* const pReq = cd.find(request.id);
+			recursive_lock_guard lock(ed.commandsLock);
+			Request* const pReq = ed.find(jobId);
 			if (!pReq)
 			{
-				log_r("Unable to find request for job id: %" PRIu64, request.id);
+				log_r("Unable to find request for job id: %" PRIu64, jobId);
 				return false;
 			}
-			response.set_rpc_result(pReq->binaryResult);
 			response.set_job_status(rpc::Response::JS_FINISHED);
-			pReq->result = response.SerializeAsString();
+			response.AppendToString(&pReq->result);
 			pReq->finished = true;
+			pReq->finishedAt = performanceCounter();
 		} while (0);
 	}
+	notifyResultsReady();
+	return true;
+}
+
+bool Labeless::applyRpcRequestNatively(const Request& request, bool& handled, std::string& result, std::string& error)
+{
+	handled = false;
+	rpc::RpcRequest rpcRequest;
+	if (!parseMessage(rpcRequest, request.params.data(), request.params.size()))
+		return true; // pyexcore reports it
+	if (rpcRequest.request_type() == rpc::RpcRequest::RPCT_GET_NAMES && rpcRequest.has_get_names_req())
+	{
+		handled = true;
+		return getNames(rpcRequest.get_names_req(), result, error);
+	}
+
+	// the same as ollyutils.make_names() and make_comments(), but without a Python/SWIG call per name
+	int type = 0;
+	uint32_t ptrdiff = 0;
+	const ::google::protobuf::RepeatedPtrField<rpc::MakeNamesRequest::Name>* names = nullptr;
+	const ::google::protobuf::RepeatedPtrField<rpc::MakeCommentsRequest::Name>* comments = nullptr;
+	const rpc::PackedNames* packed = nullptr;
+	switch (rpcRequest.request_type())
+	{
+	case rpc::RpcRequest::RPCT_MAKE_NAMES:
+		if (!rpcRequest.has_make_names_req())
+			return true;
+		type = NM_LABEL;
+		ptrdiff = rpcRequest.make_names_req().remote_base() - rpcRequest.make_names_req().base();
+		names = &rpcRequest.make_names_req().names();
+		if (rpcRequest.make_names_req().has_packed_names())
+			packed = &rpcRequest.make_names_req().packed_names();
+		break;
+	case rpc::RpcRequest::RPCT_MAKE_COMMENTS:
+		if (!rpcRequest.has_make_comments_req())
+			return true;
+		type = NM_COMMENT;
+		ptrdiff = rpcRequest.make_comments_req().remote_base() - rpcRequest.make_comments_req().base();
+		comments = &rpcRequest.make_comments_req().names();
+		if (rpcRequest.make_comments_req().has_packed_names())
+			packed = &rpcRequest.make_comments_req().packed_names();
+		break;
+	default:
+		return true;
+	}
+	handled = true;
+
+	unsigned total = 0;
+	unsigned failed = 0;
+	const auto insert = [&](uint32_t ea, const std::string& name) {
+		char buff[TEXTLEN] = {};
+		strncpy_s(buff, name.c_str(), _TRUNCATE);
+		++total;
+		if (Insertname(relocate(request.relocations.get(), ea, ptrdiff), type, buff) != 0)
+			++failed;
+	};
+	bool malformed = false;
+	if (packed)
+	{
+		malformed = !packednames::forEach(*packed, insert);
+	}
+	else if (names)
+	{
+		for (auto it = names->begin(); it != names->end(); ++it)
+			insert(it->ea(), it->name());
+	}
+	else
+	{
+		for (auto it = comments->begin(); it != comments->end(); ++it)
+			insert(it->ea(), it->name());
+	}
+	Redrawdisassembler();
+
+	if (!failed && !malformed)
+		return true;
+	char buff[TEXTLEN] = {};
+	if (malformed)
+		_snprintf_s(buff, _countof(buff), _TRUNCATE, "Malformed packed names, %u item(s) applied", total - failed);
+	else
+		_snprintf_s(buff, _countof(buff), _TRUNCATE, "Insertname() failed for %u of %u item(s)", failed, total);
+	error = buff;
+	log_r("%s", buff);
+	return false;
+}
+
+bool Labeless::getNames(const rpc::GetNamesRequest& req, std::string& result, std::string& error)
+{
+	// the same as ollyutils.get_names(): a single pass over Olly's sorted names table per type
+	const uint32_t toRemote = req.remote_base() - req.base();
+	const ulong start = req.start() + toRemote;
+	const ulong end = req.end() + toRemote;
+
+	std::map<ulong, std::pair<std::string, std::string>> names; // remote ea -> label, comment
+	const auto collect = [&](int type, bool comment) {
+		char buff[TEXTLEN] = {};
+		ulong addr = start;
+		if (Findname(addr, type, buff) <= 0)
+			addr = Findnextname(buff);
+		for (; addr && addr >= start && addr < end; addr = Findnextname(buff))
+		{
+			auto& v = names[addr];
+			(comment ? v.second : v.first) = buff;
+		}
+	};
+	if (req.labels())
+		collect(NM_LABEL, false);
+	if (req.comments())
+		collect(NM_COMMENT, true);
+
+	rpc::GetNamesResult rv;
+	uint32_t prev = req.start();
+	for (auto it = names.cbegin(); it != names.cend(); ++it)
+	{
+		const uint32_t ea = it->first - toRemote;
+		auto n = rv.add_names();
+		n->set_ea_delta(ea - prev);
+		if (!it->second.first.empty())
+			n->set_label(it->second.first);
+		if (!it->second.second.empty())
+			n->set_comment(it->second.second);
+		prev = ea;
+	}
+	if (!rv.SerializeToString(&result))
+	{
+		error = "Unable to serialize rpc::GetNamesResult";
+		return false;
+	}
 	return true;
 }
 
@@ -1088,18 +2030,14 @@ bool Labeless::onClientSockAccept(SOCKET sock, ClientData& cd)
 		server_log("%s: WSAIoctl(SIO_KEEPALIVE_VALS) failed. LE: %08X\n", __FUNCTION__, WSAGetLastError());
 		return false;
 	}
-	if (INVALID_SOCKET != cd.s)
-	{
-		server_log("%s: cd.s has valid socket %08X, closing", __FUNCTIONW__, unsigned(cd.s));
-		closesocket(cd.s);			// TODO: check this
-	}
 	cd.s = s;
 	cd.peer = peer;
 	cd.peerPort = ssin.sin_port;
+	cd.resetNetState();
 	return true;
 }
 
-bool Labeless::onClientSockBufferReceived(ClientData& cd, const std::string& rawCommand)
+bool Labeless::onClientSockBufferReceived(ClientData& cd, const char* rawCommand, size_t size)
 {
 #ifdef LABELESS_ADDITIONAL_LOGGING
 	std::ofstream of("c:\\labeless.log", std::ios_base::app);
@@ -1109,7 +2047,8 @@ bool Labeless::onClientSockBufferReceived(ClientData& cd, const std::string& raw
 		_strdate_s(buff, 128);
 		of << "\r\n" << std::string(buff);
 		_strtime_s(buff, 128);
-		of << " " << std::string(buff) << " RECV: " << rawCommand << std::endl;
+		of << " " << std::string(buff) << " RECV: ";
+		of.write(rawCommand, size) << std::endl;
 		of.close();
 	}
 #endif // LABELESS_ADDITIONAL_LOGGING
@@ -1118,7 +2057,7 @@ bool Labeless::onClientSockBufferReceived(ClientData& cd, const std::string& raw
 	std::string errorStr;
 	try
 	{
-		if (!command.ParseFromString(rawCommand))
+		if (!parseMessage(command, rawCommand, size))
 			errorStr = "Unable to parse command";
 	}
 	catch (...)
@@ -1126,14 +2065,27 @@ bool Labeless::onClientSockBufferReceived(ClientData& cd, const std::string& raw
 		errorStr = "Exception occurred, unable to parse command";
 	}
 
-	Request req;
+	ExecutionData& ed = Labeless::instance().executionData();
+
+	const RequestPtr pNewReq = std::make_shared<Request>();
+	Request& req = *pNewReq;
 	static uint64_t req_id;
 	req.id = ++req_id;
+	req.clientId = cd.id;
 
 	req.script = command.script();
 	req.scriptExternObj = command.script_extern_obj();
+	req.scriptExternMarshal = command.script_extern_marshal();
 	req.params = command.rpc_request();
 	req.background = command.background();
+	req.requestId = command.request_id();
+	req.native = req.script.empty() && !req.params.empty() && Labeless::instance().nativeSync();
+	req.relocations = cd.relocations;
+	// a background job's result is polled by an other request, so its chunks couldn't be matched
+	req.streamingAllowed = cd.mode == ClientData::CM_Framed && cd.protocolVersion >= netframe::kStreamingProtocolVersion &&
+		req.requestId && !req.background;
+	req.outputStreamingAllowed = req.streamingAllowed && cd.protocolVersion >= netframe::kOutputStreamingProtocolVersion;
+	req.receivedAt = performanceCounter();
 
 	rpc::Response response;
 
@@ -1147,16 +2099,13 @@ bool Labeless::onClientSockBufferReceived(ClientData& cd, const std::string& raw
 			break;
 		}
 
-		char szJobId[256] = {};
-		_snprintf_s(szJobId, _countof(szJobId), _TRUNCATE,
-			"pyexcore.PyExCore.execute(%" PRIu64  ")", req.id);
-		req.script = szJobId;
+		req.rpc = true;
 
 		if (!command.has_job_id())
 			break;
 
-		recursive_lock_guard lock(cd.commandsLock);
-		Request* pReq = cd.find(command.job_id());
+		recursive_lock_guard lock(ed.commandsLock);
+		Request* pReq = ed.find(command.job_id());
 		if (!pReq)
 		{
 			errorStr = "Job not found";
@@ -1169,14 +2118,19 @@ bool Labeless::onClientSockBufferReceived(ClientData& cd, const std::string& raw
 			break;
 		}
 		response.set_job_status(rpc::Response::JS_FINISHED);
-		req.result = pReq->result;
+		req.result.swap(pReq->result);
+		// stored result is tagged with the id of the request which started the job, the last field value wins
+		if (req.requestId)
+			putVarintField(req.result, rpc::Response::kRequestIdFieldNumber, req.requestId);
 		pReq = nullptr;
-		cd.remove(command.job_id());
+		ed.remove(command.job_id());
 	} while (0);
 
 	if (!errorStr.empty() || req.background || response.has_job_status())
 	{
 		response.set_job_id(req.id);
+		if (req.requestId)
+			response.set_request_id(req.requestId);
 		if (!errorStr.empty())
 			response.set_error(errorStr);
 
@@ -1189,28 +2143,203 @@ bool Labeless::onClientSockBufferReceived(ClientData& cd, const std::string& raw
 			req.finished = true;
 	}
 
+	bool scheduled = false;
 	do {
-		recursive_lock_guard lock(cd.commandsLock);
-		cd.commands.push_back(req);
+		recursive_lock_guard lock(ed.commandsLock);
+		ed.add(pNewReq);
+		scheduled = errorStr.empty() && !req.finished;
+		if (scheduled)
+			ed.pendingJobs[cd.id].push_back(req.id);
+		else
+			req.finishedAt = performanceCounter(); // nothing to execute
+		// logged under the lock, the GUI thread may run the job as soon as it's released
+		server_log("%s: new request pushed { jobId: %" PRIu64 ", bkg: %u, finished: %u }", __FUNCTION__,
+			req.id, req.background, req.finished);
 	} while (0);
-	server_log("%s: new request pushed { jobId: %" PRIu64 ", bkg: %u, finished: %u }", __FUNCTION__,
-		req.id, req.background, req.finished);
 
-	if (!errorStr.empty() || req.finished)
+	if (!scheduled)
+	{
+		Labeless::instance().notifyResultsReady();
 		return true;
+	}
 
 	const bool rv = TRUE == IsWindow(gConfig.helperWnd) &&
-		PostMessage(gConfig.helperWnd, gConfig.hlpCommandReceived, reinterpret_cast<WPARAM>(&cd), 0);
+		PostMessage(gConfig.helperWnd, gConfig.hlpCommandReceived, 0, 0);
 
 	return rv;
 }
 
 bool Labeless::onClientSockRead(ClientData& cd)
 {
-	u_long ready = 0;
 	if (INVALID_SOCKET == cd.s)
 		return true; // socket already closed
 
+	while (cd.mode != ClientData::CM_Legacy)
+	{
+		const bool readingHeader = cd.frameHeaderReceived < sizeof(cd.frameHeader);
+		char* const dst = readingHeader
+			? reinterpret_cast<char*>(&cd.frameHeader) + cd.frameHeaderReceived
+			: &cd.netBuff[0] + cd.netBuffReceived;
+		const size_t left = readingHeader
+			? sizeof(cd.frameHeader) - cd.frameHeaderReceived
+			: cd.netBuff.size() - cd.netBuffReceived;
+
+		if (left)
+		{
+			const int read = recv(cd.s, dst, static_cast<int>(left), 0);
+			if (read == 0)
+				return false;
+			if (SOCKET_ERROR == read)
+			{
+				if (WSAGetLastError() == WSAEWOULDBLOCK)
+					return true; // wait for the next FD_READ
+				server_log("%s: Error: %s", __FUNCTION__, wsaErrorToString().c_str());
+				return false;
+			}
+			(readingHeader ? cd.frameHeaderReceived : cd.netBuffReceived) += read;
+		}
+
+		if (readingHeader)
+		{
+			if (cd.mode == ClientData::CM_Unknown && cd.frameHeaderReceived >= sizeof(cd.frameHeader.magic))
+			{
+				if (cd.frameHeader.magic != netframe::kMagic)
+				{
+					server_log("%s: peer %s uses legacy protocol", __FUNCTION__, cd.peer.c_str());
+					cd.mode = ClientData::CM_Legacy;
+					cd.netBuff.assign(reinterpret_cast<const char*>(&cd.frameHeader), cd.frameHeaderReceived);
+					cd.netBuffReceived = cd.frameHeaderReceived;
+					cd.frameHeaderReceived = 0;
+					break;
+				}
+				cd.mode = ClientData::CM_Framed;
+			}
+			if (cd.frameHeaderReceived < sizeof(cd.frameHeader))
+				continue;
+
+			// header is completed, allocate the whole payload at once
+			if (!netframe::isValid(cd.frameHeader))
+			{
+				server_log("%s: Invalid frame header received from %s", __FUNCTION__, cd.peer.c_str());
+				return false;
+			}
+			if (!cd.reserveNetBuff(cd.frameHeader.size))
+			{
+				server_log("%s: Unable to allocate 0x%08X bytes memory", __FUNCTION__, cd.frameHeader.size);
+				return false;
+			}
+			cd.netBuffReceived = 0;
+		}
+
+		if (cd.netBuffReceived < cd.netBuff.size())
+			continue;
+
+		cd.frameHeaderReceived = 0;
+		if (!onClientSockFrameReceived(cd))
+			return false;
+	}
+
+	return onClientSockReadLegacy(cd);
+}
+
+bool Labeless::onClientSockFrameReceived(ClientData& cd)
+{
+	// the buffers are reused by the next frame, so the handlers must not keep pointers to them
+	std::shared_ptr<void> guard(nullptr, [&cd](void*){ cd.releaseNetBuffers(); });
+	const std::string* payload = &cd.netBuff;
+	if (cd.frameHeader.codec != compression::CODEC_None)
+	{
+		if (!compression::unpack(compression::Codec(cd.frameHeader.codec), cd.netBuff.data(), cd.netBuff.size(), cd.unpackBuff))
+		{
+			server_log("%s: Unable to unpack frame (codec %u) from %s", __FUNCTION__,
+				unsigned(cd.frameHeader.codec), cd.peer.c_str());
+			return false;
+		}
+		payload = &cd.unpackBuff;
+	}
+
+	switch (cd.frameHeader.type)
+	{
+	case netframe::FT_Hello:
+		do {
+			rpc::Hello hello;
+			if (!parseMessage(hello, payload->data(), payload->size()))
+			{
+				server_log("%s: Unable to parse Hello from %s", __FUNCTION__, cd.peer.c_str());
+				return false;
+			}
+			cd.protocolVersion = hello.protocol_version() < netframe::kProtocolVersion
+				? static_cast<uint8_t>(hello.protocol_version())
+				: netframe::kProtocolVersion;
+			if (!cd.protocolVersion)
+			{
+				server_log("%s: Invalid protocol version requested by %s", __FUNCTION__, cd.peer.c_str());
+				return false;
+			}
+
+			if (hello.relocations_size())
+			{
+				auto relocations = std::make_shared<Relocations>();
+				relocations->reserve(hello.relocations_size());
+				for (int i = 0; i < hello.relocations_size(); ++i)
+				{
+					const rpc::Relocation& r = hello.relocations(i);
+					if (r.start() < r.end())
+						relocations->push_back(Relocation { r.start(), r.end(), r.remote_start() });
+				}
+				std::sort(relocations->begin(), relocations->end(), [](const Relocation& l, const Relocation& r) {
+					return l.start < r.start;
+				});
+				cd.relocations = relocations;
+			}
+
+			rpc::Hello reply;
+			reply.set_protocol_version(cd.protocolVersion);
+			reply.set_labeless_version(LABELESS_VER_STR);
+			const compression::Codec codec = compression::choose(hello.codecs());
+			if (hello.has_codecs())
+				reply.set_codecs(compression::codecMask(codec));
+			std::string error;
+			std::string payload = reply.SerializeAsString();
+			// Hello itself is never packed
+			cd.queue(netframe::FT_Hello, payload);
+			if (!cd.flush(error))
+			{
+				server_log("%s: send() failed, error: %s", __FUNCTION__, error.c_str());
+				return false;
+			}
+			cd.codec = codec;
+			server_log("%s: protocol v%u, codec %u negotiated with %s (Labeless %s), %u relocation(s)", __FUNCTION__,
+				unsigned(cd.protocolVersion), unsigned(cd.codec), cd.peer.c_str(), hello.labeless_version().c_str(),
+				unsigned(cd.relocations ? cd.relocations->size() : 0));
+		} while (0);
+		return true;
+	case netframe::FT_Execute:
+		if (!cd.protocolVersion)
+		{
+			server_log("%s: Execute received before Hello from %s", __FUNCTION__, cd.peer.c_str());
+			return false;
+		}
+		return onClientSockBufferReceived(cd, payload->data(), payload->size());
+	default:
+		server_log("%s: Unsupported frame type %u received from %s", __FUNCTION__,
+			unsigned(cd.frameHeader.type), cd.peer.c_str());
+		break;
+	}
+	return false;
+}
+
+void Labeless::queueResponse(ClientData& cd, std::string& rawResponse)
+{
+	if (cd.mode == ClientData::CM_Framed)
+		cd.queue(netframe::FT_Response, rawResponse);
+	else
+		cd.queueRaw(rawResponse);
+}
+
+bool Labeless::onClientSockReadLegacy(ClientData& cd)
+{
+	u_long ready = 0;
 	do
 	{
 		if (SOCKET_ERROR == ioctlsocket(cd.s, FIONREAD, &ready))
@@ -1220,47 +2349,50 @@ bool Labeless::onClientSockRead(ClientData& cd)
 		}
 		if (!ready)
 		{
-			const std::string& rawCommand = cd.netBuff.str();
-			cd.netBuff.str("");
-			cd.netBuff.clear();
-
-			return onClientSockBufferReceived(cd, rawCommand);
+			std::shared_ptr<void> guard(nullptr, [&cd](void*){ cd.releaseNetBuffers(); });
+			return onClientSockBufferReceived(cd, cd.netBuff.data(), cd.netBuffReceived);
 		}
 
-		char* buff = nullptr;
-		try
-		{
-			buff = new char[ready];
-		}
-		catch (const std::bad_alloc&)
+		// receive right into the connection buffer, it keeps the capacity between the requests
+		if (!cd.reserveNetBuff(cd.netBuffReceived + ready))
 		{
 			server_log("%s: Unable to allocate 0x%08X bytes memory", __FUNCTION__, ready);
 			return false;
 		}
-		std::shared_ptr<void> guard { nullptr, [buff](void*){ delete [] buff; }};
 
-		const int read = recv(cd.s, buff, ready, 0);
+		const int read = recv(cd.s, &cd.netBuff[cd.netBuffReceived], ready, 0);
 		server_log("%s: Received %u bytes of %u.", __FUNCTION__, read, ready);
 
 		if (read == 0)
 			return false;
 		if (SOCKET_ERROR == read)
 		{
-			server_log("%s: Error: %s", __FUNCTION__, wsaErrorToString());
+			server_log("%s: Error: %s", __FUNCTION__, wsaErrorToString().c_str());
 			return false;
 		}
-		std::string r(buff, buff + read);
-		cd.netBuff << r;
+		cd.netBuffReceived += read;
 	} while (true);
 	return true;
 }
 
 bool Labeless::onClientSockClose(ClientData& cd)
 {
-	server_log("%s: socket %08X closed", __FUNCTION__, unsigned(cd.s));
+	if (INVALID_SOCKET == cd.s)
+		return true;
+	server_log("%s: socket %08X closed, %u request(s) served over the connection, latency: %s", __FUNCTION__,
+		unsigned(cd.s), cd.requestsServed, cd.latencyHistogramToString().c_str());
+	server_log("%s: receive buffer grown %u time(s), peak size 0x%08X", __FUNCTION__,
+		cd.netBuffStats.growths, unsigned(cd.netBuffStats.peak));
+	if (cd.bytesOutPacked)
+		server_log("%s: %" PRIu64 " bytes sent as %" PRIu64 " (codec %u, ratio %.2f)", __FUNCTION__,
+			cd.bytesOut, cd.bytesOutPacked, unsigned(cd.codec), double(cd.bytesOut) / double(cd.bytesOutPacked));
 	closesocket(cd.s);
 	cd.s = INVALID_SOCKET;
+	cd.resetNetState();
 
+	ExecutionData& ed = Labeless::instance().executionData();
+	recursive_lock_guard lock(ed.commandsLock);
+	ed.dropClientRequests(cd.id);
 	return true;
 }
 
@@ -10,44 +10,165 @@
 
 #include <atomic>
 #include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <thread>
 #include <sstream>
+#include <unordered_map>
+#include <vector>
 #include <WinSock2.h>
 
+#include "../common/compression.h"
+#include "../common/netframe.h"
+#include "../common/recvbuffer.h"
+#include "outputcapture.h"
+
+namespace rpc {
+class GetNamesRequest;
+} // rpc
+
+// an IDB range [start, end) of a client which is at remoteStart in the debuggee, see rpc::Hello::relocations
+struct Relocation
+{
+	uint32_t		start;
+	uint32_t		end;
+	uint32_t		remoteStart;
+};
+typedef std::vector<Relocation> Relocations; // sorted by start
+typedef std::shared_ptr<const Relocations> RelocationsPtr;
+
+// a frame sent before the response of its request
+typedef std::pair<netframe::FrameType, std::string> PendingFrame;
+
+// a job, referenced by its id. The results may be huge, so it is never copied
 struct Request
 {
+	Request() {}
+	Request(const Request&) = delete;
+	Request& operator=(const Request&) = delete;
+
 	uint64_t		id = 0;
+	uint64_t		clientId = 0; // ClientData::id of the connection waiting for the result
+	uint64_t		requestId = 0; // client's id, echoed back in rpc::Response
+	int64_t			receivedAt = 0; // QueryPerformanceCounter() value
+	int64_t			finishedAt = 0; // QueryPerformanceCounter() value, see ExecutionData::expireJobs()
 	std::string		script;
-	std::string		scriptExternObj;
+	std::string		scriptExternObj; // JSON
+	std::string		scriptExternMarshal; // marshal.dumps(), protocol version >= 6
 	std::string		params;
 
-	std::string		result;
-	std::string		binaryResult;
+	std::string		result; // serialized rpc::Response, rpc_result goes first to be written in place
 	std::string		error;
 
 	bool			finished = false;
 	bool			background = false;
+	bool			native = false; // names/comments may be applied by Labeless Olly itself, without Python
+	bool			rpc = false; // the params are passed to pyexcore.PyExCore.execute(id) instead of running the script
+	RelocationsPtr	relocations; // of the client connection, if any
+
+	// serialized rpc::MemoryChunk and rpc::OutputChunk payloads, sent before the response. Guarded by ExecutionData::commandsLock
+	bool			streamingAllowed = false;
+	bool			outputStreamingAllowed = false;
+	std::deque<PendingFrame> chunks;
+
+	OutputCapture	stdOut;
+	OutputCapture	stdErr;
 };
+// the GUI thread keeps the job alive while it's executed, even if the client drops it meanwhile
+typedef std::shared_ptr<Request> RequestPtr;
 
+// one per connection, used by the server thread only
 struct ClientData
 {
+	uint64_t				id = 0;
 	std::string				peer;
 	WORD					peerPort = 0;
 	SOCKET					s = INVALID_SOCKET;
-	std::stringstream		netBuff;
+	WSAEVENT				evt = WSA_INVALID_EVENT;
+
+	enum Mode
+	{
+		CM_Unknown,
+		CM_Legacy,	// raw rpc::Execute, the end of message is guessed by FIONREAD == 0
+		CM_Framed	// netframe::Header prefixed messages
+	};
+
+	Mode					mode = CM_Unknown;
+	uint8_t					protocolVersion = 0;
+	uint8_t					codec = 0; // compression::Codec negotiated in Hello
+	RelocationsPtr			relocations; // sent in Hello, shared by the requests of the connection
+	netframe::Header		frameHeader;
+	size_t					frameHeaderReceived = 0;
+	std::string				netBuff; // frame payload or legacy request, reused by the next one
+	size_t					netBuffReceived = 0;
+	std::string				unpackBuff; // netBuff unpacked if the frame is compressed
+	recvbuffer::Stats		netBuffStats;
+	unsigned				requestsServed = 0;
+	uint64_t				bytesOut = 0; // payload bytes before and after compression
+	uint64_t				bytesOutPacked = 0;
+
+	// a frame or a legacy response not sent yet
+	struct OutgoingBuffer
+	{
+		std::string			head; // netframe::Header, empty for a legacy client
+		std::string			payload;
+		size_t				sent = 0; // of head and payload
+	};
+	// drained on FD_WRITE, so a slow peer doesn't block the server thread and the other clients
+	std::deque<OutgoingBuffer> outQueue;
+	size_t					outQueueBytes = 0;
+	static const size_t		kMaxOutQueueBytes = 8 * 1024 * 1024; // the results wait in their jobs above it
+	bool					closeWhenSent = false; // a legacy client gets a single response
+
+	// request receive-to-send latency: < 1ms, < 10ms, < 100ms, < 1s, >= 1s
+	enum { kLatencyBuckets = 5 };
+	unsigned				latencyHistogram[kLatencyBuckets];
+
+	// payload is taken and packed with the negotiated codec
+	void queue(netframe::FrameType type, std::string& payload);
+	void queueRaw(std::string& payload);
+	// sends what the socket takes now, false if the connection is broken
+	bool flush(std::string& error);
+	bool canQueue() const { return outQueueBytes < kMaxOutQueueBytes; }
+	bool reserveNetBuff(size_t size);
+	void releaseNetBuffers();
+	void resetNetState();
+	void onResponseSent(const Request& r);
+	std::string latencyHistogramToString() const;
+};
+
+typedef std::shared_ptr<ClientData> ClientDataPtr;
 
+// requests of all the connections, shared by the server thread and the GUI thread
+struct ExecutionData
+{
 	std::recursive_mutex	commandsLock;
-	std::deque<Request>		commands;
+	std::unordered_map<uint64_t, RequestPtr> jobs; // by Request::id
+	// Request::id of the jobs in the order they were received, per ClientData::id. Guarded by commandsLock
+	std::map<uint64_t, std::deque<uint64_t>> clientJobs;
+
+	// ids of commands waiting for the GUI thread, per ClientData::id. Guarded by commandsLock
+	std::map<uint64_t, std::deque<uint64_t>> pendingJobs;
+	uint64_t				lastScheduledClientId = 0;
+
+	// total size of Request::chunks not yet sent, the producer waits while it exceeds kMaxQueuedChunkBytes
+	static const size_t	kMaxQueuedChunkBytes = 8 * 1024 * 1024;
+	size_t					queuedChunkBytes = 0;
+	// manual reset, set by takeChunks() when the queue shrinks. Exists while the server is running
+	HANDLE					chunksTakenEvt = nullptr;
+
+	// background jobs finished this long ago are dropped, even if their results were never polled
+	static const unsigned	kFinishedJobTtlSec = 10 * 60;
 
 	//std::recursive_mutex	resultLock;
 	//std::string				result;
 
-	std::recursive_mutex	stdOutLock;
-	std::stringstream		stdOut;
+	// the job executed by the GUI thread, stdout and stderr go to its OutputCapture. Used by the GUI thread only
+	RequestPtr				runningJob;
 
-	std::recursive_mutex	stdErrLock;
+	// the output written while no job is running, e.g. by init.py. Used by the GUI thread only
+	std::stringstream		stdOut;
 	std::stringstream		stdErr;
 
 	//std::recursive_mutex	binaryResultLock;
@@ -56,7 +177,13 @@ struct ClientData
 	//std::recursive_mutex	lock; // this lock
 
 	Request* find(uint64_t jobId);
+	RequestPtr acquire(uint64_t jobId);
+	void add(const RequestPtr& r);
 	bool remove(uint64_t jobId);
+	size_t expireJobs(int64_t finishedBefore);
+	bool popNextPendingJob(uint64_t& jobId);
+	void dropClientRequests(uint64_t clientId);
+	void takeChunks(Request& r, std::deque<PendingFrame>& out);
 };
 
 typedef std::lock_guard<std::recursive_mutex> recursive_lock_guard;
@@ -79,17 +206,23 @@ public:
 	bool startServer();
 
 	static WORD defaultPort() { return 3852; }
+	static const size_t kDefaultMaxOutputSize = 4 * 1024 * 1024;
 	inline void setPort(WORD wPort) { m_Port = wPort; }
 	inline void setFilterIP(const std::string ip) { m_FilterIP = ip; }
+	inline void setNativeSync(bool enabled) { m_NativeSync = enabled; }
+	inline void setMaxOutputSize(size_t size) { m_MaxOutputSize = size; }
 	WORD port() const { return m_Port; }
+	bool nativeSync() const { return m_NativeSync; }
+	size_t maxOutputSize() const { return m_MaxOutputSize; }
 	std::string filterIP() const { return m_FilterIP; }
 	static std::string lastChangeTimestamp();
 
 	void onSetPortRequested();
 	void onSetIPFilter();
 
-	inline ClientData& clientData() { return m_Rpc; }
-	inline const ClientData& clientData() const { return m_Rpc; }
+	inline ExecutionData& executionData() { return m_Rpc; }
+	inline const ExecutionData& executionData() const { return m_Rpc; }
+	void notifyResultsReady(); // wakes the server thread up to send the finished results and the chunks
 
 private:
 	bool initPython();
@@ -101,13 +234,19 @@ private:
 	static void WINAPI serverThread(Labeless* ll);
 
 	static LRESULT CALLBACK helperWinProc(HWND hw, UINT msg, WPARAM wp, LPARAM lp);
-	bool onCommandReceived(const std::string& command, const std::string& scriptExternObj);
-	bool onCommandReceived(ClientData& cd);
+	bool onCommandReceived(const Request& request);
+	bool onCommandReceived(ExecutionData& ed);
+	static bool applyRpcRequestNatively(const Request& request, bool& handled, std::string& result, std::string& error);
+	static bool getNames(const rpc::GetNamesRequest& req, std::string& result, std::string& error);
 	void onPortChanged();
 
 	static bool onClientSockAccept(SOCKET sock, ClientData& cd);
 	static bool onClientSockRead(ClientData& cd);
-	static bool onClientSockBufferReceived(ClientData& cd, const std::string& rawCommand);
+	static bool onClientSockReadLegacy(ClientData& cd);
+	static bool onClientSockFrameReceived(ClientData& cd);
+	static bool onClientSockBufferReceived(ClientData& cd, const char* rawCommand, size_t size);
+	static void queueResponse(ClientData& cd, std::string& rawResponse); // rawResponse is taken
+	static bool sendFinishedResults(ClientData& cd);
 	static bool onClientSockClose(ClientData& cd);
 
 private:
@@ -118,11 +257,14 @@ private:
 	HWND					m_LogList;
 
 	std::string				m_FilterIP;
+	std::atomic_bool		m_NativeSync; // "native_sync" ini value, pyexcore is used for everything if false
+	size_t					m_MaxOutputSize; // "max_output_size" ini value, per job and stream
 
 	std::recursive_mutex	m_ThreadLock;
 	ThreadPtr				m_Thread;
 	static std::atomic_bool	m_ServerEnabled;
+	WSAEVENT				m_ResultsReadyEvt; // wakes the server thread up when a command is finished
 
-	ClientData				m_Rpc;
+	ExecutionData			m_Rpc;
 };
 
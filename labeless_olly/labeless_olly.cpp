@@ -72,6 +72,10 @@ extc int  _export cdecl ODBG_Plugininit(int ollydbgversion, HWND hw, ulong* feat
 	char buff[MAX_PATH] = {};
 	Pluginreadstringfromini(ll.hInstance(), "filer_ip", buff, "");
 	ll.setFilterIP(buff);
+	// 0 lets pyexcore.PyExCore (and the scripts customizing it) handle the names/comments sync
+	ll.setNativeSync(Pluginreadintfromini(ll.hInstance(), "native_sync", 1) != 0);
+	// bytes of stdout and of stderr kept per job, 0 is unlimited
+	ll.setMaxOutputSize(size_t(Pluginreadintfromini(ll.hInstance(), "max_output_size", int(Labeless::kDefaultMaxOutputSize))));
 
 	if (!Labeless::instance().init())
 	{
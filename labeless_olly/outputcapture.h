@@ -0,0 +1,33 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#pragma once
+
+#include <string>
+
+// stdout or stderr of a job, written by the GUI thread only
+struct OutputCapture
+{
+	std::string		text; // not streamed yet
+	size_t			size = 0; // of the whole output kept, streamed included
+	size_t			dropped = 0; // bytes over Labeless::maxOutputSize()
+
+	// a line of print(), dropped once the output kept would exceed maxSize. 0 is unlimited
+	bool append(const char* str, size_t len, size_t maxSize)
+	{
+		const size_t lineSize = len + 1;
+		if (maxSize && size + lineSize > maxSize)
+		{
+			dropped += lineSize;
+			return false;
+		}
+		text.append(str, len).push_back('\n');
+		size += lineSize;
+		return true;
+	}
+};
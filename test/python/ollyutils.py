@@ -11,6 +11,8 @@ __author__ = 'a1ex_t'
 # from binascii import hexlify
 # import itertools
 from os import path
+import bisect
+import hashlib
 import struct
 import sys
 import traceback
@@ -40,26 +42,97 @@ modules_meta = dict()
 modules_exports = dict()  # will hold pairs <ea, 'module_name.api_name'>
 
 
-def make_names(names, base, remote_base):
+def request_names(req):
+    """ (ea, name) pairs of MakeNamesRequest or MakeCommentsRequest, either packed or not """
+    if not req.HasField('packed_names'):
+        return [(n.ea, n.name) for n in req.names]
+    packed = req.packed_names
+    if not len(packed.ea_deltas) == len(packed.shared_sizes) == len(packed.suffix_sizes):
+        raise ValueError('malformed packed names')
+    rv = []
+    ea = 0
+    pos = 0
+    name = ''
+    for delta, shared, size in zip(packed.ea_deltas, packed.shared_sizes, packed.suffix_sizes):
+        if shared > len(name) or pos + size > len(packed.suffixes):
+            raise ValueError('malformed packed names')
+        name = name[:shared] + packed.suffixes[pos:pos + size]
+        pos += size
+        ea = (ea + delta) & 0xFFFFFFFF
+        rv.append((ea, name))
+    if pos != len(packed.suffixes):
+        raise ValueError('malformed packed names')
+    return rv
+
+
+def make_relocator(base, remote_base, relocations=None):
+    """ IDB ea -> debuggee ea, relocations are sorted (start, end, remote_start) of py_olly.get_relocations() """
+    ptrdiff = (remote_base - base) & 0xFFFFFFFF
+    if not relocations:
+        return lambda ea: (ea + ptrdiff) & 0xFFFFFFFF
+    starts = [r[0] for r in relocations]
+
+    def relocate(ea):
+        i = bisect.bisect_right(starts, ea) - 1
+        if i >= 0 and ea < relocations[i][1]:
+            return (ea - relocations[i][0] + relocations[i][2]) & 0xFFFFFFFF
+        return (ea + ptrdiff) & 0xFFFFFFFF
+    return relocate
+
+
+def make_names(names, base, remote_base, relocations=None):
     if not names:
         return
-    ptrdiff = 0
-    if base != remote_base:
-        ptrdiff = remote_base - base
-    for n in names:
-        oa.Insertname(n.ea + ptrdiff, oa.NM_LABEL, str(n.name))
+    relocate = make_relocator(base, remote_base, relocations)
+    for ea, name in names:
+        oa.Insertname(relocate(ea), oa.NM_LABEL, str(name))
     oa.Redrawdisassembler()
 
 
-def make_comments(comments, base, remote_base):
+def make_comments(comments, base, remote_base, relocations=None):
     if not comments:
         return
-    ptrdiff = remote_base - base
-    for cmt in comments:
-        oa.Insertname(cmt.ea + ptrdiff, oa.NM_COMMENT, str(cmt.name))
+    relocate = make_relocator(base, remote_base, relocations)
+    for ea, cmt in comments:
+        oa.Insertname(relocate(ea), oa.NM_COMMENT, str(cmt))
     oa.Redrawdisassembler()
 
 
+def get_names(base, remote_base, start, end, labels=True, comments=True):
+    to_remote = (remote_base - base) & 0xFFFFFFFF
+    remote_start = (start + to_remote) & 0xFFFFFFFF
+    remote_end = (end + to_remote) & 0xFFFFFFFF
+    names = {}  # remote ea -> [label, comment]
+
+    def collect(name_type, index):
+        buf = bytearray(oa.TEXTLEN)
+        addr = remote_start
+        if oa.Findname(addr, name_type, buf) <= 0:
+            addr = oa.Findnextname(buf)
+        while addr and remote_start <= addr < remote_end:
+            names.setdefault(addr, [None, None])[index] = str(buf.split('\0', 1)[0])
+            addr = oa.Findnextname(buf)
+
+    if labels:
+        collect(oa.NM_LABEL, 0)
+    if comments:
+        collect(oa.NM_COMMENT, 1)
+
+    rv = rpc.GetNamesResult()
+    prev = start
+    for addr in sorted(names):
+        ea = (addr - to_remote) & 0xFFFFFFFF
+        label, comment = names[addr]
+        n = rv.names.add()
+        n.ea_delta = (ea - prev) & 0xFFFFFFFF
+        if label:
+            n.label = label
+        if comment:
+            n.comment = comment
+        prev = ea
+    return rv
+
+
 def get_memory_map():
     oa.Listmemory()
     t = oa.pluginvalue_to_t_table(oa.Plugingetvalue(oa.VAL_MEMORY))
@@ -186,15 +259,87 @@ def disasm(ea, mem=None, size=oa.MAXCMDSIZE):
         return None, None
     return n, dis
 
-def read_memory_regions(regions):
+MEMORY_PAGE_SIZE = 0x1000
+
+
+def memory_page_hash(page):
+    """ Same as Labeless IDA computes for rpc.ReadMemoryRegionsRequest.Region.page_hashes """
+    return struct.unpack('<Q', hashlib.md5(page).digest()[:8])[0]
+
+
+def changed_page_runs(data, offset, page_hashes):
+    """ Splits data read at offset of the region to the runs of pages which differ from page_hashes
+    :return: list of (begin, end) within data, count of unchanged bytes
+    """
+    if not page_hashes:
+        return [(0, len(data))], 0
+    runs = list()
+    unchanged = 0
+    for p in xrange(0, len(data), MEMORY_PAGE_SIZE):
+        page = buffer(data, p, MEMORY_PAGE_SIZE)
+        idx = (offset + p) // MEMORY_PAGE_SIZE
+        if idx < len(page_hashes) and memory_page_hash(page) == page_hashes[idx]:
+            unchanged += len(page)
+        elif runs and runs[-1][1] == p:
+            runs[-1] = (runs[-1][0], p + len(page))
+        else:
+            runs.append((p, p + len(page)))
+    return runs, unchanged
+
+
+def stream_memory_region(region_index, addr, size, chunk_size, send_chunk, page_hashes=None):
+    """ Sends the region by chunk_size pieces, the pages matching page_hashes are skipped
+    :return: (region protection, unchanged bytes, True if the whole region is sent)
+             or None if the client doesn't accept the chunks
+    """
+    # page hashes are checked within a chunk
+    chunk_size = (chunk_size + MEMORY_PAGE_SIZE - 1) // MEMORY_PAGE_SIZE * MEMORY_PAGE_SIZE
+    protect = None
+    unchanged = 0
+    accepted = False
+    for offset in xrange(0, size, chunk_size):
+        n = min(chunk_size, size - offset)
+        m = safe_read_chunked_memory_region_as_one(addr + offset, n)
+        if m is None:
+            print >> sys.stderr, 'safe_read_chunked_memory_region_as_one() failed for (0x%08X, 0x%08X)' % (addr + offset, n)
+            break
+        if protect is None:
+            protect = int(m[2])
+
+        runs, skipped = changed_page_runs(m[1], offset, page_hashes)
+        unchanged += skipped
+        for begin, end in runs:
+            if send_chunk(region_index, offset + begin, buffer(m[1], begin, end - begin)):
+                accepted = True
+                continue
+            if not accepted:
+                return None
+            print >> sys.stderr, 'unable to send memory chunk (0x%08X, 0x%08X)' % (addr + offset + begin, end - begin)
+            return protect, unchanged, False
+    if protect is None:
+        return None
+    return protect, unchanged, True
+
+
+def read_memory_regions(regions, chunk_size=0, send_chunk=None):
     oa.Listmemory()
     
     rv = rpc.ReadMemoryRegionsResult()
-    for r in regions:
+    for i, r in enumerate(regions):
         mem = rv.memories.add()
         mem.addr = int(r.addr)
         mem.size = int(r.size)
 
+        if chunk_size and send_chunk:
+            streamed = stream_memory_region(i, mem.addr, mem.size, chunk_size, send_chunk, r.page_hashes)
+            if streamed is not None:
+                mem.mem = ''
+                mem.protect, mem.unchanged_size, complete = streamed
+                if not complete:
+                    chunk_size = 0  # the client stalled, don't wait for it with each of the next regions
+                continue
+            chunk_size = 0  # fallback to the whole regions in the result
+
         m = safe_read_chunked_memory_region_as_one(mem.addr, mem.size)
         if m is None:
             print >> sys.stderr, 'safe_read_chunked_memory_region_as_one() failed for (0x%08X, 0x%08X)' % (mem.addr, mem.size)
@@ -47,6 +47,15 @@ def get_params(*args):
 get_params = _py_olly.get_params
 
 
+def send_memory_chunk(*args):
+    """ Stream a piece of memory region to the client before the rpc result
+    :param args: job_id, region_index, offset, data
+    :return: False if the client can't accept the chunks, so the data should be put into the result
+    """
+    return _py_olly.send_memory_chunk(*args)
+send_memory_chunk = _py_olly.send_memory_chunk
+
+
 def olly_log(*args):
     """ Log to Olly's log window
     :param : message
@@ -31,11 +31,7 @@ class binary_result(object):
     def __call__(self, *args, **kwargs):
         job_id, v = self._f(*args, **kwargs)
         if v:
-            serialized = v.SerializeToString()
-            v1 = v.__class__()
-            v1.ParseFromString(serialized)
-            print 'verify: %r, len: %u, name: %s' % (v1 == v, len(serialized), v.__class__.__name__)
-            py_olly.set_binary_result(job_id, serialized)
+            py_olly.set_binary_result(job_id, v.SerializeToString())
 
 
 class PyExCore(object):
@@ -45,7 +41,8 @@ class PyExCore(object):
         rpc.RpcRequest.RPCT_GET_MEMORY_MAP:         (None, '_rpc_get_memory_map'),
         rpc.RpcRequest.RPCT_READ_MEMORY_REGIONS:    ('read_memory_regions_req', '_rpc_read_memory_regions'),
         rpc.RpcRequest.RPCT_ANALYZE_EXTERNAL_REFS:  ('analyze_external_refs_req', '_rpc_analyze_external_refs'),
-        rpc.RpcRequest.RPCT_CHECK_PE_HEADERS:       ('check_pe_headers_req', '_rpc_check_pe_headers')
+        rpc.RpcRequest.RPCT_CHECK_PE_HEADERS:       ('check_pe_headers_req', '_rpc_check_pe_headers'),
+        rpc.RpcRequest.RPCT_GET_NAMES:              ('get_names_req', '_rpc_get_names')
     }
 
     @classmethod
@@ -56,7 +53,11 @@ class PyExCore(object):
                 print >> sys.stderr, 'Invalid rpc params'
                 return
             r = rpc.RpcRequest()
-            r.ParseFromString(raw_command)
+            try:
+                r.ParseFromString(raw_command)  # read-only buffer over the params stored by Labeless Olly
+            except TypeError:
+                # the C++ protobuf implementation accepts str only
+                r.ParseFromString(str(raw_command))
 
             if ollyapi.Getstatus() != ollyapi.STAT_STOPPED:
                 print >> sys.stderr, 'Warn! calling RPC on non-paused debuggee may cause an unpredictable results'
@@ -78,12 +79,14 @@ class PyExCore(object):
     @classmethod
     @binary_result
     def _rpc_make_names(cls, req, job_id):
-        return job_id, ollyutils.make_names(req.names, req.base, req.remote_base)
+        return job_id, ollyutils.make_names(ollyutils.request_names(req), req.base, req.remote_base,
+                                            py_olly.get_relocations(job_id))
 
     @classmethod
     @binary_result
     def _rpc_make_comments(cls, req, job_id):
-        return job_id, ollyutils.make_comments(req.names, req.base, req.remote_base)
+        return job_id, ollyutils.make_comments(ollyutils.request_names(req), req.base, req.remote_base,
+                                               py_olly.get_relocations(job_id))
 
     @classmethod
     @binary_result
@@ -93,7 +96,8 @@ class PyExCore(object):
     @classmethod
     @binary_result
     def _rpc_read_memory_regions(cls, req, job_id):
-        return job_id, ollyutils.read_memory_regions(req.regions)
+        send_chunk = lambda region_index, offset, data: py_olly.send_memory_chunk(job_id, region_index, offset, data)
+        return job_id, ollyutils.read_memory_regions(req.regions, req.chunk_size, send_chunk)
 
     @classmethod
     @binary_result
@@ -105,3 +109,8 @@ class PyExCore(object):
     @binary_result
     def _rpc_check_pe_headers(cls, req, job_id):
         return job_id, ollyutils.check_pe_headers(req.base, req.size)
+
+    @classmethod
+    @binary_result
+    def _rpc_get_names(cls, req, job_id):
+        return job_id, ollyutils.get_names(req.base, req.remote_base, req.start, req.end, req.labels, req.comments)
@@ -18,7 +18,7 @@ _sym_db = _symbol_database.Default()
 DESCRIPTOR = _descriptor.FileDescriptor(
   name='rpc.proto',
   package='rpc',
-  serialized_pb=_b('\n\trpc.proto\x12\x03rpc\"\xa2\x04\n\nRpcRequest\x12\x31\n\x0crequest_type\x18\x01 \x02(\x0e\x32\x1b.rpc.RpcRequest.RequestType\x12-\n\x0emake_names_req\x18\x02 \x01(\x0b\x32\x15.rpc.MakeNamesRequest\x12\x33\n\x11make_comments_req\x18\x03 \x01(\x0b\x32\x18.rpc.MakeCommentsRequest\x12>\n\x17read_memory_regions_req\x18\x04 \x01(\x0b\x32\x1d.rpc.ReadMemoryRegionsRequest\x12\x42\n\x19\x61nalyze_external_refs_req\x18\x05 \x01(\x0b\x32\x1f.rpc.AnalyzeExternalRefsRequest\x12\x38\n\x14\x63heck_pe_headers_req\x18\x06 \x01(\x0b\x32\x1a.rpc.CheckPEHeadersRequest\"\xbe\x01\n\x0bRequestType\x12\x10\n\x0cRPCT_UNKNOWN\x10\x00\x12\x13\n\x0fRPCT_MAKE_NAMES\x10\x01\x12\x16\n\x12RPCT_MAKE_COMMENTS\x10\x02\x12\x17\n\x13RPCT_GET_MEMORY_MAP\x10\x03\x12\x1c\n\x18RPCT_READ_MEMORY_REGIONS\x10\x04\x12\x1e\n\x1aRPCT_ANALYZE_EXTERNAL_REFS\x10\x05\x12\x19\n\x15RPCT_CHECK_PE_HEADERS\x10\x06\"t\n\x07\x45xecute\x12\x0e\n\x06script\x18\x01 \x01(\t\x12\x19\n\x11script_extern_obj\x18\x02 \x01(\t\x12\x13\n\x0brpc_request\x18\x03 \x01(\x0c\x12\x19\n\nbackground\x18\x04 \x01(\x08:\x05\x66\x61lse\x12\x0e\n\x06job_id\x18\x05 \x01(\x04\"\xba\x01\n\x08Response\x12\x0e\n\x06job_id\x18\x01 \x02(\x04\x12\x0f\n\x07std_out\x18\x02 \x01(\t\x12\x0f\n\x07std_err\x18\x03 \x01(\t\x12\r\n\x05\x65rror\x18\x04 \x01(\t\x12\x12\n\nrpc_result\x18\x05 \x01(\x0c\x12+\n\njob_status\x18\x06 \x01(\x0e\x32\x17.rpc.Response.JobStatus\",\n\tJobStatus\x12\x0f\n\x0bJS_FINISHED\x10\x01\x12\x0e\n\nJS_PENDING\x10\x02\"\x82\x01\n\x10MakeNamesRequest\x12)\n\x05names\x18\x01 \x03(\x0b\x32\x1a.rpc.MakeNamesRequest.Name\x12\x0c\n\x04\x62\x61se\x18\x02 \x02(\r\x12\x13\n\x0bremote_base\x18\x03 \x02(\r\x1a \n\x04Name\x12\n\n\x02\x65\x61\x18\x01 \x02(\r\x12\x0c\n\x04name\x18\x02 \x02(\t\"\x88\x01\n\x13MakeCommentsRequest\x12,\n\x05names\x18\x01 \x03(\x0b\x32\x1d.rpc.MakeCommentsRequest.Name\x12\x0c\n\x04\x62\x61se\x18\x02 \x02(\r\x12\x13\n\x0bremote_base\x18\x03 \x02(\r\x1a \n\x04Name\x12\n\n\x02\x65\x61\x18\x01 \x02(\r\x12\x0c\n\x04name\x18\x02 \x02(\t\"\x8a\x01\n\x12GetMemoryMapResult\x12\x30\n\x08memories\x18\x01 \x03(\x0b\x32\x1e.rpc.GetMemoryMapResult.Memory\x1a\x42\n\x06Memory\x12\x0c\n\x04\x62\x61se\x18\x01 \x02(\r\x12\x0c\n\x04size\x18\x02 \x02(\r\x12\x0e\n\x06\x61\x63\x63\x65ss\x18\x03 \x02(\r\x12\x0c\n\x04name\x18\x04 \x02(\t\"w\n\x18ReadMemoryRegionsRequest\x12\x35\n\x07regions\x18\x01 \x03(\x0b\x32$.rpc.ReadMemoryRegionsRequest.Region\x1a$\n\x06Region\x12\x0c\n\x04\x61\x64\x64r\x18\x01 \x02(\r\x12\x0c\n\x04size\x18\x02 \x02(\r\"\x94\x01\n\x17ReadMemoryRegionsResult\x12\x35\n\x08memories\x18\x01 \x03(\x0b\x32#.rpc.ReadMemoryRegionsResult.Memory\x1a\x42\n\x06Memory\x12\x0c\n\x04\x61\x64\x64r\x18\x01 \x02(\r\x12\x0c\n\x04size\x18\x02 \x02(\r\x12\x0b\n\x03mem\x18\x03 \x02(\x0c\x12\x0f\n\x07protect\x18\x04 \x02(\r\"\x7f\n\x1a\x41nalyzeExternalRefsRequest\x12\x0f\n\x07\x65\x61_from\x18\x01 \x02(\r\x12\r\n\x05\x65\x61_to\x18\x02 \x02(\r\x12\x11\n\tincrement\x18\x03 \x02(\r\x12\x16\n\x0e\x61nalysing_base\x18\x04 \x02(\r\x12\x16\n\x0e\x61nalysing_size\x18\x05 \x02(\r\"\xac\x05\n\x19\x41nalyzeExternalRefsResult\x12\x41\n\rapi_constants\x18\x01 \x03(\x0b\x32*.rpc.AnalyzeExternalRefsResult.PointerData\x12\x34\n\x04refs\x18\x02 \x03(\x0b\x32&.rpc.AnalyzeExternalRefsResult.RefData\x12\x35\n\x07\x63ontext\x18\x03 \x02(\x0b\x32$.rpc.AnalyzeExternalRefsResult.reg_t\x1a[\n\x0bPointerData\x12\n\n\x02\x65\x61\x18\x01 \x02(\r\x12\x0e\n\x06module\x18\x02 \x02(\t\x12\x0c\n\x04proc\x18\x03 \x02(\t\x12\"\n\x1aordinal_collision_dll_path\x18\x04 \x01(\t\x1a\x83\x02\n\x07RefData\x12\n\n\x02\x65\x61\x18\x01 \x02(\r\x12\x0b\n\x03len\x18\x02 \x02(\r\x12\x0b\n\x03\x64is\x18\x03 \x02(\t\x12\t\n\x01v\x18\x04 \x02(\r\x12@\n\x08ref_type\x18\x05 \x02(\x0e\x32..rpc.AnalyzeExternalRefsResult.RefData.RefType\x12\x0e\n\x06module\x18\x06 \x02(\t\x12\x0c\n\x04proc\x18\x07 \x02(\t\x12\"\n\x1aordinal_collision_dll_path\x18\x08 \x01(\t\"C\n\x07RefType\x12\x11\n\rREFT_JMPCONST\x10\x01\x12\x11\n\rREFT_IMMCONST\x10\x02\x12\x12\n\x0eREFT_ADDRCONST\x10\x03\x1a|\n\x05reg_t\x12\x0b\n\x03\x65\x61x\x18\x01 \x02(\r\x12\x0b\n\x03\x65\x63x\x18\x02 \x02(\r\x12\x0b\n\x03\x65\x64x\x18\x03 \x02(\r\x12\x0b\n\x03\x65\x62x\x18\x04 \x02(\r\x12\x0b\n\x03\x65sp\x18\x05 \x02(\r\x12\x0b\n\x03\x65\x62p\x18\x06 \x02(\r\x12\x0b\n\x03\x65si\x18\x07 \x02(\r\x12\x0b\n\x03\x65\x64i\x18\x08 \x02(\r\x12\x0b\n\x03\x65ip\x18\t \x02(\r\"3\n\x15\x43heckPEHeadersRequest\x12\x0c\n\x04\x62\x61se\x18\x01 \x02(\r\x12\x0c\n\x04size\x18\x02 \x02(\r\"\xad\x02\n\x14\x43heckPEHeadersResult\x12\x10\n\x08pe_valid\x18\x01 \x02(\x08\x12/\n\x04\x65xps\x18\x02 \x03(\x0b\x32!.rpc.CheckPEHeadersResult.Exports\x12\x33\n\x08sections\x18\x03 \x03(\x0b\x32!.rpc.CheckPEHeadersResult.Section\x1a\x30\n\x07\x45xports\x12\n\n\x02\x65\x61\x18\x01 \x02(\r\x12\x0b\n\x03ord\x18\x02 \x02(\r\x12\x0c\n\x04name\x18\x03 \x01(\t\x1ak\n\x07Section\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\n\n\x02va\x18\x02 \x01(\r\x12\x0e\n\x06v_size\x18\x03 \x01(\r\x12\x0b\n\x03raw\x18\x04 \x01(\r\x12\x10\n\x08raw_size\x18\x05 \x01(\r\x12\x17\n\x0f\x63haracteristics\x18\x06 \x01(\r')
+  serialized_pb=_b('\n\trpc.proto\x12\x03rpc\"\xe3\x04\n\nRpcRequest\x12\x31\n\x0crequest_type\x18\x01 \x02(\x0e\x32\x1b.rpc.RpcRequest.RequestType\x12-\n\x0emake_names_req\x18\x02 \x01(\x0b\x32\x15.rpc.MakeNamesRequest\x12\x33\n\x11make_comments_req\x18\x03 \x01(\x0b\x32\x18.rpc.MakeCommentsRequest\x12>\n\x17read_memory_regions_req\x18\x04 \x01(\x0b\x32\x1d.rpc.ReadMemoryRegionsRequest\x12\x42\n\x19\x61nalyze_external_refs_req\x18\x05 \x01(\x0b\x32\x1f.rpc.AnalyzeExternalRefsRequest\x12\x38\n\x14\x63heck_pe_headers_req\x18\x06 \x01(\x0b\x32\x1a.rpc.CheckPEHeadersRequest\x12+\n\rget_names_req\x18\x07 \x01(\x0b\x32\x14.rpc.GetNamesRequest\"\xd2\x01\n\x0bRequestType\x12\x10\n\x0cRPCT_UNKNOWN\x10\x00\x12\x13\n\x0fRPCT_MAKE_NAMES\x10\x01\x12\x16\n\x12RPCT_MAKE_COMMENTS\x10\x02\x12\x17\n\x13RPCT_GET_MEMORY_MAP\x10\x03\x12\x1c\n\x18RPCT_READ_MEMORY_REGIONS\x10\x04\x12\x1e\n\x1aRPCT_ANALYZE_EXTERNAL_REFS\x10\x05\x12\x19\n\x15RPCT_CHECK_PE_HEADERS\x10\x06\x12\x12\n\x0eRPCT_GET_NAMES\x10\x07\">\n\nRelocation\x12\r\n\x05start\x18\x01 \x02(\r\x12\x0b\n\x03\x65nd\x18\x02 \x02(\r\x12\x14\n\x0cremote_start\x18\x03 \x02(\r\"q\n\x05Hello\x12\x18\n\x10protocol_version\x18\x01 \x02(\r\x12\x18\n\x10labeless_version\x18\x02 \x01(\t\x12\x0e\n\x06\x63odecs\x18\x03 \x01(\r\x12$\n\x0brelocations\x18\x04 \x03(\x0b\x32\x0f.rpc.Relocation\"\xa7\x01\n\x07\x45xecute\x12\x0e\n\x06script\x18\x01 \x01(\t\x12\x19\n\x11script_extern_obj\x18\x02 \x01(\t\x12\x13\n\x0brpc_request\x18\x03 \x01(\x0c\x12\x19\n\nbackground\x18\x04 \x01(\x08:\x05\x66\x61lse\x12\x0e\n\x06job_id\x18\x05 \x01(\x04\x12\x12\n\nrequest_id\x18\x06 \x01(\x04\x12\x1d\n\x15script_extern_marshal\x18\x07 \x01(\x0c\"\xce\x01\n\x08Response\x12\x0e\n\x06job_id\x18\x01 \x02(\x04\x12\x0f\n\x07std_out\x18\x02 \x01(\t\x12\x0f\n\x07std_err\x18\x03 \x01(\t\x12\r\n\x05\x65rror\x18\x04 \x01(\t\x12\x12\n\nrpc_result\x18\x05 \x01(\x0c\x12+\n\njob_status\x18\x06 \x01(\x0e\x32\x17.rpc.Response.JobStatus\x12\x12\n\nrequest_id\x18\x07 \x01(\x04\",\n\tJobStatus\x12\x0f\n\x0bJS_FINISHED\x10\x01\x12\x0e\n\nJS_PENDING\x10\x02\"j\n\x0bPackedNames\x12\x15\n\tea_deltas\x18\x01 \x03(\rB\x02\x10\x01\x12\x18\n\x0cshared_sizes\x18\x02 \x03(\rB\x02\x10\x01\x12\x18\n\x0csuffix_sizes\x18\x03 \x03(\rB\x02\x10\x01\x12\x10\n\x08suffixes\x18\x04 \x01(\x0c\"\xaa\x01\n\x10MakeNamesRequest\x12)\n\x05names\x18\x01 \x03(\x0b\x32\x1a.rpc.MakeNamesRequest.Name\x12\x0c\n\x04\x62\x61se\x18\x02 \x02(\r\x12\x13\n\x0bremote_base\x18\x03 \x02(\r\x12&\n\x0cpacked_names\x18\x04 \x01(\x0b\x32\x10.rpc.PackedNames\x1a \n\x04Name\x12\n\n\x02\x65\x61\x18\x01 \x02(\r\x12\x0c\n\x04name\x18\x02 \x02(\t\"\xb0\x01\n\x13MakeCommentsRequest\x12,\n\x05names\x18\x01 \x03(\x0b\x32\x1d.rpc.MakeCommentsRequest.Name\x12\x0c\n\x04\x62\x61se\x18\x02 \x02(\r\x12\x13\n\x0bremote_base\x18\x03 \x02(\r\x12&\n\x0cpacked_names\x18\x04 \x01(\x0b\x32\x10.rpc.PackedNames\x1a \n\x04Name\x12\n\n\x02\x65\x61\x18\x01 \x02(\r\x12\x0c\n\x04name\x18\x02 \x02(\t\"~\n\x0fGetNamesRequest\x12\x0c\n\x04\x62\x61se\x18\x01 \x02(\r\x12\x13\n\x0bremote_base\x18\x02 \x02(\r\x12\r\n\x05start\x18\x03 \x02(\r\x12\x0b\n\x03\x65nd\x18\x04 \x02(\r\x12\x14\n\x06labels\x18\x05 \x01(\x08:\x04true\x12\x16\n\x08\x63omments\x18\x06 \x01(\x08:\x04true\"s\n\x0eGetNamesResult\x12\'\n\x05names\x18\x01 \x03(\x0b\x32\x18.rpc.GetNamesResult.Name\x1a\x38\n\x04Name\x12\x10\n\x08\x65\x61_delta\x18\x01 \x02(\r\x12\r\n\x05label\x18\x02 \x01(\t\x12\x0f\n\x07\x63omment\x18\x03 \x01(\t\"\x8a\x01\n\x12GetMemoryMapResult\x12\x30\n\x08memories\x18\x01 \x03(\x0b\x32\x1e.rpc.GetMemoryMapResult.Memory\x1a\x42\n\x06Memory\x12\x0c\n\x04\x62\x61se\x18\x01 \x02(\r\x12\x0c\n\x04size\x18\x02 \x02(\r\x12\x0e\n\x06\x61\x63\x63\x65ss\x18\x03 \x02(\r\x12\x0c\n\x04name\x18\x04 \x02(\t\"\xa4\x01\n\x18ReadMemoryRegionsRequest\x12\x35\n\x07regions\x18\x01 \x03(\x0b\x32$.rpc.ReadMemoryRegionsRequest.Region\x12\x12\n\nchunk_size\x18\x02 \x01(\r\x1a=\n\x06Region\x12\x0c\n\x04\x61\x64\x64r\x18\x01 \x02(\r\x12\x0c\n\x04size\x18\x02 \x02(\r\x12\x17\n\x0bpage_hashes\x18\x03 \x03(\x06\x42\x02\x10\x01\"\xac\x01\n\x17ReadMemoryRegionsResult\x12\x35\n\x08memories\x18\x01 \x03(\x0b\x32#.rpc.ReadMemoryRegionsResult.Memory\x1aZ\n\x06Memory\x12\x0c\n\x04\x61\x64\x64r\x18\x01 \x02(\r\x12\x0c\n\x04size\x18\x02 \x02(\r\x12\x0b\n\x03mem\x18\x03 \x02(\x0c\x12\x0f\n\x07protect\x18\x04 \x02(\r\x12\x16\n\x0eunchanged_size\x18\x05 \x01(\r\"C\n\x0bOutputChunk\x12\x12\n\nrequest_id\x18\x01 \x01(\x04\x12\x0f\n\x07std_out\x18\x02 \x01(\t\x12\x0f\n\x07std_err\x18\x03 \x01(\t\"U\n\x0bMemoryChunk\x12\x12\n\nrequest_id\x18\x01 \x01(\x04\x12\x14\n\x0cregion_index\x18\x02 \x02(\r\x12\x0e\n\x06offset\x18\x03 \x02(\r\x12\x0c\n\x04\x64\x61ta\x18\x04 \x02(\x0c\"\x7f\n\x1a\x41nalyzeExternalRefsRequest\x12\x0f\n\x07\x65\x61_from\x18\x01 \x02(\r\x12\r\n\x05\x65\x61_to\x18\x02 \x02(\r\x12\x11\n\tincrement\x18\x03 \x02(\r\x12\x16\n\x0e\x61nalysing_base\x18\x04 \x02(\r\x12\x16\n\x0e\x61nalysing_size\x18\x05 \x02(\r\"\xac\x05\n\x19\x41nalyzeExternalRefsResult\x12\x41\n\rapi_constants\x18\x01 \x03(\x0b\x32*.rpc.AnalyzeExternalRefsResult.PointerData\x12\x34\n\x04refs\x18\x02 \x03(\x0b\x32&.rpc.AnalyzeExternalRefsResult.RefData\x12\x35\n\x07\x63ontext\x18\x03 \x02(\x0b\x32$.rpc.AnalyzeExternalRefsResult.reg_t\x1a[\n\x0bPointerData\x12\n\n\x02\x65\x61\x18\x01 \x02(\r\x12\x0e\n\x06module\x18\x02 \x02(\t\x12\x0c\n\x04proc\x18\x03 \x02(\t\x12\"\n\x1aordinal_collision_dll_path\x18\x04 \x01(\t\x1a\x83\x02\n\x07RefData\x12\n\n\x02\x65\x61\x18\x01 \x02(\r\x12\x0b\n\x03len\x18\x02 \x02(\r\x12\x0b\n\x03\x64is\x18\x03 \x02(\t\x12\t\n\x01v\x18\x04 \x02(\r\x12@\n\x08ref_type\x18\x05 \x02(\x0e\x32..rpc.AnalyzeExternalRefsResult.RefData.RefType\x12\x0e\n\x06module\x18\x06 \x02(\t\x12\x0c\n\x04proc\x18\x07 \x02(\t\x12\"\n\x1aordinal_collision_dll_path\x18\x08 \x01(\t\"C\n\x07RefType\x12\x11\n\rREFT_JMPCONST\x10\x01\x12\x11\n\rREFT_IMMCONST\x10\x02\x12\x12\n\x0eREFT_ADDRCONST\x10\x03\x1a|\n\x05reg_t\x12\x0b\n\x03\x65\x61x\x18\x01 \x02(\r\x12\x0b\n\x03\x65\x63x\x18\x02 \x02(\r\x12\x0b\n\x03\x65\x64x\x18\x03 \x02(\r\x12\x0b\n\x03\x65\x62x\x18\x04 \x02(\r\x12\x0b\n\x03\x65sp\x18\x05 \x02(\r\x12\x0b\n\x03\x65\x62p\x18\x06 \x02(\r\x12\x0b\n\x03\x65si\x18\x07 \x02(\r\x12\x0b\n\x03\x65\x64i\x18\x08 \x02(\r\x12\x0b\n\x03\x65ip\x18\t \x02(\r\"3\n\x15\x43heckPEHeadersRequest\x12\x0c\n\x04\x62\x61se\x18\x01 \x02(\r\x12\x0c\n\x04size\x18\x02 \x02(\r\"\xad\x02\n\x14\x43heckPEHeadersResult\x12\x10\n\x08pe_valid\x18\x01 \x02(\x08\x12/\n\x04\x65xps\x18\x02 \x03(\x0b\x32!.rpc.CheckPEHeadersResult.Exports\x12\x33\n\x08sections\x18\x03 \x03(\x0b\x32!.rpc.CheckPEHeadersResult.Section\x1a\x30\n\x07\x45xports\x12\n\n\x02\x65\x61\x18\x01 \x02(\r\x12\x0b\n\x03ord\x18\x02 \x02(\r\x12\x0c\n\x04name\x18\x03 \x01(\t\x1ak\n\x07Section\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\n\n\x02va\x18\x02 \x01(\r\x12\x0e\n\x06v_size\x18\x03 \x01(\r\x12\x0b\n\x03raw\x18\x04 \x01(\r\x12\x10\n\x08raw_size\x18\x05 \x01(\r\x12\x17\n\x0f\x63haracteristics\x18\x06 \x01(\r')
 )
 _sym_db.RegisterFileDescriptor(DESCRIPTOR)
 
@@ -58,11 +58,15 @@ _RPCREQUEST_REQUESTTYPE = _descriptor.EnumDescriptor(
       name='RPCT_CHECK_PE_HEADERS', index=6, number=6,
       options=None,
       type=None),
+    _descriptor.EnumValueDescriptor(
+      name='RPCT_GET_NAMES', index=7, number=7,
+      options=None,
+      type=None),
   ],
   containing_type=None,
   options=None,
-  serialized_start=375,
-  serialized_end=565,
+  serialized_start=420,
+  serialized_end=630,
 )
 _sym_db.RegisterEnumDescriptor(_RPCREQUEST_REQUESTTYPE)
 
@@ -83,8 +87,8 @@ _RESPONSE_JOBSTATUS = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=828,
-  serialized_end=872,
+  serialized_start=1144,
+  serialized_end=1188,
 )
 _sym_db.RegisterEnumDescriptor(_RESPONSE_JOBSTATUS)
 
@@ -109,8 +113,8 @@ _ANALYZEEXTERNALREFSRESULT_REFDATA_REFTYPE = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=2180,
-  serialized_end=2247,
+  serialized_start=3155,
+  serialized_end=3222,
 )
 _sym_db.RegisterEnumDescriptor(_ANALYZEEXTERNALREFSRESULT_REFDATA_REFTYPE)
 
@@ -164,6 +168,13 @@ _RPCREQUEST = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
+    _descriptor.FieldDescriptor(
+      name='get_names_req', full_name='rpc.RpcRequest.get_names_req', index=6,
+      number=7, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
   ],
   extensions=[
   ],
@@ -177,7 +188,102 @@ _RPCREQUEST = _descriptor.Descriptor(
   oneofs=[
   ],
   serialized_start=19,
-  serialized_end=565,
+  serialized_end=630,
+)
+
+
+_RELOCATION = _descriptor.Descriptor(
+  name='Relocation',
+  full_name='rpc.Relocation',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='start', full_name='rpc.Relocation.start', index=0,
+      number=1, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='end', full_name='rpc.Relocation.end', index=1,
+      number=2, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='remote_start', full_name='rpc.Relocation.remote_start', index=2,
+      number=3, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=632,
+  serialized_end=694,
+)
+
+
+_HELLO = _descriptor.Descriptor(
+  name='Hello',
+  full_name='rpc.Hello',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='protocol_version', full_name='rpc.Hello.protocol_version', index=0,
+      number=1, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='labeless_version', full_name='rpc.Hello.labeless_version', index=1,
+      number=2, type=9, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b("").decode('utf-8'),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='codecs', full_name='rpc.Hello.codecs', index=2,
+      number=3, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='relocations', full_name='rpc.Hello.relocations', index=3,
+      number=4, type=11, cpp_type=10, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=696,
+  serialized_end=809,
 )
 
 
@@ -223,6 +329,20 @@ _EXECUTE = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
+    _descriptor.FieldDescriptor(
+      name='request_id', full_name='rpc.Execute.request_id', index=5,
+      number=6, type=4, cpp_type=4, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='script_extern_marshal', full_name='rpc.Execute.script_extern_marshal', index=6,
+      number=7, type=12, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
   ],
   extensions=[
   ],
@@ -234,8 +354,8 @@ _EXECUTE = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=567,
-  serialized_end=683,
+  serialized_start=812,
+  serialized_end=979,
 )
 
 
@@ -288,6 +408,13 @@ _RESPONSE = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
+    _descriptor.FieldDescriptor(
+      name='request_id', full_name='rpc.Response.request_id', index=6,
+      number=7, type=4, cpp_type=4, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
   ],
   extensions=[
   ],
@@ -300,8 +427,59 @@ _RESPONSE = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=686,
-  serialized_end=872,
+  serialized_start=982,
+  serialized_end=1188,
+)
+
+
+_PACKEDNAMES = _descriptor.Descriptor(
+  name='PackedNames',
+  full_name='rpc.PackedNames',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='ea_deltas', full_name='rpc.PackedNames.ea_deltas', index=0,
+      number=1, type=13, cpp_type=3, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\020\001'))),
+    _descriptor.FieldDescriptor(
+      name='shared_sizes', full_name='rpc.PackedNames.shared_sizes', index=1,
+      number=2, type=13, cpp_type=3, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\020\001'))),
+    _descriptor.FieldDescriptor(
+      name='suffix_sizes', full_name='rpc.PackedNames.suffix_sizes', index=2,
+      number=3, type=13, cpp_type=3, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\020\001'))),
+    _descriptor.FieldDescriptor(
+      name='suffixes', full_name='rpc.PackedNames.suffixes', index=3,
+      number=4, type=12, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=1190,
+  serialized_end=1296,
 )
 
 
@@ -337,8 +515,8 @@ _MAKENAMESREQUEST_NAME = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=973,
-  serialized_end=1005,
+  serialized_start=1437,
+  serialized_end=1469,
 )
 
 _MAKENAMESREQUEST = _descriptor.Descriptor(
@@ -369,6 +547,13 @@ _MAKENAMESREQUEST = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
+    _descriptor.FieldDescriptor(
+      name='packed_names', full_name='rpc.MakeNamesRequest.packed_names', index=3,
+      number=4, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
   ],
   extensions=[
   ],
@@ -380,8 +565,8 @@ _MAKENAMESREQUEST = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=875,
-  serialized_end=1005,
+  serialized_start=1299,
+  serialized_end=1469,
 )
 
 
@@ -417,8 +602,8 @@ _MAKECOMMENTSREQUEST_NAME = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=973,
-  serialized_end=1005,
+  serialized_start=1437,
+  serialized_end=1469,
 )
 
 _MAKECOMMENTSREQUEST = _descriptor.Descriptor(
@@ -449,6 +634,13 @@ _MAKECOMMENTSREQUEST = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
+    _descriptor.FieldDescriptor(
+      name='packed_names', full_name='rpc.MakeCommentsRequest.packed_names', index=3,
+      number=4, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
   ],
   extensions=[
   ],
@@ -460,8 +652,146 @@ _MAKECOMMENTSREQUEST = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1008,
-  serialized_end=1144,
+  serialized_start=1472,
+  serialized_end=1648,
+)
+
+
+_GETNAMESREQUEST = _descriptor.Descriptor(
+  name='GetNamesRequest',
+  full_name='rpc.GetNamesRequest',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='base', full_name='rpc.GetNamesRequest.base', index=0,
+      number=1, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='remote_base', full_name='rpc.GetNamesRequest.remote_base', index=1,
+      number=2, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='start', full_name='rpc.GetNamesRequest.start', index=2,
+      number=3, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='end', full_name='rpc.GetNamesRequest.end', index=3,
+      number=4, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='labels', full_name='rpc.GetNamesRequest.labels', index=4,
+      number=5, type=8, cpp_type=7, label=1,
+      has_default_value=True, default_value=True,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='comments', full_name='rpc.GetNamesRequest.comments', index=5,
+      number=6, type=8, cpp_type=7, label=1,
+      has_default_value=True, default_value=True,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=1650,
+  serialized_end=1776,
+)
+
+
+_GETNAMESRESULT_NAME = _descriptor.Descriptor(
+  name='Name',
+  full_name='rpc.GetNamesResult.Name',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='ea_delta', full_name='rpc.GetNamesResult.Name.ea_delta', index=0,
+      number=1, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='label', full_name='rpc.GetNamesResult.Name.label', index=1,
+      number=2, type=9, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b("").decode('utf-8'),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='comment', full_name='rpc.GetNamesResult.Name.comment', index=2,
+      number=3, type=9, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b("").decode('utf-8'),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=1837,
+  serialized_end=1893,
+)
+
+_GETNAMESRESULT = _descriptor.Descriptor(
+  name='GetNamesResult',
+  full_name='rpc.GetNamesResult',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='names', full_name='rpc.GetNamesResult.names', index=0,
+      number=1, type=11, cpp_type=10, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[_GETNAMESRESULT_NAME, ],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=1778,
+  serialized_end=1893,
 )
 
 
@@ -511,8 +841,8 @@ _GETMEMORYMAPRESULT_MEMORY = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1219,
-  serialized_end=1285,
+  serialized_start=1968,
+  serialized_end=2034,
 )
 
 _GETMEMORYMAPRESULT = _descriptor.Descriptor(
@@ -540,8 +870,8 @@ _GETMEMORYMAPRESULT = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1147,
-  serialized_end=1285,
+  serialized_start=1896,
+  serialized_end=2034,
 )
 
 
@@ -566,6 +896,13 @@ _READMEMORYREGIONSREQUEST_REGION = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
+    _descriptor.FieldDescriptor(
+      name='page_hashes', full_name='rpc.ReadMemoryRegionsRequest.Region.page_hashes', index=2,
+      number=3, type=6, cpp_type=4, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\020\001'))),
   ],
   extensions=[
   ],
@@ -577,8 +914,8 @@ _READMEMORYREGIONSREQUEST_REGION = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1370,
-  serialized_end=1406,
+  serialized_start=2140,
+  serialized_end=2201,
 )
 
 _READMEMORYREGIONSREQUEST = _descriptor.Descriptor(
@@ -595,6 +932,13 @@ _READMEMORYREGIONSREQUEST = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
+    _descriptor.FieldDescriptor(
+      name='chunk_size', full_name='rpc.ReadMemoryRegionsRequest.chunk_size', index=1,
+      number=2, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
   ],
   extensions=[
   ],
@@ -606,8 +950,8 @@ _READMEMORYREGIONSREQUEST = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1287,
-  serialized_end=1406,
+  serialized_start=2037,
+  serialized_end=2201,
 )
 
 
@@ -646,6 +990,13 @@ _READMEMORYREGIONSRESULT_MEMORY = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
+    _descriptor.FieldDescriptor(
+      name='unchanged_size', full_name='rpc.ReadMemoryRegionsResult.Memory.unchanged_size', index=4,
+      number=5, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
   ],
   extensions=[
   ],
@@ -657,8 +1008,8 @@ _READMEMORYREGIONSRESULT_MEMORY = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1491,
-  serialized_end=1557,
+  serialized_start=2286,
+  serialized_end=2376,
 )
 
 _READMEMORYREGIONSRESULT = _descriptor.Descriptor(
@@ -686,8 +1037,103 @@ _READMEMORYREGIONSRESULT = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1409,
-  serialized_end=1557,
+  serialized_start=2204,
+  serialized_end=2376,
+)
+
+
+_OUTPUTCHUNK = _descriptor.Descriptor(
+  name='OutputChunk',
+  full_name='rpc.OutputChunk',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='request_id', full_name='rpc.OutputChunk.request_id', index=0,
+      number=1, type=4, cpp_type=4, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='std_out', full_name='rpc.OutputChunk.std_out', index=1,
+      number=2, type=9, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b("").decode('utf-8'),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='std_err', full_name='rpc.OutputChunk.std_err', index=2,
+      number=3, type=9, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b("").decode('utf-8'),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=2378,
+  serialized_end=2445,
+)
+
+
+_MEMORYCHUNK = _descriptor.Descriptor(
+  name='MemoryChunk',
+  full_name='rpc.MemoryChunk',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='request_id', full_name='rpc.MemoryChunk.request_id', index=0,
+      number=1, type=4, cpp_type=4, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='region_index', full_name='rpc.MemoryChunk.region_index', index=1,
+      number=2, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='offset', full_name='rpc.MemoryChunk.offset', index=2,
+      number=3, type=13, cpp_type=3, label=2,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='data', full_name='rpc.MemoryChunk.data', index=3,
+      number=4, type=12, cpp_type=9, label=2,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=2447,
+  serialized_end=2532,
 )
 
 
@@ -744,8 +1190,8 @@ _ANALYZEEXTERNALREFSREQUEST = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1559,
-  serialized_end=1686,
+  serialized_start=2534,
+  serialized_end=2661,
 )
 
 
@@ -795,8 +1241,8 @@ _ANALYZEEXTERNALREFSRESULT_POINTERDATA = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1894,
-  serialized_end=1985,
+  serialized_start=2869,
+  serialized_end=2960,
 )
 
 _ANALYZEEXTERNALREFSRESULT_REFDATA = _descriptor.Descriptor(
@@ -874,8 +1320,8 @@ _ANALYZEEXTERNALREFSRESULT_REFDATA = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1988,
-  serialized_end=2247,
+  serialized_start=2963,
+  serialized_end=3222,
 )
 
 _ANALYZEEXTERNALREFSRESULT_REG_T = _descriptor.Descriptor(
@@ -959,8 +1405,8 @@ _ANALYZEEXTERNALREFSRESULT_REG_T = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=2249,
-  serialized_end=2373,
+  serialized_start=3224,
+  serialized_end=3348,
 )
 
 _ANALYZEEXTERNALREFSRESULT = _descriptor.Descriptor(
@@ -1002,8 +1448,8 @@ _ANALYZEEXTERNALREFSRESULT = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1689,
-  serialized_end=2373,
+  serialized_start=2664,
+  serialized_end=3348,
 )
 
 
@@ -1039,8 +1485,8 @@ _CHECKPEHEADERSREQUEST = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=2375,
-  serialized_end=2426,
+  serialized_start=3350,
+  serialized_end=3401,
 )
 
 
@@ -1083,8 +1529,8 @@ _CHECKPEHEADERSRESULT_EXPORTS = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=2573,
-  serialized_end=2621,
+  serialized_start=3548,
+  serialized_end=3596,
 )
 
 _CHECKPEHEADERSRESULT_SECTION = _descriptor.Descriptor(
@@ -1147,8 +1593,8 @@ _CHECKPEHEADERSRESULT_SECTION = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=2623,
-  serialized_end=2730,
+  serialized_start=3598,
+  serialized_end=3705,
 )
 
 _CHECKPEHEADERSRESULT = _descriptor.Descriptor(
@@ -1190,8 +1636,8 @@ _CHECKPEHEADERSRESULT = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=2429,
-  serialized_end=2730,
+  serialized_start=3404,
+  serialized_end=3705,
 )
 
 _RPCREQUEST.fields_by_name['request_type'].enum_type = _RPCREQUEST_REQUESTTYPE
@@ -1200,13 +1646,19 @@ _RPCREQUEST.fields_by_name['make_comments_req'].message_type = _MAKECOMMENTSREQU
 _RPCREQUEST.fields_by_name['read_memory_regions_req'].message_type = _READMEMORYREGIONSREQUEST
 _RPCREQUEST.fields_by_name['analyze_external_refs_req'].message_type = _ANALYZEEXTERNALREFSREQUEST
 _RPCREQUEST.fields_by_name['check_pe_headers_req'].message_type = _CHECKPEHEADERSREQUEST
+_RPCREQUEST.fields_by_name['get_names_req'].message_type = _GETNAMESREQUEST
 _RPCREQUEST_REQUESTTYPE.containing_type = _RPCREQUEST
+_HELLO.fields_by_name['relocations'].message_type = _RELOCATION
 _RESPONSE.fields_by_name['job_status'].enum_type = _RESPONSE_JOBSTATUS
 _RESPONSE_JOBSTATUS.containing_type = _RESPONSE
 _MAKENAMESREQUEST_NAME.containing_type = _MAKENAMESREQUEST
 _MAKENAMESREQUEST.fields_by_name['names'].message_type = _MAKENAMESREQUEST_NAME
+_MAKENAMESREQUEST.fields_by_name['packed_names'].message_type = _PACKEDNAMES
 _MAKECOMMENTSREQUEST_NAME.containing_type = _MAKECOMMENTSREQUEST
 _MAKECOMMENTSREQUEST.fields_by_name['names'].message_type = _MAKECOMMENTSREQUEST_NAME
+_MAKECOMMENTSREQUEST.fields_by_name['packed_names'].message_type = _PACKEDNAMES
+_GETNAMESRESULT_NAME.containing_type = _GETNAMESRESULT
+_GETNAMESRESULT.fields_by_name['names'].message_type = _GETNAMESRESULT_NAME
 _GETMEMORYMAPRESULT_MEMORY.containing_type = _GETMEMORYMAPRESULT
 _GETMEMORYMAPRESULT.fields_by_name['memories'].message_type = _GETMEMORYMAPRESULT_MEMORY
 _READMEMORYREGIONSREQUEST_REGION.containing_type = _READMEMORYREGIONSREQUEST
@@ -1226,13 +1678,20 @@ _CHECKPEHEADERSRESULT_SECTION.containing_type = _CHECKPEHEADERSRESULT
 _CHECKPEHEADERSRESULT.fields_by_name['exps'].message_type = _CHECKPEHEADERSRESULT_EXPORTS
 _CHECKPEHEADERSRESULT.fields_by_name['sections'].message_type = _CHECKPEHEADERSRESULT_SECTION
 DESCRIPTOR.message_types_by_name['RpcRequest'] = _RPCREQUEST
+DESCRIPTOR.message_types_by_name['Relocation'] = _RELOCATION
+DESCRIPTOR.message_types_by_name['Hello'] = _HELLO
 DESCRIPTOR.message_types_by_name['Execute'] = _EXECUTE
 DESCRIPTOR.message_types_by_name['Response'] = _RESPONSE
+DESCRIPTOR.message_types_by_name['PackedNames'] = _PACKEDNAMES
 DESCRIPTOR.message_types_by_name['MakeNamesRequest'] = _MAKENAMESREQUEST
 DESCRIPTOR.message_types_by_name['MakeCommentsRequest'] = _MAKECOMMENTSREQUEST
+DESCRIPTOR.message_types_by_name['GetNamesRequest'] = _GETNAMESREQUEST
+DESCRIPTOR.message_types_by_name['GetNamesResult'] = _GETNAMESRESULT
 DESCRIPTOR.message_types_by_name['GetMemoryMapResult'] = _GETMEMORYMAPRESULT
 DESCRIPTOR.message_types_by_name['ReadMemoryRegionsRequest'] = _READMEMORYREGIONSREQUEST
 DESCRIPTOR.message_types_by_name['ReadMemoryRegionsResult'] = _READMEMORYREGIONSRESULT
+DESCRIPTOR.message_types_by_name['OutputChunk'] = _OUTPUTCHUNK
+DESCRIPTOR.message_types_by_name['MemoryChunk'] = _MEMORYCHUNK
 DESCRIPTOR.message_types_by_name['AnalyzeExternalRefsRequest'] = _ANALYZEEXTERNALREFSREQUEST
 DESCRIPTOR.message_types_by_name['AnalyzeExternalRefsResult'] = _ANALYZEEXTERNALREFSRESULT
 DESCRIPTOR.message_types_by_name['CheckPEHeadersRequest'] = _CHECKPEHEADERSREQUEST
@@ -1245,6 +1704,20 @@ RpcRequest = _reflection.GeneratedProtocolMessageType('RpcRequest', (_message.Me
   ))
 _sym_db.RegisterMessage(RpcRequest)
 
+Relocation = _reflection.GeneratedProtocolMessageType('Relocation', (_message.Message,), dict(
+  DESCRIPTOR = _RELOCATION,
+  __module__ = 'rpc_pb2'
+  # @@protoc_insertion_point(class_scope:rpc.Relocation)
+  ))
+_sym_db.RegisterMessage(Relocation)
+
+Hello = _reflection.GeneratedProtocolMessageType('Hello', (_message.Message,), dict(
+  DESCRIPTOR = _HELLO,
+  __module__ = 'rpc_pb2'
+  # @@protoc_insertion_point(class_scope:rpc.Hello)
+  ))
+_sym_db.RegisterMessage(Hello)
+
 Execute = _reflection.GeneratedProtocolMessageType('Execute', (_message.Message,), dict(
   DESCRIPTOR = _EXECUTE,
   __module__ = 'rpc_pb2'
@@ -1259,6 +1732,13 @@ Response = _reflection.GeneratedProtocolMessageType('Response', (_message.Messag
   ))
 _sym_db.RegisterMessage(Response)
 
+PackedNames = _reflection.GeneratedProtocolMessageType('PackedNames', (_message.Message,), dict(
+  DESCRIPTOR = _PACKEDNAMES,
+  __module__ = 'rpc_pb2'
+  # @@protoc_insertion_point(class_scope:rpc.PackedNames)
+  ))
+_sym_db.RegisterMessage(PackedNames)
+
 MakeNamesRequest = _reflection.GeneratedProtocolMessageType('MakeNamesRequest', (_message.Message,), dict(
 
   Name = _reflection.GeneratedProtocolMessageType('Name', (_message.Message,), dict(
@@ -1289,6 +1769,28 @@ MakeCommentsRequest = _reflection.GeneratedProtocolMessageType('MakeCommentsRequ
 _sym_db.RegisterMessage(MakeCommentsRequest)
 _sym_db.RegisterMessage(MakeCommentsRequest.Name)
 
+GetNamesRequest = _reflection.GeneratedProtocolMessageType('GetNamesRequest', (_message.Message,), dict(
+  DESCRIPTOR = _GETNAMESREQUEST,
+  __module__ = 'rpc_pb2'
+  # @@protoc_insertion_point(class_scope:rpc.GetNamesRequest)
+  ))
+_sym_db.RegisterMessage(GetNamesRequest)
+
+GetNamesResult = _reflection.GeneratedProtocolMessageType('GetNamesResult', (_message.Message,), dict(
+
+  Name = _reflection.GeneratedProtocolMessageType('Name', (_message.Message,), dict(
+    DESCRIPTOR = _GETNAMESRESULT_NAME,
+    __module__ = 'rpc_pb2'
+    # @@protoc_insertion_point(class_scope:rpc.GetNamesResult.Name)
+    ))
+  ,
+  DESCRIPTOR = _GETNAMESRESULT,
+  __module__ = 'rpc_pb2'
+  # @@protoc_insertion_point(class_scope:rpc.GetNamesResult)
+  ))
+_sym_db.RegisterMessage(GetNamesResult)
+_sym_db.RegisterMessage(GetNamesResult.Name)
+
 GetMemoryMapResult = _reflection.GeneratedProtocolMessageType('GetMemoryMapResult', (_message.Message,), dict(
 
   Memory = _reflection.GeneratedProtocolMessageType('Memory', (_message.Message,), dict(
@@ -1334,6 +1836,20 @@ ReadMemoryRegionsResult = _reflection.GeneratedProtocolMessageType('ReadMemoryRe
 _sym_db.RegisterMessage(ReadMemoryRegionsResult)
 _sym_db.RegisterMessage(ReadMemoryRegionsResult.Memory)
 
+OutputChunk = _reflection.GeneratedProtocolMessageType('OutputChunk', (_message.Message,), dict(
+  DESCRIPTOR = _OUTPUTCHUNK,
+  __module__ = 'rpc_pb2'
+  # @@protoc_insertion_point(class_scope:rpc.OutputChunk)
+  ))
+_sym_db.RegisterMessage(OutputChunk)
+
+MemoryChunk = _reflection.GeneratedProtocolMessageType('MemoryChunk', (_message.Message,), dict(
+  DESCRIPTOR = _MEMORYCHUNK,
+  __module__ = 'rpc_pb2'
+  # @@protoc_insertion_point(class_scope:rpc.MemoryChunk)
+  ))
+_sym_db.RegisterMessage(MemoryChunk)
+
 AnalyzeExternalRefsRequest = _reflection.GeneratedProtocolMessageType('AnalyzeExternalRefsRequest', (_message.Message,), dict(
   DESCRIPTOR = _ANALYZEEXTERNALREFSREQUEST,
   __module__ = 'rpc_pb2'
@@ -1403,4 +1919,12 @@ _sym_db.RegisterMessage(CheckPEHeadersResult.Exports)
 _sym_db.RegisterMessage(CheckPEHeadersResult.Section)
 
 
+_PACKEDNAMES.fields_by_name['ea_deltas'].has_options = True
+_PACKEDNAMES.fields_by_name['ea_deltas']._options = _descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\020\001'))
+_PACKEDNAMES.fields_by_name['shared_sizes'].has_options = True
+_PACKEDNAMES.fields_by_name['shared_sizes']._options = _descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\020\001'))
+_PACKEDNAMES.fields_by_name['suffix_sizes'].has_options = True
+_PACKEDNAMES.fields_by_name['suffix_sizes']._options = _descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\020\001'))
+_READMEMORYREGIONSREQUEST_REGION.fields_by_name['page_hashes'].has_options = True
+_READMEMORYREGIONSREQUEST_REGION.fields_by_name['page_hashes']._options = _descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\020\001'))
 # @@protoc_insertion_point(module_scope)
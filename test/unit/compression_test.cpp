@@ -0,0 +1,261 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#include "testing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string.h>
+#include "../../common/compression.h"
+
+using namespace compression;
+
+namespace {
+
+std::string randomBytes(size_t size, unsigned seed)
+{
+	std::mt19937 rng(seed);
+	std::string rv(size, '\0');
+	for (size_t i = 0; i < size; ++i)
+		rv[i] = static_cast<char>(rng());
+	return rv;
+}
+
+// looks like a code section: short repeated instruction patterns mixed with unique immediates
+std::string codeLikeBytes(size_t size, unsigned seed)
+{
+	static const char* const kPatterns[] = {
+		"\x55\x8B\xEC\x83\xEC", "\x8B\x45\x08", "\xFF\x15", "\xE8", "\x5D\xC3", "\x33\xC0\x40", "\x6A\x00"
+	};
+	std::mt19937 rng(seed);
+	std::string rv;
+	rv.reserve(size);
+	while (rv.size() < size)
+	{
+		rv += kPatterns[rng() % (sizeof(kPatterns) / sizeof(kPatterns[0]))];
+		const uint32_t imm = rng() % 0x1000 + 0x401000;
+		rv.append(reinterpret_cast<const char*>(&imm), sizeof(imm));
+	}
+	rv.resize(size);
+	return rv;
+}
+
+// a file next to the test sources, test/unit/../name
+std::string readTestFile(const char* name)
+{
+	std::string path = __FILE__;
+	const size_t slash = path.find_last_of("/\\");
+	path = (slash == std::string::npos ? std::string() : path.substr(0, slash + 1)) + "../" + name;
+	std::ifstream f(path.c_str(), std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+}
+
+template <typename T>
+T readAt(const std::string& data, size_t offset)
+{
+	T rv = T();
+	if (offset + sizeof(rv) <= data.size())
+		memcpy(&rv, data.data() + offset, sizeof(rv));
+	return rv;
+}
+
+struct Section
+{
+	std::string	name;
+	size_t		start; // within the image
+	size_t		size;
+};
+
+// the PE file laid out as the loader maps it, which is what a module dump reads. Empty if the file isn't a PE
+std::string mapImage(const std::string& file, std::vector<Section>& sections)
+{
+	sections.clear();
+	const uint32_t pe = readAt<uint32_t>(file, 0x3C);
+	if (readAt<uint16_t>(file, 0) != 0x5A4D || readAt<uint32_t>(file, pe) != 0x4550)
+		return std::string();
+	const uint16_t count = readAt<uint16_t>(file, pe + 6);
+	const uint16_t optSize = readAt<uint16_t>(file, pe + 20);
+	const uint32_t imageSize = readAt<uint32_t>(file, pe + 24 + 56);
+	const uint32_t headersSize = readAt<uint32_t>(file, pe + 24 + 60);
+	if (!imageSize || imageSize > 256 * 1024 * 1024 || headersSize > file.size())
+		return std::string();
+
+	std::string rv(imageSize, '\0');
+	rv.replace(0, headersSize, file, 0, headersSize);
+	for (uint16_t i = 0; i < count; ++i)
+	{
+		const size_t sh = pe + 24 + optSize + i * 40;
+		char name[9] = {};
+		memcpy(name, file.data() + std::min(sh, file.size()), std::min<size_t>(8, file.size() - std::min(sh, file.size())));
+		const uint32_t virtualSize = readAt<uint32_t>(file, sh + 8);
+		const uint32_t va = readAt<uint32_t>(file, sh + 12);
+		const uint32_t rawSize = readAt<uint32_t>(file, sh + 16);
+		const uint32_t rawOffset = readAt<uint32_t>(file, sh + 20);
+		if (va >= imageSize)
+			continue;
+		const size_t size = std::min<size_t>(virtualSize ? virtualSize : rawSize, imageSize - va);
+		const size_t raw = std::min<size_t>(std::min<size_t>(rawSize, size), rawOffset < file.size() ? file.size() - rawOffset : 0);
+		rv.replace(va, raw, file, rawOffset, raw);
+		const Section s = { name, va, size };
+		sections.push_back(s);
+	}
+	return rv;
+}
+
+bool roundTrip(const std::string& payload)
+{
+	std::string packed;
+	if (!pack(CODEC_LZ, payload, packed))
+		return false;
+	std::string unpacked;
+	return unpack(CODEC_LZ, packed.data(), packed.size(), unpacked) && unpacked == payload;
+}
+
+} // anonymous
+
+TEST(compression_choose)
+{
+	CHECK_EQ(CODEC_LZ, choose(supportedCodecs()));
+	CHECK_EQ(CODEC_None, choose(0));
+	CHECK_EQ(CODEC_None, choose(codecMask(CODEC_None)));
+}
+
+TEST(compression_small_payload_is_not_packed)
+{
+	std::string packed = "garbage";
+	CHECK(!pack(CODEC_LZ, std::string(kMinPackSize - 1, 'a'), packed));
+	CHECK(packed.empty());
+	CHECK(!pack(CODEC_None, std::string(1024 * 1024, 'a'), packed));
+}
+
+TEST(compression_incompressible_payload_is_not_packed)
+{
+	std::string packed;
+	CHECK(!pack(CODEC_LZ, randomBytes(256 * 1024, 1), packed));
+}
+
+TEST(compression_round_trip)
+{
+	CHECK(roundTrip(std::string(kMinPackSize, '\0')));
+	CHECK(roundTrip(std::string(1024 * 1024, 'x'))); // long overlapped matches
+	CHECK(roundTrip(codeLikeBytes(300 * 1024, 2)));
+
+	// the literal and match lengths crossing the 15 and 15 + 255 boundaries
+	for (size_t litLen = 14; litLen <= 16 + 255; litLen += 1)
+	{
+		std::string payload = randomBytes(litLen, static_cast<unsigned>(litLen));
+		while (payload.size() < kMinPackSize * 2)
+			payload += std::string(litLen + 3, 'z') + randomBytes(litLen, static_cast<unsigned>(payload.size()));
+		std::string packed;
+		std::string unpacked;
+		if (pack(CODEC_LZ, payload, packed))
+			CHECK(unpack(CODEC_LZ, packed.data(), packed.size(), unpacked) && unpacked == payload);
+	}
+
+	// a match right at the end leaves an empty last sequence
+	std::string tail = randomBytes(kMinPackSize, 3);
+	tail += tail;
+	CHECK(roundTrip(tail));
+}
+
+TEST(compression_unpack_none)
+{
+	std::string payload;
+	CHECK(unpack(CODEC_None, "abc", 3, payload));
+	CHECK_EQ(std::string("abc"), payload);
+}
+
+TEST(compression_unpack_rejects_malformed)
+{
+	const std::string payload = codeLikeBytes(64 * 1024, 4);
+	std::string packed;
+	CHECK(pack(CODEC_LZ, payload, packed));
+
+	std::string unpacked;
+	CHECK(!unpack(CODEC_LZ, packed.data(), 3, unpacked)); // no size
+	CHECK(!unpack(CODEC_LZ, packed.data(), packed.size() / 2, unpacked)); // truncated
+	CHECK(!unpack(static_cast<Codec>(7), packed.data(), packed.size(), unpacked));
+
+	std::string wrongSize = packed;
+	wrongSize[0] = static_cast<char>(wrongSize[0] + 1);
+	CHECK(!unpack(CODEC_LZ, wrongSize.data(), wrongSize.size(), unpacked));
+
+	std::string huge = packed;
+	const uint32_t hugeSize = 0xFFFFFFFF;
+	huge.replace(0, sizeof(hugeSize), reinterpret_cast<const char*>(&hugeSize), sizeof(hugeSize));
+	CHECK(!unpack(CODEC_LZ, huge.data(), huge.size(), unpacked));
+
+	// an offset pointing before the start of the output
+	std::string badOffset;
+	const uint32_t rawSize = 8;
+	badOffset.append(reinterpret_cast<const char*>(&rawSize), sizeof(rawSize));
+	badOffset += "\x10" "a" "\x05\x00";
+	badOffset.push_back('\0');
+	CHECK(!unpack(CODEC_LZ, badOffset.data(), badOffset.size(), unpacked));
+}
+
+TEST(compression_pe_image_round_trip)
+{
+	std::vector<Section> sections;
+	const std::string image = mapImage(readTestFile("OLLYDBG.EXE"), sections);
+	CHECK(!image.empty());
+	CHECK(!sections.empty());
+	CHECK(roundTrip(image));
+}
+
+BENCH(compression_throughput)
+{
+	struct Sample
+	{
+		std::string	name;
+		std::string	data;
+	};
+	std::vector<Sample> samples;
+	const Sample generated[] = {
+		{ "zeroes", std::string(32 * 1024 * 1024, '\0') },
+		{ "code-like", codeLikeBytes(32 * 1024 * 1024, 5) },
+		{ "random", randomBytes(32 * 1024 * 1024, 6) }
+	};
+	samples.assign(generated, generated + sizeof(generated) / sizeof(generated[0]));
+
+	// a real module as Labeless dumps it: the whole image and each of its sections
+	std::vector<Section> sections;
+	const std::string image = mapImage(readTestFile("OLLYDBG.EXE"), sections);
+	CHECK(!image.empty());
+	const Sample whole = { "OLLYDBG.EXE", image };
+	samples.push_back(whole);
+	for (auto it = sections.cbegin(); it != sections.cend(); ++it)
+	{
+		const Sample s = { "  " + it->name, image.substr(it->start, it->size) };
+		samples.push_back(s);
+	}
+
+	typedef std::chrono::high_resolution_clock Clock;
+	for (size_t i = 0; i < samples.size(); ++i)
+	{
+		const Sample& s = samples[i];
+		std::string packed;
+		const Clock::time_point t0 = Clock::now();
+		const bool isPacked = pack(CODEC_LZ, s.data, packed);
+		const Clock::time_point t1 = Clock::now();
+		std::string unpacked;
+		const bool isUnpacked = isPacked && unpack(CODEC_LZ, packed.data(), packed.size(), unpacked);
+		const Clock::time_point t2 = Clock::now();
+		CHECK(!isPacked || (isUnpacked && unpacked == s.data));
+
+		const double mb = s.data.size() / (1024.0 * 1024.0);
+		const double packSec = std::chrono::duration<double>(t1 - t0).count();
+		const double unpackSec = std::chrono::duration<double>(t2 - t1).count();
+		printf("  %-12s %7.2f MiB -> %7.2f MiB (%s), pack %7.1f MiB/s, unpack %7.1f MiB/s\n",
+			s.name.c_str(), mb, (isPacked ? packed.size() : s.data.size()) / (1024.0 * 1024.0), isPacked ? "packed" : "as is",
+			packSec > 0 ? mb / packSec : 0.0, isPacked && unpackSec > 0 ? mb / unpackSec : 0.0);
+	}
+}
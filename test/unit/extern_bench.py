@@ -0,0 +1,81 @@
+# -*- coding: utf-8 -*
+# Labeless
+# by Aliaksandr Trafimchuk
+#
+# Source code released under
+# Creative Commons BY-NC 4.0
+# http://creativecommons.org/licenses/by-nc/4.0
+
+""" Compares the ways __extern__ travels from IDA to OllyDbg, run by: python extern_bench.py [size_mb ...]
+
+json:    json.dumps() in IDA, rpc::Execute::script_extern_obj, json.loads() in OllyDbg
+marshal: marshal.dumps() in IDA, rpc::Execute::script_extern_marshal, marshal.loads() in OllyDbg (protocol 6)
+base64:  marshal.dumps() in IDA, the script prologue ExecPyScript::serialize makes for the older peers
+"""
+
+import binascii
+import json
+import marshal
+import sys
+import time
+
+
+def make_extern(size):
+    """ What the scripts pass: a list of records of the addresses, names and bytes, about size bytes of JSON """
+    rv = []
+    total = 0
+    i = 0
+    while total < size:
+        ea = 0x401000 + i * 0x10
+        item = {'ea': ea, 'name': 'sub_%X' % ea, 'xrefs': [ea + 5, ea + 0x20, ea - 0x100],
+                'bytes': '%08X558BEC83EC10' % i, 'size': 0x10}
+        rv.append(item)
+        total += 120  # about the JSON of one item
+        i += 1
+    return {'module': 'target.exe', 'base': 0x400000, 'functions': rv}
+
+
+def timed(f, *args):
+    t0 = time.time()
+    rv = f(*args)
+    return rv, (time.time() - t0) * 1000.0
+
+
+def run_prologue(encoded):
+    """ ExecPyScript::serialize for the peers older than kBinaryExternProtocolVersion """
+    scope = {}
+    exec ("__extern__ = __import__('marshal').loads(__import__('binascii').a2b_base64('" + encoded + "'))\n") in scope
+    return scope['__extern__']
+
+
+def bench(size):
+    ext = make_extern(size)
+
+    wire, dump_ms = timed(json.dumps, ext)
+    loaded, load_ms = timed(json.loads, wire)
+    assert loaded == ext
+    print '  json:    %9u bytes, dumps %8.1f ms, loads %8.1f ms' % (len(wire), dump_ms, load_ms)
+    json_size = len(wire)
+
+    wire, dump_ms = timed(marshal.dumps, ext)
+    loaded, load_ms = timed(marshal.loads, wire)
+    assert loaded == ext
+    print '  marshal: %9u bytes, dumps %8.1f ms, loads %8.1f ms' % (len(wire), dump_ms, load_ms)
+
+    encoded, encode_ms = timed(lambda: binascii.b2a_base64(wire).replace('\n', ''))
+    loaded, load_ms = timed(run_prologue, encoded)
+    assert loaded == ext
+    print '  base64:  %9u bytes, dumps %8.1f ms, loads %8.1f ms (marshal.dumps and base64 encoding, exec of the prologue)' % \
+        (len(encoded), dump_ms + encode_ms, load_ms)
+    return json_size
+
+
+def main():
+    sizes = [float(v) for v in sys.argv[1:]] or [1, 50]
+    for mb in sizes:
+        print '__extern__ of about %g MB of JSON' % mb
+        bench(int(mb * 1024 * 1024))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,36 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#include "testing.h"
+
+#include "../../labeless_ida/sync/externprologue.h"
+
+namespace {
+
+// Python 2.7 marshal.dumps([0x401000, ['sub_401000', 'loc_401010'], None])
+const char kMarshal[] = "[\x03\x00\x00\x00i\x00\x10@\x00[\x02\x00\x00\x00t\n\x00\x00\x00sub_401000"
+	"t\n\x00\x00\x00loc_401010N";
+
+} // anonymous
+
+TEST(externprologue_base64)
+{
+	CHECK_EQ(std::string(), externprologue::base64(std::string()));
+	CHECK_EQ(std::string("YQ=="), externprologue::base64("a"));
+	CHECK_EQ(std::string("YWI="), externprologue::base64("ab"));
+	CHECK_EQ(std::string("YWJj"), externprologue::base64("abc"));
+	CHECK_EQ(std::string("AP8A/w=="), externprologue::base64(std::string("\x00\xFF\x00\xFF", 4)));
+}
+
+// ollyutils_test.py runs the same line and checks the __extern__ it makes
+TEST(externprologue_script)
+{
+	CHECK_EQ(std::string("__extern__ = __import__('marshal').loads(__import__('binascii').a2b_base64("
+		"'WwMAAABpABBAAFsCAAAAdAoAAABzdWJfNDAxMDAwdAoAAABsb2NfNDAxMDEwTg=='))\n"
+		"print __extern__\n"), externprologue::prepend(std::string(kMarshal, sizeof(kMarshal) - 1), "print __extern__\n"));
+}
@@ -0,0 +1,238 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#include "testing.h"
+
+#ifdef _WIN32
+#include <WinSock2.h>
+typedef int socklen_t;
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+typedef int SOCKET;
+static const SOCKET INVALID_SOCKET = -1;
+#define closesocket close
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <string.h>
+#include <thread>
+#include "../../common/netframe.h"
+
+/* Requests per second over the loopback: a connection per request, the way RpcThreadWorker worked before,
+ * against a single connection carrying the pipelined requests. The server answers each FT_Execute frame
+ * with an FT_Response frame of kResponseSize bytes, one frame is a single send() as in both plugins.
+ */
+
+namespace {
+
+static const size_t kRequestSize = 200; // about a small rpc::Execute
+static const size_t kResponseSize = 300;
+
+bool recvAll(SOCKET s, char* buff, size_t len)
+{
+	while (len)
+	{
+		const int read = recv(s, buff, static_cast<int>(len), 0);
+		if (read <= 0)
+			return false;
+		buff += read;
+		len -= read;
+	}
+	return true;
+}
+
+bool sendFrame(SOCKET s, netframe::FrameType type, size_t size)
+{
+	std::string frame(sizeof(netframe::Header) + size, 'p');
+	const netframe::Header h = netframe::makeHeader(type, static_cast<uint32_t>(size));
+	memcpy(&frame[0], &h, sizeof(h));
+	return send(s, frame.data(), static_cast<int>(frame.size()), 0) == static_cast<int>(frame.size());
+}
+
+bool recvFrame(SOCKET s, std::string& payload)
+{
+	netframe::Header h = {};
+	if (!recvAll(s, reinterpret_cast<char*>(&h), sizeof(h)) || !netframe::isValid(h))
+		return false;
+	payload.resize(h.size);
+	return payload.empty() || recvAll(s, &payload[0], payload.size());
+}
+
+// a single thread serving the connections one after an other, like Labeless Olly does with its server thread
+class Server
+{
+public:
+	Server()
+		: m_Listen(socket(AF_INET, SOCK_STREAM, IPPROTO_TCP))
+		, m_Port(0)
+		, m_Stop(false)
+	{
+		sockaddr_in addr = {};
+		addr.sin_family = AF_INET;
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		socklen_t len = sizeof(addr);
+		if (m_Listen == INVALID_SOCKET || bind(m_Listen, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) ||
+			listen(m_Listen, 128) || getsockname(m_Listen, reinterpret_cast<sockaddr*>(&addr), &len))
+			return;
+		m_Port = ntohs(addr.sin_port);
+		m_Thread = std::thread([this]() { serve(); });
+	}
+
+	~Server()
+	{
+		m_Stop = true;
+		if (m_Thread.joinable())
+		{
+			SOCKET s = connectTo(m_Port); // wakes accept() up
+			if (s != INVALID_SOCKET)
+				closesocket(s);
+			m_Thread.join();
+		}
+		if (m_Listen != INVALID_SOCKET)
+			closesocket(m_Listen);
+	}
+
+	unsigned short port() const { return m_Port; }
+
+	static SOCKET connectTo(unsigned short port)
+	{
+		SOCKET s = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+		sockaddr_in addr = {};
+		addr.sin_family = AF_INET;
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		addr.sin_port = htons(port);
+		if (s != INVALID_SOCKET && connect(s, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)))
+		{
+			closesocket(s);
+			s = INVALID_SOCKET;
+		}
+		return s;
+	}
+
+private:
+	void serve()
+	{
+		std::string payload;
+		while (!m_Stop)
+		{
+			SOCKET s = accept(m_Listen, nullptr, nullptr);
+			if (s == INVALID_SOCKET)
+				continue;
+			while (!m_Stop && recvFrame(s, payload) && sendFrame(s, netframe::FT_Response, kResponseSize))
+				;
+			closesocket(s);
+		}
+	}
+
+	SOCKET				m_Listen;
+	unsigned short		m_Port;
+	std::atomic<bool>	m_Stop;
+	std::thread			m_Thread;
+};
+
+typedef std::chrono::high_resolution_clock Clock;
+
+double perSecond(size_t count, Clock::time_point from)
+{
+	const double sec = std::chrono::duration<double>(Clock::now() - from).count();
+	return sec > 0 ? count / sec : 0;
+}
+
+// connect, send the request, wait for the response, close
+bool connectionPerRequest(unsigned short port, size_t count)
+{
+	std::string payload;
+	for (size_t i = 0; i < count; ++i)
+	{
+		const SOCKET s = Server::connectTo(port);
+		if (s == INVALID_SOCKET)
+			return false;
+		const bool ok = sendFrame(s, netframe::FT_Execute, kRequestSize) && recvFrame(s, payload);
+		closesocket(s);
+		if (!ok)
+			return false;
+	}
+	return true;
+}
+
+// up to window requests in flight over a single connection, window 1 is a plain request-response
+bool persistent(unsigned short port, size_t count, size_t window)
+{
+	const SOCKET s = Server::connectTo(port);
+	if (s == INVALID_SOCKET)
+		return false;
+	std::string payload;
+	size_t sent = 0;
+	size_t received = 0;
+	bool ok = true;
+	while (ok && received < count)
+	{
+		while (ok && sent < count && sent - received < window)
+		{
+			ok = sendFrame(s, netframe::FT_Execute, kRequestSize);
+			++sent;
+		}
+		ok = ok && recvFrame(s, payload);
+		++received;
+	}
+	closesocket(s);
+	return ok;
+}
+
+#ifdef _WIN32
+struct WsaInit
+{
+	WsaInit() { WSADATA wd = {}; WSAStartup(MAKEWORD(2, 2), &wd); }
+	~WsaInit() { WSACleanup(); }
+};
+#else
+struct WsaInit
+{
+	WsaInit() {}
+};
+#endif
+
+} // anonymous
+
+TEST(loopback_round_trip)
+{
+	const WsaInit wsa;
+	Server server;
+	CHECK(server.port() != 0);
+	CHECK(connectionPerRequest(server.port(), 3));
+	CHECK(persistent(server.port(), 10, 1));
+	CHECK(persistent(server.port(), 100, 16));
+}
+
+BENCH(loopback_requests_per_second)
+{
+	static const size_t kCount = 5000;
+	const WsaInit wsa;
+	Server server;
+	CHECK(server.port() != 0);
+
+	Clock::time_point t0 = Clock::now();
+	CHECK(connectionPerRequest(server.port(), kCount));
+	printf("  connection per request:      %8.0f requests/s\n", perSecond(kCount, t0));
+
+	t0 = Clock::now();
+	CHECK(persistent(server.port(), kCount, 1));
+	printf("  persistent, one in flight:   %8.0f requests/s\n", perSecond(kCount, t0));
+
+	static const size_t kWindows[] = { 8, 64 };
+	for (size_t i = 0; i < sizeof(kWindows) / sizeof(kWindows[0]); ++i)
+	{
+		t0 = Clock::now();
+		CHECK(persistent(server.port(), kCount, kWindows[i]));
+		printf("  persistent, %2u in flight:    %8.0f requests/s\n", unsigned(kWindows[i]), perSecond(kCount, t0));
+	}
+}
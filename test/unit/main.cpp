@@ -0,0 +1,43 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#include "testing.h"
+
+#include <string.h>
+
+// labeless_tests [--bench] [name substring]
+int main(int argc, char* argv[])
+{
+	bool bench = false;
+	const char* filter = nullptr;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!strcmp(argv[i], "--bench"))
+			bench = true;
+		else
+			filter = argv[i];
+	}
+
+	unsigned run = 0;
+	unsigned failed = 0;
+	const std::vector<testing::Case>& cases = testing::cases();
+	for (auto it = cases.cbegin(); it != cases.cend(); ++it)
+	{
+		if (it->bench != bench || (filter && !strstr(it->name, filter)))
+			continue;
+		const unsigned before = testing::failures();
+		it->fn();
+		++run;
+		const bool ok = before == testing::failures();
+		if (!ok)
+			++failed;
+		printf("%-48s %s\n", it->name, ok ? "ok" : "FAILED");
+	}
+	printf("%u of %u %s passed\n", run - failed, run, bench ? "benchmark(s)" : "test(s)");
+	return static_cast<int>(failed);
+}
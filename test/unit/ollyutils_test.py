@@ -0,0 +1,142 @@
+# -*- coding: utf-8 -*
+# Labeless
+# by Aliaksandr Trafimchuk
+#
+# Source code released under
+# Creative Commons BY-NC 4.0
+# http://creativecommons.org/licenses/by-nc/4.0
+
+""" Tests of the ollyutils helpers which need no OllyDbg, run by: python ollyutils_test.py [-v] """
+
+import os
+import sys
+import types
+import unittest
+
+
+class Stub(types.ModuleType):
+    """ Any attribute of it is 0 """
+    def __getattr__(self, name):
+        return 0
+
+# ollyutils imports the OllyDbg bindings at the module level, the helpers under test don't use them
+for _name in ('ollyapi', 'pehelper', 'pehelper_decl', 'logs', 'rpc_pb2', 'py_olly'):
+    sys.modules.setdefault(_name, Stub(_name))
+sys.modules['pehelper'].PEHelper = object
+sys.modules['logs'].make_logger = lambda *args, **kwargs: None
+try:
+    from ctypes import wintypes
+except (ImportError, ValueError):
+    import ctypes
+    ctypes.wintypes = sys.modules['ctypes.wintypes'] = Stub('ctypes.wintypes')
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.realpath(__file__)), '..', 'python'))
+import ollyutils as U
+
+PAGE = U.MEMORY_PAGE_SIZE
+
+
+class PackedNames(object):
+    def __init__(self):
+        self.ea_deltas = []
+        self.shared_sizes = []
+        self.suffix_sizes = []
+        self.suffixes = ''
+
+
+class NamesRequest(object):
+    """ MakeNamesRequest or MakeCommentsRequest, packed only """
+    def __init__(self, packed):
+        self.packed_names = packed
+        self.names = []
+
+    def HasField(self, name):
+        return name == 'packed_names'
+
+
+def pack_names(names):
+    """ Same coding as packednames::Writer of Labeless IDA """
+    rv = PackedNames()
+    prev_ea = 0
+    prev = ''
+    for ea, name in names:
+        shared = 0
+        while shared < min(len(prev), len(name)) and prev[shared] == name[shared]:
+            shared += 1
+        rv.ea_deltas.append((ea - prev_ea) & 0xFFFFFFFF)
+        rv.shared_sizes.append(shared)
+        rv.suffix_sizes.append(len(name) - shared)
+        rv.suffixes += name[shared:]
+        prev_ea, prev = ea, name
+    return rv
+
+
+class ChangedPageRunsTest(unittest.TestCase):
+    def setUp(self):
+        self.pages = [chr(0x41 + i) * PAGE for i in range(6)]
+        self.hashes = [U.memory_page_hash(p) for p in self.pages]
+
+    def test_no_hashes(self):
+        data = ''.join(self.pages)
+        self.assertEqual(U.changed_page_runs(data, 0, None), ([(0, len(data))], 0))
+
+    def test_unchanged(self):
+        data = ''.join(self.pages)
+        self.assertEqual(U.changed_page_runs(data, 0, self.hashes), ([], len(data)))
+
+    def test_runs(self):
+        pages = list(self.pages)
+        for i in (1, 2, 4):
+            pages[i] = 'x' * PAGE
+        data = ''.join(pages)
+        self.assertEqual(U.changed_page_runs(data, 0, self.hashes),
+                         ([(PAGE, 3 * PAGE), (4 * PAGE, 5 * PAGE)], 3 * PAGE))
+
+    def test_offset_and_short_tail(self):
+        # a chunk starting at the page 2 and ending within the page 5, which is never the same
+        data = ''.join(self.pages[2:5]) + 'F' * 0x10
+        self.assertEqual(U.changed_page_runs(data, 2 * PAGE, self.hashes), ([(3 * PAGE, len(data))], 3 * PAGE))
+
+    def test_beyond_hashes(self):
+        data = ''.join(self.pages) + 'G' * PAGE
+        self.assertEqual(U.changed_page_runs(data, 0, self.hashes), ([(6 * PAGE, 7 * PAGE)], 6 * PAGE))
+
+
+class RequestNamesTest(unittest.TestCase):
+    NAMES = [(0x401000, 'sub_401000'), (0x401010, 'sub_401010'), (0x401010, 'sub_401010_again'),
+             (0x401020, ''), (0x401030, 'loc_401030'), (0xFFFFFFF0, 'loc_401030'), (0xFFFFFFFF, 'x\0y')]
+
+    def test_round_trip(self):
+        self.assertEqual(U.request_names(NamesRequest(pack_names(self.NAMES))), self.NAMES)
+
+    def test_empty(self):
+        self.assertEqual(U.request_names(NamesRequest(pack_names([]))), [])
+
+    def test_rejects_malformed(self):
+        def corrupt(f):
+            packed = pack_names(self.NAMES)
+            f(packed)
+            return NamesRequest(packed)
+
+        for req in (corrupt(lambda p: p.shared_sizes.pop()),
+                    corrupt(lambda p: p.shared_sizes.__setitem__(0, 1)),
+                    corrupt(lambda p: p.suffix_sizes.__setitem__(-1, p.suffix_sizes[-1] + 1)),
+                    corrupt(lambda p: setattr(p, 'suffixes', p.suffixes + 'tail'))):
+            self.assertRaises(ValueError, U.request_names, req)
+
+
+class ExternPrologueTest(unittest.TestCase):
+    """ The first line of the script ExecPyScript::serialize makes for the peers older than protocol 6,
+    the same as externprologue_test.cpp expects """
+    PROLOGUE = ("__extern__ = __import__('marshal').loads(__import__('binascii').a2b_base64("
+                "'WwMAAABpABBAAFsCAAAAdAoAAABzdWJfNDAxMDAwdAoAAABsb2NfNDAxMDEwTg=='))\n")
+
+    def test_sets_extern(self):
+        scope = {}
+        exec (self.PROLOGUE + "names = __extern__[1]\n") in scope
+        self.assertEqual(scope['__extern__'], [0x401000, ['sub_401000', 'loc_401010'], None])
+        self.assertEqual(scope['names'], ['sub_401000', 'loc_401010'])
+
+
+if __name__ == '__main__':
+    unittest.main()
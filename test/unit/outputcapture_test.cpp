@@ -0,0 +1,43 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#include "testing.h"
+
+#include "../../labeless_olly/outputcapture.h"
+
+TEST(outputcapture_limit)
+{
+	OutputCapture out;
+	CHECK(out.append("abc", 3, 8));
+	CHECK(out.append("", 0, 8));
+	CHECK(!out.append("abcd", 4, 8)); // 5 + 5 bytes
+	CHECK(out.append("ab", 2, 8));
+	CHECK_EQ(std::string("abc\n\nab\n"), out.text);
+	CHECK_EQ(8u, out.size);
+	CHECK_EQ(5u, out.dropped);
+}
+
+TEST(outputcapture_zero_is_unlimited)
+{
+	OutputCapture out;
+	const std::string line(1024 * 1024, 'x');
+	for (int i = 0; i < 8; ++i)
+		CHECK(out.append(line.data(), line.size(), 0));
+	CHECK_EQ(8 * (line.size() + 1), out.text.size());
+	CHECK_EQ(out.text.size(), out.size);
+	CHECK_EQ(0u, out.dropped);
+}
+
+TEST(outputcapture_streamed_text_counts)
+{
+	OutputCapture out;
+	CHECK(out.append("abc", 3, 6));
+	out.text.clear(); // streamed by an FT_OutputChunk
+	CHECK(!out.append("abc", 3, 6));
+	CHECK(out.text.empty());
+}
@@ -0,0 +1,198 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#include "testing.h"
+
+#include <chrono>
+#include <utility>
+#include "../../common/packednames.h"
+#include "rpc.pb.h"
+
+namespace {
+
+// the part of rpc::PackedNames used by packednames
+struct FakePacked
+{
+	std::vector<uint32_t>	eaDeltas;
+	std::vector<uint32_t>	sharedSizes;
+	std::vector<uint32_t>	suffixSizes;
+	std::string				suffixesData;
+
+	void add_ea_deltas(uint32_t v) { eaDeltas.push_back(v); }
+	void add_shared_sizes(uint32_t v) { sharedSizes.push_back(v); }
+	void add_suffix_sizes(uint32_t v) { suffixSizes.push_back(v); }
+	std::string* mutable_suffixes() { return &suffixesData; }
+
+	int ea_deltas_size() const { return static_cast<int>(eaDeltas.size()); }
+	int shared_sizes_size() const { return static_cast<int>(sharedSizes.size()); }
+	int suffix_sizes_size() const { return static_cast<int>(suffixSizes.size()); }
+	uint32_t ea_deltas(int i) const { return eaDeltas[i]; }
+	uint32_t shared_sizes(int i) const { return sharedSizes[i]; }
+	uint32_t suffix_sizes(int i) const { return suffixSizes[i]; }
+	const std::string& suffixes() const { return suffixesData; }
+};
+
+typedef std::vector<std::pair<uint32_t, std::string>> Names;
+
+FakePacked packAll(const Names& names)
+{
+	FakePacked rv;
+	packednames::Writer<FakePacked> writer(&rv);
+	for (auto it = names.cbegin(); it != names.cend(); ++it)
+		writer.add(it->first, it->second);
+	return rv;
+}
+
+bool unpackAll(const FakePacked& packed, Names& names)
+{
+	names.clear();
+	return packednames::forEach(packed, [&names](uint32_t ea, const std::string& name) {
+		names.push_back(std::make_pair(ea, name));
+	});
+}
+
+// what sync makes of a module: sub_/loc_ names, a few imports and the user's names
+Names syntheticNames(size_t count)
+{
+	Names rv;
+	rv.reserve(count);
+	uint32_t ea = 0x401000;
+	char buff[64] = {};
+	for (size_t i = 0; i < count; ++i)
+	{
+		ea += 0x10 + (i * 7) % 0x40;
+		switch (i % 4)
+		{
+		case 0: sprintf(buff, "sub_%X", ea); break;
+		case 1: sprintf(buff, "loc_%X", ea); break;
+		case 2: sprintf(buff, "kernel32_CreateFileW_%u", unsigned(i)); break;
+		default: sprintf(buff, "CMainFrame::OnCommand_%u", unsigned(i)); break;
+		}
+		rv.push_back(std::make_pair(ea, std::string(buff)));
+	}
+	return rv;
+}
+
+} // anonymous
+
+TEST(packednames_round_trip)
+{
+	Names names;
+	names.push_back(std::make_pair(0x401000u, std::string("sub_401000")));
+	names.push_back(std::make_pair(0x401010u, std::string("sub_401010")));
+	names.push_back(std::make_pair(0x401010u, std::string("sub_401010_again"))); // the same address twice
+	names.push_back(std::make_pair(0x401020u, std::string()));
+	names.push_back(std::make_pair(0x401030u, std::string("loc_401030")));
+	names.push_back(std::make_pair(0xFFFFFFF0u, std::string("loc_401030"))); // the same name
+	names.push_back(std::make_pair(0xFFFFFFFFu, std::string("x\0y", 3)));
+
+	const FakePacked packed = packAll(names);
+	CHECK_EQ(names.size(), packed.eaDeltas.size());
+	CHECK_EQ(0u, packed.sharedSizes[0]);
+	CHECK_EQ(8u, packed.sharedSizes[1]); // "sub_4010"
+	CHECK_EQ(10u, packed.sharedSizes[2]);
+	CHECK_EQ(10u, packed.sharedSizes[5]);
+	CHECK_EQ(0u, packed.suffixSizes[5]);
+
+	Names unpacked;
+	CHECK(unpackAll(packed, unpacked));
+	CHECK(unpacked == names);
+}
+
+TEST(packednames_empty)
+{
+	const FakePacked packed = packAll(Names());
+	Names unpacked;
+	CHECK(unpackAll(packed, unpacked));
+	CHECK(unpacked.empty());
+}
+
+TEST(packednames_rejects_malformed)
+{
+	const FakePacked good = packAll(syntheticNames(16));
+	Names unpacked;
+
+	FakePacked p = good;
+	p.sharedSizes.pop_back(); // the columns differ in size
+	CHECK(!unpackAll(p, unpacked));
+
+	p = good;
+	p.sharedSizes[0] = 1; // nothing to share with
+	CHECK(!unpackAll(p, unpacked));
+
+	p = good;
+	p.suffixSizes.back() += 1; // out of suffixes
+	CHECK(!unpackAll(p, unpacked));
+
+	p = good;
+	p.suffixesData += "tail"; // not consumed
+	CHECK(!unpackAll(p, unpacked));
+}
+
+BENCH(packednames_make_names_request)
+{
+	static const size_t kCount = 200 * 1000;
+	const Names names = syntheticNames(kCount);
+	typedef std::chrono::high_resolution_clock Clock;
+	const auto ms = [](Clock::time_point from, Clock::time_point to) {
+		return std::chrono::duration<double, std::milli>(to - from).count();
+	};
+
+	// the repeated MakeNamesRequest.Name sent to the peers older than kPackedNamesProtocolVersion
+	const Clock::time_point t0 = Clock::now();
+	rpc::MakeNamesRequest plain;
+	plain.set_base(0x400000);
+	plain.set_remote_base(0x400000);
+	plain.mutable_names()->Reserve(static_cast<int>(kCount));
+	for (auto it = names.cbegin(); it != names.cend(); ++it)
+	{
+		rpc::MakeNamesRequest::Name* n = plain.add_names();
+		n->set_ea(it->first);
+		n->set_name(it->second);
+	}
+	const std::string plainWire = plain.SerializeAsString();
+	const Clock::time_point t1 = Clock::now();
+	Names plainNames;
+	rpc::MakeNamesRequest plainParsed;
+	CHECK(plainParsed.ParseFromString(plainWire));
+	plainNames.reserve(plainParsed.names_size());
+	for (int i = 0; i < plainParsed.names_size(); ++i)
+		plainNames.push_back(std::make_pair(plainParsed.names(i).ea(), plainParsed.names(i).name()));
+	const Clock::time_point t2 = Clock::now();
+
+	// PackedNames, as sync.cpp writes it and labeless_olly reads it
+	rpc::MakeNamesRequest packed;
+	packed.set_base(0x400000);
+	packed.set_remote_base(0x400000);
+	rpc::PackedNames* columns = packed.mutable_packed_names();
+	columns->mutable_ea_deltas()->Reserve(static_cast<int>(kCount));
+	columns->mutable_shared_sizes()->Reserve(static_cast<int>(kCount));
+	columns->mutable_suffix_sizes()->Reserve(static_cast<int>(kCount));
+	packednames::Writer<rpc::PackedNames> writer(columns);
+	for (auto it = names.cbegin(); it != names.cend(); ++it)
+		writer.add(it->first, it->second);
+	const std::string packedWire = packed.SerializeAsString();
+	const Clock::time_point t3 = Clock::now();
+	Names packedNames;
+	packedNames.reserve(kCount);
+	rpc::MakeNamesRequest packedParsed;
+	CHECK(packedParsed.ParseFromString(packedWire));
+	CHECK(packednames::forEach(packedParsed.packed_names(), [&packedNames](uint32_t ea, const std::string& name) {
+		packedNames.push_back(std::make_pair(ea, name));
+	}));
+	const Clock::time_point t4 = Clock::now();
+
+	CHECK(plainNames == names);
+	CHECK(packedNames == names);
+	printf("  %u names, encode is filling the message and serializing it, decode is parsing it and taking the names\n",
+		unsigned(kCount));
+	printf("  repeated Name: %8u bytes, encode %6.1f ms, decode %6.1f ms\n",
+		unsigned(plainWire.size()), ms(t0, t1), ms(t1, t2));
+	printf("  PackedNames:   %8u bytes (%.1f%%), encode %6.1f ms, decode %6.1f ms\n",
+		unsigned(packedWire.size()), 100.0 * packedWire.size() / plainWire.size(), ms(t2, t3), ms(t3, t4));
+}
@@ -0,0 +1,161 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#include "testing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <sstream>
+#include <stdlib.h>
+#include <string.h>
+#include "../../common/recvbuffer.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// the heap calls of the whole process are counted, the benchmark compares the counters around the receive loops
+static std::atomic<size_t> gAllocations(0);
+static std::atomic<size_t> gAllocatedBytes(0);
+
+void* operator new(size_t size)
+{
+	++gAllocations;
+	gAllocatedBytes += size;
+	if (void* p = malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) throw()
+{
+	free(p);
+}
+
+namespace {
+
+size_t peakRss()
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS pmc = {};
+	return GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)) ? pmc.PeakWorkingSetSize : 0;
+#else
+	rusage ru = {};
+	return getrusage(RUSAGE_SELF, &ru) ? 0 : size_t(ru.ru_maxrss) * 1024;
+#endif
+}
+
+// a socket delivers a frame by pieces of up to this size
+static const size_t kRecvPiece = 64 * 1024;
+
+// responses of a session: mostly small ones and a memory dump every 8th
+size_t frameSize(size_t i)
+{
+	return i % 8 == 7 ? 48 * 1024 * 1024 : 1024 * 1024 + i * 4096;
+}
+
+unsigned checksum(const char* data, size_t size)
+{
+	unsigned rv = 0;
+	for (size_t i = 0; i < size; i += 4096)
+		rv += static_cast<unsigned char>(data[i]);
+	return rv;
+}
+
+} // anonymous
+
+TEST(recvbuffer_keeps_capacity)
+{
+	std::string buff;
+	recvbuffer::Stats stats;
+	CHECK(recvbuffer::resize(buff, 1024 * 1024, stats));
+	CHECK_EQ(1u, stats.growths);
+	recvbuffer::release(buff);
+	CHECK(buff.capacity() >= 1024 * 1024);
+
+	CHECK(recvbuffer::resize(buff, 512 * 1024, stats)); // no reallocation
+	CHECK_EQ(1u, stats.growths);
+
+	CHECK(recvbuffer::resize(buff, recvbuffer::kKeptCapacity + 1, stats));
+	CHECK_EQ(2u, stats.growths);
+	CHECK(stats.peak > recvbuffer::kKeptCapacity);
+	recvbuffer::release(buff); // a huge one isn't kept
+	CHECK(buff.capacity() < recvbuffer::kKeptCapacity);
+}
+
+BENCH(recvbuffer_frames)
+{
+	static const size_t kFrames = 64;
+	size_t maxSize = 0;
+	size_t total = 0;
+	for (size_t i = 0; i < kFrames; ++i)
+	{
+		maxSize = std::max(maxSize, frameSize(i));
+		total += frameSize(i);
+	}
+	const std::string wire(maxSize, 'w');
+
+	typedef std::chrono::high_resolution_clock Clock;
+	unsigned sum = 0;
+	printf("  %u frames, %.1f MiB, received by %u KiB pieces\n", unsigned(kFrames), total / (1024.0 * 1024.0),
+		unsigned(kRecvPiece / 1024));
+
+	// the reused buffer of ClientData::netBuff and RpcThreadWorker::m_RecvBuff
+	do {
+		const size_t allocs = gAllocations;
+		const size_t bytes = gAllocatedBytes;
+		const Clock::time_point t0 = Clock::now();
+		std::string buff;
+		recvbuffer::Stats stats;
+		for (size_t i = 0; i < kFrames; ++i)
+		{
+			const size_t size = frameSize(i);
+			CHECK(recvbuffer::resize(buff, size, stats));
+			for (size_t off = 0; off < size; off += kRecvPiece)
+				memcpy(&buff[off], wire.data() + off, std::min(kRecvPiece, size - off));
+			sum += checksum(buff.data(), buff.size());
+			recvbuffer::release(buff);
+		}
+		const double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+		printf("  reused buffer:       %6u allocation(s), %8.1f MiB allocated, %u growth(s), peak 0x%08X, %7.1f ms, peak RSS %.1f MiB\n",
+			unsigned(gAllocations - allocs), (gAllocatedBytes - bytes) / (1024.0 * 1024.0), stats.growths,
+			unsigned(stats.peak), ms, peakRss() / (1024.0 * 1024.0));
+	} while (0);
+
+	// what the receive loops did before: a stringstream appended by each piece, then copied out by str()
+	do {
+		const size_t allocs = gAllocations;
+		const size_t bytes = gAllocatedBytes;
+		const Clock::time_point t0 = Clock::now();
+		for (size_t i = 0; i < kFrames; ++i)
+		{
+			const size_t size = frameSize(i);
+			std::stringstream ss;
+			for (size_t off = 0; off < size; off += kRecvPiece)
+			{
+				const size_t piece = std::min(kRecvPiece, size - off);
+				char* tmp = new char[piece];
+				memcpy(tmp, wire.data() + off, piece);
+				ss.write(tmp, piece);
+				delete[] tmp;
+			}
+			const std::string s = ss.str();
+			sum += checksum(s.data(), s.size());
+		}
+		const double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+		printf("  stringstream + str(): %6u allocation(s), %8.1f MiB allocated, %7.1f ms, peak RSS %.1f MiB\n",
+			unsigned(gAllocations - allocs), (gAllocatedBytes - bytes) / (1024.0 * 1024.0), ms,
+			peakRss() / (1024.0 * 1024.0));
+	} while (0);
+	CHECK(sum != 0);
+}
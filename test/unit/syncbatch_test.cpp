@@ -0,0 +1,308 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#include "testing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <unordered_map>
+#include "../../common/packednames.h"
+#include "../../labeless_ida/sync/syncbatch.h"
+#include "rpc.pb.h"
+
+namespace {
+
+// FuncNameSync::Data and LocalLabelsSync::Data without Qt
+struct Data
+{
+	uint32_t ea;
+	std::string label;
+};
+
+typedef std::vector<Data> DataList;
+typedef std::vector<DataList> Batches;
+
+DataList makeList(size_t count, size_t labelSize)
+{
+	DataList rv;
+	for (size_t i = 0; i < count; ++i)
+	{
+		const Data d = { 0x401000 + uint32_t(i) * 0x10, std::string(labelSize, static_cast<char>('a' + i % 26)) };
+		rv.push_back(d);
+	}
+	return rv;
+}
+
+// the batches are the input in order and within the limits, an item too large goes alone
+bool isValidSplit(const DataList& dl, const Batches& batches, unsigned maxNames, size_t maxBytes)
+{
+	size_t i = 0;
+	for (auto b = batches.cbegin(); b != batches.cend(); ++b)
+	{
+		if (b->empty() || b->size() > maxNames)
+			return false;
+		size_t bytes = 0;
+		for (auto it = b->cbegin(); it != b->cend(); ++it, ++i)
+		{
+			if (i >= dl.size() || it->ea != dl[i].ea || it->label != dl[i].label)
+				return false;
+			bytes += it->label.size() + syncbatch::kItemOverhead;
+		}
+		if (bytes > maxBytes && b->size() > 1)
+			return false;
+	}
+	return i == dl.size();
+}
+
+// the part of the IDA database Labeless::syncronizeAll walks: the flags of every byte and the names
+struct NameDatabase
+{
+	enum { kHasName = 1 };
+
+	uint32_t					start;
+	std::vector<uint8_t>		flags;
+	std::unordered_map<uint32_t, std::string> names;
+	std::unordered_map<uint32_t, uint64_t> journal; // the names acknowledged by the previous sync
+};
+
+uint64_t journalHash(const std::string& text)
+{
+	uint64_t h = 14695981039346656037ULL;
+	for (size_t i = 0; i < text.size(); ++i)
+		h = (h ^ uint8_t(text[i])) * 1099511628211ULL;
+	return h;
+}
+
+NameDatabase makeDatabase(size_t imageSize, size_t count)
+{
+	NameDatabase db;
+	db.start = 0x401000;
+	db.flags.assign(imageSize, 0);
+	char buff[64] = {};
+	for (size_t i = 0; i < count; ++i)
+	{
+		const uint32_t offset = static_cast<uint32_t>((uint64_t(i) * imageSize) / count);
+		const uint32_t ea = db.start + offset;
+		switch (i % 4)
+		{
+		case 0: sprintf(buff, "sub_%X", ea); break;
+		case 1: sprintf(buff, "loc_%X", ea); break;
+		case 2: sprintf(buff, "kernel32_CreateFileW_%u", unsigned(i)); break;
+		default: sprintf(buff, "CMainFrame::OnCommand_%u", unsigned(i)); break;
+		}
+		db.flags[offset] |= NameDatabase::kHasName;
+		db.names[ea] = buff;
+		if (i % 3 == 0)
+			db.journal[ea] = journalHash(buff);
+	}
+	return db;
+}
+
+// hlp::getNextNamedCodeOrDataEA: skips the unnamed bytes by their flags
+uint32_t nextNamed(const NameDatabase& db, uint32_t ea)
+{
+	for (size_t i = ea - db.start + 1; i < db.flags.size(); ++i)
+		if (db.flags[i] & NameDatabase::kHasName)
+			return db.start + static_cast<uint32_t>(i);
+	return 0;
+}
+
+// Labeless::syncronizeAll: every name not in the journal, handed over in batches of maxNames
+template <typename OnBatch>
+void harvest(const NameDatabase& db, unsigned maxNames, OnBatch onBatch)
+{
+	DataList batch;
+	for (uint32_t ea = db.flags[0] & NameDatabase::kHasName ? db.start : nextNamed(db, db.start); ea; ea = nextNamed(db, ea))
+	{
+		const auto name = db.names.find(ea);
+		if (name == db.names.end())
+			continue;
+		const auto synced = db.journal.find(ea);
+		if (synced != db.journal.end() && synced->second == journalHash(name->second))
+			continue;
+		const Data d = { ea, name->second };
+		batch.push_back(d);
+		if (unsigned(batch.size()) >= maxNames)
+		{
+			onBatch(batch);
+			batch.clear();
+		}
+	}
+	if (!batch.empty())
+		onBatch(batch);
+}
+
+// FuncNameSync::serialize for the peers with kPackedNamesProtocolVersion
+std::string serializeBatch(const DataList& dl)
+{
+	std::vector<const Data*> items;
+	items.reserve(dl.size());
+	for (auto it = dl.cbegin(); it != dl.cend(); ++it)
+		items.push_back(&*it);
+	std::stable_sort(items.begin(), items.end(), [](const Data* l, const Data* r) { return l->ea < r->ea; });
+
+	rpc::RpcRequest rpcRequest;
+	rpcRequest.set_request_type(rpc::RpcRequest::RPCT_MAKE_NAMES);
+	rpc::MakeNamesRequest* const request = rpcRequest.mutable_make_names_req();
+	request->set_base(0x400000);
+	request->set_remote_base(0x400000);
+	packednames::Writer<rpc::PackedNames> writer(request->mutable_packed_names());
+	for (auto it = items.cbegin(); it != items.cend(); ++it)
+		writer.add((*it)->ea, (*it)->label);
+	return rpcRequest.SerializeAsString();
+}
+
+} // anonymous
+
+TEST(syncbatch_empty)
+{
+	Batches batches;
+	syncbatch::split(DataList(), 10, 1024, batches);
+	CHECK(batches.empty());
+}
+
+TEST(syncbatch_names_limit)
+{
+	const DataList dl = makeList(25, 4);
+	Batches batches;
+	syncbatch::split(dl, 10, 1024 * 1024, batches);
+	CHECK_EQ(3u, batches.size());
+	CHECK_EQ(10u, batches[0].size());
+	CHECK_EQ(5u, batches[2].size());
+	CHECK(isValidSplit(dl, batches, 10, 1024 * 1024));
+}
+
+TEST(syncbatch_bytes_limit)
+{
+	const DataList dl = makeList(10, 100 - syncbatch::kItemOverhead);
+	Batches batches;
+	syncbatch::split(dl, 1000, 350, batches); // 3 items of 100 bytes fit
+	CHECK_EQ(4u, batches.size());
+	CHECK_EQ(3u, batches[0].size());
+	CHECK_EQ(1u, batches[3].size());
+	CHECK(isValidSplit(dl, batches, 1000, 350));
+}
+
+TEST(syncbatch_large_item_goes_alone)
+{
+	DataList dl = makeList(3, 8);
+	dl[1].label.assign(4096, 'x');
+	Batches batches;
+	syncbatch::split(dl, 1000, 1024, batches);
+	CHECK_EQ(3u, batches.size());
+	CHECK_EQ(1u, batches[1].size());
+	CHECK(isValidSplit(dl, batches, 1000, 1024));
+}
+
+BENCH(syncbatch_split)
+{
+	static const size_t kCount = 500 * 1000;
+	const DataList dl = makeList(kCount, 24);
+
+	typedef std::chrono::high_resolution_clock Clock;
+	const Clock::time_point t0 = Clock::now();
+	Batches batches;
+	syncbatch::split(dl, 1000, 64 * 1024, batches);
+	const Clock::time_point t1 = Clock::now();
+	CHECK(isValidSplit(dl, batches, 1000, 64 * 1024));
+
+	printf("  %u items of %u bytes: %u batch(es) of up to 1000 names / 64 KiB, %.1f ms\n",
+		unsigned(kCount), unsigned(24 + syncbatch::kItemOverhead), unsigned(batches.size()),
+		std::chrono::duration<double, std::milli>(t1 - t0).count());
+}
+
+BENCH(syncbatch_pipeline)
+{
+	static const size_t kImageSize = 32 * 1024 * 1024;
+	static const size_t kCount = 500 * 1000;
+	static const unsigned kMaxNames = 1000;
+	static const size_t kMaxBytes = 64 * 1024;
+	const NameDatabase db = makeDatabase(kImageSize, kCount);
+
+	typedef std::chrono::high_resolution_clock Clock;
+	const auto ms = [](Clock::time_point from, Clock::time_point to) {
+		return std::chrono::duration<double, std::milli>(to - from).count();
+	};
+
+	// everything collected first, then split and serialized
+	Clock::time_point t0 = Clock::now();
+	DataList all;
+	harvest(db, ~0u, [&all](const DataList& batch) { all.insert(all.end(), batch.begin(), batch.end()); });
+	Batches batches;
+	syncbatch::split(all, kMaxNames, kMaxBytes, batches);
+	Clock::time_point firstSent;
+	size_t sequentialBytes = 0;
+	for (auto it = batches.cbegin(); it != batches.cend(); ++it)
+	{
+		sequentialBytes += serializeBatch(*it).size();
+		if (it == batches.cbegin())
+			firstSent = Clock::now();
+	}
+	Clock::time_point t1 = Clock::now();
+	const double sequentialFirst = ms(t0, firstSent);
+	const double sequentialTotal = ms(t0, t1);
+	const size_t sequentialBatches = batches.size();
+
+	// the main thread queues each full batch while the RPC thread serializes the previous ones
+	std::mutex mutex;
+	std::condition_variable cond;
+	std::deque<DataList> queue;
+	bool done = false;
+	size_t pipelinedBytes = 0;
+	size_t pipelinedBatches = 0;
+	size_t pipelinedNames = 0;
+
+	t0 = Clock::now();
+	std::thread rpcThread([&]() {
+		for (;;)
+		{
+			DataList batch;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				cond.wait(lock, [&]() { return done || !queue.empty(); });
+				if (queue.empty())
+					return;
+				batch.swap(queue.front());
+				queue.pop_front();
+			}
+			pipelinedBytes += serializeBatch(batch).size();
+			pipelinedNames += batch.size();
+			if (!pipelinedBatches++)
+				firstSent = Clock::now();
+		}
+	});
+	harvest(db, kMaxNames, [&](const DataList& batch) {
+		Batches split;
+		syncbatch::split(batch, kMaxNames, kMaxBytes, split);
+		std::lock_guard<std::mutex> lock(mutex);
+		for (auto it = split.begin(); it != split.end(); ++it)
+			queue.push_back(std::move(*it));
+		cond.notify_one();
+	});
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		done = true;
+	}
+	cond.notify_one();
+	rpcThread.join();
+	t1 = Clock::now();
+
+	CHECK_EQ(all.size(), pipelinedNames);
+	CHECK_EQ(sequentialBatches, pipelinedBatches);
+	CHECK_EQ(sequentialBytes, pipelinedBytes);
+	printf("  %u MiB image, %u names, %u to send in batches of up to %u names / %u KiB, %u bytes serialized\n",
+		unsigned(kImageSize >> 20), unsigned(kCount), unsigned(all.size()), kMaxNames, unsigned(kMaxBytes >> 10),
+		unsigned(pipelinedBytes));
+	printf("  collect, then send: first batch after %7.1f ms, all after %7.1f ms\n", sequentialFirst, sequentialTotal);
+	printf("  pipelined:          first batch after %7.1f ms, all after %7.1f ms\n", ms(t0, firstSent), ms(t0, t1));
+}
@@ -0,0 +1,81 @@
+/* Labeless
+ * by Aliaksandr Trafimchuk
+ *
+ * Source code released under
+ * Creative Commons BY-NC 4.0
+ * http://creativecommons.org/licenses/by-nc/4.0
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+/* A tiny harness for the helpers which need neither IDA nor OllyDbg.
+ *
+ *   TEST(name) { CHECK(expr); CHECK_EQ(expected, actual); }
+ *   BENCH(name) { ... } runs with "--bench" only and prints its own figures
+ *
+ * A failed check reports itself and the test goes on, the process exit code is the count of failed tests.
+ */
+
+namespace testing {
+
+typedef void (*Fn)();
+
+struct Case
+{
+	const char*	name;
+	Fn			fn;
+	bool		bench;
+};
+
+inline std::vector<Case>& cases()
+{
+	static std::vector<Case> rv;
+	return rv;
+}
+
+inline unsigned& failures()
+{
+	static unsigned rv;
+	return rv;
+}
+
+struct Registrar
+{
+	Registrar(const char* name, Fn fn, bool bench)
+	{
+		const Case c = { name, fn, bench };
+		cases().push_back(c);
+	}
+};
+
+inline void fail(const char* file, int line, const std::string& what)
+{
+	++failures();
+	fprintf(stderr, "%s(%d): check failed: %s\n", file, line, what.c_str());
+}
+
+} // testing
+
+#define TESTING_CASE(name, bench) \
+	static void name(); \
+	static const testing::Registrar name##_registrar(#name, name, bench); \
+	static void name()
+
+#define TEST(name) TESTING_CASE(test_##name, false)
+#define BENCH(name) TESTING_CASE(bench_##name, true)
+
+#define CHECK(expr) \
+	do { \
+		if (!(expr)) \
+			testing::fail(__FILE__, __LINE__, #expr); \
+	} while (0)
+
+#define CHECK_EQ(expected, actual) \
+	do { \
+		if (!((expected) == (actual))) \
+			testing::fail(__FILE__, __LINE__, #expected " == " #actual); \
+	} while (0)